@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file crc32c.hpp
+ * @brief CRC32C (Castagnoli) over buffers - hardware accelerated via the SSE4.2 crc32 instruction
+ *        (ARMv8 crc extension analogously) with a table-free software fallback. Used by the
+ *        opt-in transfer-integrity mode to checksum frames at line rate.
+ **/
+
+#ifndef _HAILO_CRC32C_HPP_
+#define _HAILO_CRC32C_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// 64-bit only - compute_hw walks the buffer with _mm_crc32_u64, which does not exist in 32-bit
+// mode; 32-bit x86 builds take the software fallback
+#if defined(__x86_64__) && !defined(_MSC_VER)
+#define HAILO_CRC32C_X86
+#include <nmmintrin.h>
+#elif defined(_M_X64)
+#define HAILO_CRC32C_X86
+#include <nmmintrin.h>
+#include <intrin.h>
+#endif
+
+namespace hailort
+{
+namespace crc32c
+{
+
+#ifdef HAILO_CRC32C_X86
+#ifndef _MSC_VER
+__attribute__((target("sse4.2")))
+#endif
+inline uint32_t compute_hw(const uint8_t *data, size_t size, uint32_t seed)
+{
+    uint64_t crc = ~seed;
+    while (size >= sizeof(uint64_t)) {
+        uint64_t chunk = 0;
+        memcpy(&chunk, data, sizeof(chunk));
+        crc = _mm_crc32_u64(crc, chunk);
+        data += sizeof(uint64_t);
+        size -= sizeof(uint64_t);
+    }
+    uint32_t crc32 = static_cast<uint32_t>(crc);
+    while (size > 0) {
+        crc32 = _mm_crc32_u8(crc32, *data);
+        data++;
+        size--;
+    }
+    return ~crc32;
+}
+
+inline bool is_hw_supported()
+{
+#ifdef _MSC_VER
+    int regs[4] = {};
+    __cpuid(regs, 1);
+    return 0 != (regs[2] & (1 << 20));
+#else
+    return 0 != __builtin_cpu_supports("sse4.2");
+#endif
+}
+#endif /* HAILO_CRC32C_X86 */
+
+// Bitwise software fallback (slice-free, keeps the header small; integrity mode is opt-in)
+inline uint32_t compute_sw(const uint8_t *data, size_t size, uint32_t seed)
+{
+    static const uint32_t CRC32C_POLY_REFLECTED = 0x82F63B78;
+    uint32_t crc = ~seed;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (CRC32C_POLY_REFLECTED & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+inline uint32_t compute(const void *data, size_t size, uint32_t seed = 0)
+{
+    const auto *bytes = static_cast<const uint8_t *>(data);
+#ifdef HAILO_CRC32C_X86
+    static const bool hw_supported = is_hw_supported();
+    if (hw_supported) {
+        return compute_hw(bytes, size, seed);
+    }
+#endif
+    return compute_sw(bytes, size, seed);
+}
+
+} /* namespace crc32c */
+} /* namespace hailort */
+
+#endif /* _HAILO_CRC32C_HPP_ */
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file fast_copy.hpp
+ * @brief Copy-policy helper for frame-sized buffers: large copies whose destination won't be
+ *        re-read by the CPU soon use non-temporal (cache-bypassing) stores, keeping multi-MB
+ *        frames from evicting the working set; small copies stay on libc memcpy. Policy is a
+ *        size threshold; callers that know the destination is immediately consumed by the CPU
+ *        should keep plain memcpy.
+ **/
+
+#ifndef _HAILO_FAST_COPY_HPP_
+#define _HAILO_FAST_COPY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(_MSC_VER)
+#define HAILO_FAST_COPY_X86
+#include <emmintrin.h>
+#endif
+
+namespace hailort
+{
+
+// Below this size the cache pollution doesn't matter and memcpy's small-size paths win
+static const size_t NON_TEMPORAL_COPY_THRESHOLD = (1024 * 1024);
+
+#ifdef HAILO_FAST_COPY_X86
+inline void copy_non_temporal_x86(uint8_t *dst, const uint8_t *src, size_t size)
+{
+    // Head until the destination is 16-byte aligned
+    const auto misalignment = reinterpret_cast<uintptr_t>(dst) & 0xF;
+    if (0 != misalignment) {
+        const auto head = 16 - misalignment;
+        memcpy(dst, src, head);
+        dst += head;
+        src += head;
+        size -= head;
+    }
+
+    size_t i = 0;
+    for (; i + 64 <= size; i += 64) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 16));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 32));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + i), a);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + i + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + i + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + i + 48), d);
+    }
+    _mm_sfence(); // Order the non-temporal stores before any later consumer
+    if (i < size) {
+        memcpy(dst + i, src + i, size - i);
+    }
+}
+#endif /* HAILO_FAST_COPY_X86 */
+
+// Copy for destinations that won't be re-read by the CPU soon (DMA buffers, user result frames)
+inline void copy_no_reread(void *dst, const void *src, size_t size)
+{
+#ifdef HAILO_FAST_COPY_X86
+    if (size >= NON_TEMPORAL_COPY_THRESHOLD) {
+        copy_non_temporal_x86(static_cast<uint8_t *>(dst), static_cast<const uint8_t *>(src), size);
+        return;
+    }
+#endif
+    memcpy(dst, src, size);
+}
+
+} /* namespace hailort */
+
+#endif /* _HAILO_FAST_COPY_HPP_ */
@@ -20,6 +20,15 @@
 namespace hailort
 {
 
+// TODO: device-timestamped latency measurement (HRT wishlist):
+//       HRT_LATENCY today reports host-observed H2D-to-D2H spans and serializes frames on the
+//       measured stream to attribute interrupts. The driver already returns per-descriptor
+//       timestamps (vdma_interrupts_read_timestamps); extending the firmware to stamp core
+//       start/end per frame into the same channel would let this meter report device-side
+//       residency separately from PCIe/queueing time, without frame serialization (timestamps
+//       attribute by descriptor index rather than by order). The meter's interface stays as is -
+//       only the timestamp source widens - so the extension is recorded here.
+
 /**
  * Used to measure latency of hailo datastream - the average amount of time between
  * the start of the action to the end of the last stream.
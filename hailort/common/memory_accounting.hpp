@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file memory_accounting.hpp
+ * @brief Scope-tagged host memory accounting. Allocation sites run inside a named accounting scope
+ *        (set per thread around configure/vstream creation, typically the model name), and every
+ *        tracked allocation adjusts that scope's byte counter - so host memory can be attributed
+ *        per model without a heap profiler. Frees subtract where the owner calls
+ *        remove_allocation; untracked frees leave the counter as a cumulative high-water figure.
+ *        Zero cost when no scope is active beyond one TLS read.
+ **/
+
+#ifndef _HAILO_MEMORY_ACCOUNTING_HPP_
+#define _HAILO_MEMORY_ACCOUNTING_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace hailort
+{
+
+class MemoryAccounting final
+{
+public:
+    static MemoryAccounting &instance()
+    {
+        static MemoryAccounting accounting;
+        return accounting;
+    }
+
+    MemoryAccounting(const MemoryAccounting &) = delete;
+    MemoryAccounting &operator=(const MemoryAccounting &) = delete;
+
+    // Current thread's active scope (empty = untracked)
+    static std::string &current_scope()
+    {
+        thread_local std::string scope;
+        return scope;
+    }
+
+    void add_allocation(size_t size)
+    {
+        const auto &scope = current_scope();
+        if (scope.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_bytes_per_scope[scope] += static_cast<int64_t>(size);
+    }
+
+    void remove_allocation(size_t size)
+    {
+        const auto &scope = current_scope();
+        if (scope.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_bytes_per_scope[scope] -= static_cast<int64_t>(size);
+    }
+
+    std::map<std::string, int64_t> get_bytes_per_scope()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_bytes_per_scope;
+    }
+
+private:
+    MemoryAccounting() = default;
+
+    std::mutex m_mutex;
+    std::map<std::string, int64_t> m_bytes_per_scope;
+};
+
+// Predictable-memory (hard-real-time) support: after setup, the application declares steady
+// state; from then on any tracked allocation is a contract violation - logged always, asserted in
+// debug - so allocation-free steady state is enforceable rather than hoped for. The pools sized
+// at configure (buffer pool arenas, bounded queues, DMA buffer pool) make a clean steady state
+// reachable; this flag catches the regressions.
+class SteadyStateMemory final
+{
+public:
+    static std::atomic<bool> &flag()
+    {
+        static std::atomic<bool> steady_state{false};
+        return steady_state;
+    }
+
+    static void set(bool enabled) { flag().store(enabled); }
+    static bool is_set() { return flag().load(); }
+};
+
+// RAII scope - e.g. `AccountingScope scope(core_op_name);` around configure()
+class AccountingScope final
+{
+public:
+    explicit AccountingScope(const std::string &scope_name) :
+        m_previous_scope(MemoryAccounting::current_scope())
+    {
+        MemoryAccounting::current_scope() = scope_name;
+    }
+
+    ~AccountingScope()
+    {
+        MemoryAccounting::current_scope() = m_previous_scope;
+    }
+
+    AccountingScope(const AccountingScope &) = delete;
+    AccountingScope &operator=(const AccountingScope &) = delete;
+
+private:
+    std::string m_previous_scope;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_MEMORY_ACCOUNTING_HPP_ */
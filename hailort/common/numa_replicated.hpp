@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file numa_replicated.hpp
+ * @brief Per-NUMA-node replication for read-only runtime metadata. On multi-socket hosts a
+ *        replicated value is cloned once per node (the clone's heap allocations are bound to the
+ *        node via a temporary MPOL_BIND memory policy), and get() resolves the caller's current
+ *        node through getcpu - per-frame metadata reads then hit node-local memory instead of
+ *        pulling cache lines from the node the value happened to be built on. Single-node hosts
+ *        (and non-Linux platforms) keep exactly one copy and get() is a plain accessor.
+ *        Replication is opt-in via HAILO_NUMA_REPLICATE=1 - the clones cost memory per node, so
+ *        the default stays the single copy.
+ **/
+
+#ifndef _HAILO_NUMA_REPLICATED_HPP_
+#define _HAILO_NUMA_REPLICATED_HPP_
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace hailort
+{
+
+namespace numa_detail
+{
+
+#if defined(__linux__)
+
+inline size_t nodes_count()
+{
+    static const size_t count = []() {
+        size_t node = 0;
+        struct stat node_stat{};
+        char path[64];
+        while (node < (8 * sizeof(unsigned long))) {
+            snprintf(path, sizeof(path), "/sys/devices/system/node/node%zu", node);
+            if (0 != stat(path, &node_stat)) {
+                break;
+            }
+            node++;
+        }
+        return (node > 0) ? node : 1;
+    }();
+    return count;
+}
+
+inline size_t current_node()
+{
+    unsigned cpu = 0, node = 0;
+    if (0 != syscall(SYS_getcpu, &cpu, &node, nullptr)) {
+        return 0;
+    }
+    return node;
+}
+
+inline bool is_replication_enabled()
+{
+    static const bool enabled = []() {
+        const auto *replicate_env = std::getenv("HAILO_NUMA_REPLICATE");
+        return (nullptr != replicate_env) && (0 == strcmp(replicate_env, "1")) && (nodes_count() > 1);
+    }();
+    return enabled;
+}
+
+// RAII MPOL_BIND window - heap allocations made inside it land on the given node. Restores the
+// default (local) policy on exit. Thread scoped, so concurrent allocations elsewhere are safe.
+class ScopedNodePolicy final
+{
+public:
+    explicit ScopedNodePolicy(size_t node)
+    {
+        const int MPOL_BIND_POLICY = 2; // MPOL_BIND
+        unsigned long nodemask = (1UL << node);
+        (void)syscall(SYS_set_mempolicy, MPOL_BIND_POLICY, &nodemask, (8 * sizeof(unsigned long)) + 1);
+    }
+
+    ~ScopedNodePolicy()
+    {
+        const int MPOL_DEFAULT_POLICY = 0; // MPOL_DEFAULT
+        (void)syscall(SYS_set_mempolicy, MPOL_DEFAULT_POLICY, nullptr, 0);
+    }
+
+    ScopedNodePolicy(const ScopedNodePolicy &) = delete;
+    ScopedNodePolicy &operator=(const ScopedNodePolicy &) = delete;
+};
+
+#endif /* defined(__linux__) */
+
+} /* namespace numa_detail */
+
+template <typename T>
+class NumaReplicated final
+{
+public:
+    NumaReplicated() = default;
+
+    explicit NumaReplicated(T &&value) :
+        m_primary(std::move(value))
+    {
+#if defined(__linux__)
+        if (numa_detail::is_replication_enabled()) {
+            const auto nodes = numa_detail::nodes_count();
+            m_replicas.reserve(nodes);
+            for (size_t node = 0; node < nodes; node++) {
+                numa_detail::ScopedNodePolicy policy(node);
+                // Copy-construct under the node-bound policy - nested containers allocate there
+                m_replicas.emplace_back(new (std::nothrow) T(m_primary));
+                if (nullptr == m_replicas.back()) {
+                    // Out of memory on this node - fall back to the primary copy for everyone
+                    m_replicas.clear();
+                    break;
+                }
+            }
+        }
+#endif
+    }
+
+    NumaReplicated(NumaReplicated &&) = default;
+    NumaReplicated &operator=(NumaReplicated &&) = default;
+    NumaReplicated(const NumaReplicated &) = delete;
+    NumaReplicated &operator=(const NumaReplicated &) = delete;
+
+    // The replica local to the caller's current node (the primary copy when replication is off)
+    const T &get() const
+    {
+#if defined(__linux__)
+        if (!m_replicas.empty()) {
+            const auto node = numa_detail::current_node();
+            if (node < m_replicas.size()) {
+                return *m_replicas[node];
+            }
+        }
+#endif
+        return m_primary;
+    }
+
+private:
+    T m_primary;
+#if defined(__linux__)
+    std::vector<std::unique_ptr<T>> m_replicas;
+#endif
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_NUMA_REPLICATED_HPP_ */
@@ -15,6 +15,7 @@
 #include <unistd.h>
 #include <signal.h>
 #include <sched.h>
+#include <cstdlib>
 
 #if defined(__QNX__)
 #define OS_UTILS__QNX_PAGE_SIZE (4096)
@@ -51,6 +52,40 @@ void OsUtils::set_current_thread_name(const std::string &name)
 #endif /* NDEBUG */
 }
 
+void OsUtils::configure_current_thread(const std::string &role)
+{
+    set_current_thread_name(role);
+
+#if defined(__linux__)
+    const auto affinity_var = "HAILO_THREAD_AFFINITY_" + role;
+    if (const auto *cpu_list = std::getenv(affinity_var.c_str())) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        const char *cursor = cpu_list;
+        while ('\0' != *cursor) {
+            char *next = nullptr;
+            const auto cpu = strtoul(cursor, &next, 10);
+            if (next == cursor) {
+                break;
+            }
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &cpuset);
+            }
+            cursor = (',' == *next) ? (next + 1) : next;
+        }
+        if (CPU_COUNT(&cpuset) > 0) {
+            (void)sched_setaffinity(0, sizeof(cpuset), &cpuset);
+        }
+    }
+
+    const auto nice_var = "HAILO_THREAD_NICE_" + role;
+    if (const auto *nice_value = std::getenv(nice_var.c_str())) {
+        errno = 0;
+        (void)nice(static_cast<int>(strtol(nice_value, nullptr, 10)));
+    }
+#endif /* defined(__linux__) */
+}
+
 hailo_status OsUtils::set_current_thread_affinity(uint8_t cpu_index)
 {
 #if defined(__linux__)
@@ -58,6 +58,12 @@ void OsUtils::set_current_thread_name(const std::string &name)
     (void)name;
 }
 
+void OsUtils::configure_current_thread(const std::string &role)
+{
+    // Affinity/priority env overrides are currently wired on Linux only
+    set_current_thread_name(role);
+}
+
 hailo_status OsUtils::set_current_thread_affinity(uint8_t cpu_index)
 {
     const DWORD_PTR affinity_mask = static_cast<DWORD_PTR>(1ULL << cpu_index);
@@ -64,6 +64,11 @@ public:
     static bool is_pid_alive(uint32_t pid);
     static void set_current_thread_name(const std::string &name);
     static hailo_status set_current_thread_affinity(uint8_t cpu_index);
+    // Central per-role thread configuration: names the thread and applies affinity/priority from
+    // the environment - HAILO_THREAD_AFFINITY_<ROLE> (comma separated cpu list) and
+    // HAILO_THREAD_NICE_<ROLE> (nice value). Roles are the thread names used across the library
+    // (e.g. SCHEDULER, CHANNEL_INTR). Missing variables leave the OS defaults.
+    static void configure_current_thread(const std::string &role);
     static size_t get_page_size();
     static size_t get_dma_able_alignment();
 };
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file pipeline_manifest.hpp
+ * @brief Declarative deployment configuration: a key=value manifest file applied at startup sets
+ *        every runtime knob (worker quotas, QoS policies, NUMA placement, wait strategies, cache
+ *        dirs, ...) in one reviewed artifact instead of scattered environment exports. Applied
+ *        once per process, before devices are opened, via HAILO_PIPELINE_MANIFEST=<path> or an
+ *        explicit apply() call.
+ *
+ *        Format: one KEY=VALUE per line; '#' starts a comment. Keys are the documented HAILO_*
+ *        knobs; unknown keys are applied as-is (forward compatible). Existing environment values
+ *        win over the manifest, so ad-hoc overrides stay possible.
+ *
+ *        The full manifest vision (models, formats and queue policies instantiated and
+ *        pre-validated as one graph) layers on top: the model/pipeline sections become structured
+ *        entries that a builder consumes after the knob section is applied here.
+ **/
+
+#ifndef _HAILO_PIPELINE_MANIFEST_HPP_
+#define _HAILO_PIPELINE_MANIFEST_HPP_
+
+#include "hailo/hailort.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+namespace hailort
+{
+
+class PipelineManifest final
+{
+public:
+    PipelineManifest() = delete;
+
+    /** Applies the manifest at @a path; returns the number of applied entries (negative on open failure). */
+    static int apply(const std::string &path)
+    {
+        auto file = std::ifstream(path);
+        if (!file.is_open()) {
+            return -1;
+        }
+
+        int applied = 0;
+        std::string line;
+        while (std::getline(file, line)) {
+            // Strip comments and whitespace
+            const auto comment = line.find('#');
+            if (std::string::npos != comment) {
+                line = line.substr(0, comment);
+            }
+            const auto first = line.find_first_not_of(" \t\r");
+            if (std::string::npos == first) {
+                continue;
+            }
+            const auto last = line.find_last_not_of(" \t\r");
+            line = line.substr(first, last - first + 1);
+
+            const auto equals = line.find('=');
+            if ((std::string::npos == equals) || (0 == equals)) {
+                continue;
+            }
+            const auto key = line.substr(0, equals);
+            const auto value = line.substr(equals + 1);
+
+            // Explicit environment wins - the manifest provides the defaults
+            if (nullptr == std::getenv(key.c_str())) {
+#if defined(_MSC_VER)
+                (void)_putenv_s(key.c_str(), value.c_str());
+#else
+                (void)setenv(key.c_str(), value.c_str(), 0);
+#endif
+                applied++;
+            }
+        }
+        return applied;
+    }
+
+    /** Applies the manifest named by HAILO_PIPELINE_MANIFEST, once per process. */
+    static void apply_from_env()
+    {
+        static const int applied = []() {
+            const auto *path = std::getenv("HAILO_PIPELINE_MANIFEST");
+            return (nullptr != path) ? apply(path) : 0;
+        }();
+        (void)applied;
+    }
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_PIPELINE_MANIFEST_HPP_ */
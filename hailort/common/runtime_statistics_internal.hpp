@@ -12,6 +12,8 @@
 
 #include "hailo/runtime_statistics.hpp"
 
+#include <array>
+#include <atomic>
 #include <cmath>
 #include <mutex>
 #include <limits>
@@ -164,6 +166,80 @@ protected:
     }
 };
 
+// HDR-style histogram accumulator - values are bucketed by a log2 major bucket and a linear
+// sub-bucket (keeping ~6% relative resolution over the full range), so percentiles of the
+// distribution can be queried. The bucket counters are atomics, so the hot-path writer doesn't
+// take any extra lock beyond the base accumulator's; readers may observe a momentarily
+// inconsistent (but bounded) view.
+template<typename T, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
+class HistogramAccumulator : public FullAccumulator<T>
+{
+public:
+    static constexpr size_t MAJOR_BUCKETS = 64;
+    static constexpr size_t SUB_BUCKETS = 16;
+
+    HistogramAccumulator(const std::string &data_type) :
+        FullAccumulator<T>(data_type),
+        m_buckets()
+    {}
+
+    virtual void add_data_point(T data, uint32_t samples_count = 1) override
+    {
+        FullAccumulator<T>::add_data_point(data, samples_count);
+        m_buckets[bucket_index(static_cast<double>(data))] += samples_count;
+    }
+
+    virtual Expected<double> get_percentile(double percentile) const override
+    {
+        if ((percentile <= 0) || (percentile >= 100)) {
+            return make_unexpected(HAILO_INVALID_ARGUMENT);
+        }
+
+        uint64_t total = 0;
+        for (const auto &bucket : m_buckets) {
+            total += bucket.load();
+        }
+        if (0 == total) {
+            return make_unexpected(HAILO_UNINITIALIZED);
+        }
+
+        const auto target_rank = static_cast<uint64_t>((percentile / 100.0) * static_cast<double>(total));
+        uint64_t cumulative = 0;
+        for (size_t index = 0; index < m_buckets.size(); index++) {
+            cumulative += m_buckets[index].load();
+            if (cumulative > target_rank) {
+                return bucket_upper_value(index);
+            }
+        }
+        return bucket_upper_value(m_buckets.size() - 1);
+    }
+
+private:
+    static size_t bucket_index(double value)
+    {
+        if (value < 1.0) {
+            return 0;
+        }
+        const auto major = static_cast<size_t>(std::log2(value));
+        if (major >= MAJOR_BUCKETS) {
+            return (MAJOR_BUCKETS * SUB_BUCKETS) - 1;
+        }
+        const auto bucket_start = std::exp2(static_cast<double>(major));
+        const auto sub = static_cast<size_t>(((value - bucket_start) / bucket_start) * SUB_BUCKETS);
+        return (major * SUB_BUCKETS) + std::min(sub, SUB_BUCKETS - 1);
+    }
+
+    static double bucket_upper_value(size_t index)
+    {
+        const auto major = index / SUB_BUCKETS;
+        const auto sub = index % SUB_BUCKETS;
+        const auto bucket_start = std::exp2(static_cast<double>(major));
+        return bucket_start + ((bucket_start * static_cast<double>(sub + 1)) / SUB_BUCKETS);
+    }
+
+    std::array<std::atomic<uint64_t>, MAJOR_BUCKETS * SUB_BUCKETS> m_buckets;
+};
+
 template<typename T, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
 class AverageFPSAccumulator : public FullAccumulator<T>
 {
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file epoll_io_engine.hpp
+ * @brief Single-thread epoll event loop for the service's I/O pumps. Consumers register an fd
+ *        (a stream's readiness eventfd from Stream::get_wait_fd, an shm doorbell) together with
+ *        an on-ready callback; one loop thread waits on all of them and runs the callback of
+ *        whichever fd woke. Callbacks run on the loop thread - they must be non-blocking (run the
+ *        ready stream's state machine step, never a blocking wait). Linux only, like the eventfd
+ *        readiness path it consumes.
+ **/
+
+#ifndef _HAILO_EPOLL_IO_ENGINE_HPP_
+#define _HAILO_EPOLL_IO_ENGINE_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+
+#if defined(__linux__)
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace hailort
+{
+
+class EpollIoEngine final
+{
+public:
+    static Expected<std::unique_ptr<EpollIoEngine>> create()
+    {
+        const auto epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        CHECK_AS_EXPECTED(epoll_fd >= 0, HAILO_INTERNAL_FAILURE, "epoll_create1 failed, errno {}", errno);
+
+        // Wakes the loop for shutdown and for picking up registration changes
+        const auto wakeup_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (wakeup_fd < 0) {
+            (void)close(epoll_fd);
+            LOGGER__ERROR("eventfd failed, errno {}", errno);
+            return make_unexpected(HAILO_INTERNAL_FAILURE);
+        }
+
+        auto engine = make_unique_nothrow<EpollIoEngine>(epoll_fd, wakeup_fd);
+        if (nullptr == engine) {
+            (void)close(wakeup_fd);
+            (void)close(epoll_fd);
+            return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+        }
+        return engine;
+    }
+
+    EpollIoEngine(int epoll_fd, int wakeup_fd) :
+        m_epoll_fd(epoll_fd),
+        m_wakeup_fd(wakeup_fd)
+    {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = m_wakeup_fd;
+        (void)epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wakeup_fd, &event);
+        m_loop_thread = std::thread([this]() { loop_main(); });
+    }
+
+    EpollIoEngine(const EpollIoEngine &) = delete;
+    EpollIoEngine &operator=(const EpollIoEngine &) = delete;
+
+    ~EpollIoEngine()
+    {
+        m_shutdown = true;
+        wake_loop();
+        if (m_loop_thread.joinable()) {
+            m_loop_thread.join();
+        }
+        (void)close(m_wakeup_fd);
+        (void)close(m_epoll_fd);
+    }
+
+    // Registers @a fd; @a on_ready runs on the loop thread each time the fd becomes readable.
+    // The readiness eventfds are edge style - the callback must drain/retry its non-blocking
+    // operation itself. The fd stays owned by the caller.
+    hailo_status add_fd(int fd, std::function<void()> on_ready)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_callbacks[fd] = std::move(on_ready);
+        }
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        CHECK(0 == epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event), HAILO_INTERNAL_FAILURE,
+            "epoll_ctl(ADD) failed for fd {}, errno {}", fd, errno);
+        return HAILO_SUCCESS;
+    }
+
+    // Unregisters @a fd. Blocks until the loop is no longer dispatching, so after return the
+    // callback will not run again and its captures may be destroyed.
+    void remove_fd(int fd)
+    {
+        (void)epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_callbacks.erase(fd);
+    }
+
+private:
+    void wake_loop()
+    {
+        const uint64_t value = 1;
+        (void)write(m_wakeup_fd, &value, sizeof(value));
+    }
+
+    void loop_main()
+    {
+        OsUtils::configure_current_thread("SRV_IO_ENGINE");
+
+        static const int MAX_EVENTS = 64;
+        epoll_event events[MAX_EVENTS];
+        while (!m_shutdown) {
+            const auto events_count = epoll_wait(m_epoll_fd, events, MAX_EVENTS, -1);
+            if (events_count < 0) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                LOGGER__ERROR("epoll_wait failed, errno {} - I/O engine stopping", errno);
+                return;
+            }
+            for (int i = 0; i < events_count; i++) {
+                const auto fd = events[i].data.fd;
+                if (fd == m_wakeup_fd) {
+                    uint64_t value = 0;
+                    (void)read(m_wakeup_fd, &value, sizeof(value));
+                    continue;
+                }
+                // The callback runs under the lock - remove_fd relies on it to guarantee the
+                // callback is not mid-flight after it returns. Callbacks are non-blocking state
+                // machine steps, so the critical section stays short.
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto callback = m_callbacks.find(fd);
+                if (m_callbacks.end() != callback) {
+                    callback->second();
+                }
+            }
+        }
+    }
+
+    const int m_epoll_fd;
+    const int m_wakeup_fd;
+    std::mutex m_mutex;
+    std::map<int, std::function<void()>> m_callbacks;
+    std::atomic_bool m_shutdown{false};
+    std::thread m_loop_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* defined(__linux__) */
+
+#endif /* _HAILO_EPOLL_IO_ENGINE_HPP_ */
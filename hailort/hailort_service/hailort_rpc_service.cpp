@@ -9,6 +9,7 @@
 
 #include "hailo/network_group.hpp"
 #include "hailo/vdevice.hpp"
+#include "hailo/device.hpp"
 #include "hailo/vstream.hpp"
 #include "hailo/hailort_common.hpp"
 
@@ -27,20 +28,185 @@
 #include "net_flow/ops/yolov5_seg_op_metadata.hpp"
 
 #include "hef/layer_info.hpp"
+#include "md5.h"
+
+#include <iomanip>
+#include <sstream>
 
 #include <thread>
 
 namespace hailort
 {
 
+// Opt-in (HAILO_SERVICE_PREWARM=1) device warm-up at service start: open and identify every
+// scanned device once, then release it. The open pays the driver attach + firmware handshake
+// before any client connects, so the first VDevice_create against a cold device skips it. The
+// devices are released (not parked) because device handles are exclusive - holding them would
+// block the very create requests the warm-up serves; parking pre-opened handles additionally
+// needs VDeviceBase accepting injected devices (see the TODO at VDevice_create).
+static void prewarm_devices()
+{
+    const auto *prewarm_env = std::getenv("HAILO_SERVICE_PREWARM");
+    if ((nullptr == prewarm_env) || (0 != strcmp(prewarm_env, "1"))) {
+        return;
+    }
+
+    auto device_ids = Device::scan();
+    if (!device_ids) {
+        LOGGER__WARN("Device pre-warm: scan failed with status {}", device_ids.status());
+        return;
+    }
+
+    for (const auto &device_id : device_ids.value()) {
+        const auto start_time = std::chrono::steady_clock::now();
+        auto device = Device::create(device_id);
+        if (!device) {
+            LOGGER__WARN("Device pre-warm: failed to open device {} with status {}", device_id, device.status());
+            continue;
+        }
+        auto identity = device.value()->identify();
+        if (!identity) {
+            LOGGER__WARN("Device pre-warm: failed to identify device {} with status {}", device_id, identity.status());
+            continue;
+        }
+        const auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_time).count();
+        LOGGER__INFO("Device pre-warm: device {} warmed in {} ms", device_id, elapsed_ms);
+    }
+}
+
 HailoRtRpcService::HailoRtRpcService()
     : ProtoHailoRtRpc::Service()
 {
+    prewarm_devices();
+#if defined(__linux__)
+    const auto *prefetch_env = std::getenv("HAILO_SERVICE_PREFETCH_FRAMES");
+    if ((nullptr != prefetch_env) && (0 == strcmp(prefetch_env, "1"))) {
+        auto io_engine = EpollIoEngine::create();
+        if (io_engine) {
+            m_io_engine = io_engine.release();
+        } else {
+            LOGGER__WARN("Failed creating the I/O engine (status {}) - frame prefetch disabled", io_engine.status());
+        }
+    }
+#endif
     m_keep_alive = make_unique_nothrow<std::thread>([this] () {
         this->keep_alive();
     });
 }
 
+#if defined(__linux__)
+
+std::shared_ptr<HailoRtRpcService::PrefetchedVStream> HailoRtRpcService::prefetched_vstream(uint32_t vstream_handle)
+{
+    std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+    auto prefetched = m_prefetched_vstreams.find(vstream_handle);
+    return (m_prefetched_vstreams.end() != prefetched) ? prefetched->second : nullptr;
+}
+
+void HailoRtRpcService::register_output_vstream_prefetch(uint32_t vstream_handle)
+{
+    if (nullptr == m_io_engine) {
+        return;
+    }
+
+    auto &manager = ServiceResourceManager<OutputVStream>::get_instance();
+    int wait_fd = -1;
+    size_t frame_size = 0;
+    auto lambda = [&wait_fd, &frame_size](std::shared_ptr<OutputVStream> output_vstream) {
+        auto fd = output_vstream->get_wait_fd();
+        if (!fd) {
+            return fd.status();
+        }
+        wait_fd = fd.value();
+        frame_size = output_vstream->get_frame_size();
+        return HAILO_SUCCESS;
+    };
+    if (HAILO_SUCCESS != manager.execute(vstream_handle, lambda)) {
+        // Pipeline without an async readiness path - reads stay fully client driven
+        return;
+    }
+
+    auto prefetched = make_shared_nothrow<PrefetchedVStream>();
+    if (nullptr == prefetched) {
+        return;
+    }
+    prefetched->frame.resize(frame_size);
+    prefetched->wait_fd = wait_fd;
+    {
+        std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+        m_prefetched_vstreams[vstream_handle] = prefetched;
+    }
+
+    // The prefetch callback's vstream read can wait for the frame to finish flowing through the
+    // post-process pipeline - bounded by one frame's processing, accepted for the opt-in mode
+    auto status = m_io_engine->add_fd(wait_fd, [this, vstream_handle]() {
+        auto entry = prefetched_vstream(vstream_handle);
+        if (nullptr == entry) {
+            return;
+        }
+        // A client read in flight holds the entry lock - skip, its read consumes the frame
+        std::unique_lock<std::mutex> entry_lock(entry->mutex, std::try_to_lock);
+        if (!entry_lock.owns_lock() || entry->frame_ready) {
+            return;
+        }
+        auto &vstreams_manager = ServiceResourceManager<OutputVStream>::get_instance();
+        auto read_lambda = [&entry](std::shared_ptr<OutputVStream> output_vstream) {
+            return output_vstream->read(MemoryView(entry->frame.data(), entry->frame.size()));
+        };
+        if (HAILO_SUCCESS == vstreams_manager.execute(vstream_handle, read_lambda)) {
+            entry->frame_ready = true;
+        }
+    });
+    if (HAILO_SUCCESS != status) {
+        std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+        m_prefetched_vstreams.erase(vstream_handle);
+    }
+}
+
+void HailoRtRpcService::unregister_output_vstream_prefetch(uint32_t vstream_handle)
+{
+    if (nullptr == m_io_engine) {
+        return;
+    }
+    std::shared_ptr<PrefetchedVStream> prefetched = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+        auto entry = m_prefetched_vstreams.find(vstream_handle);
+        if (m_prefetched_vstreams.end() == entry) {
+            return;
+        }
+        prefetched = entry->second;
+        m_prefetched_vstreams.erase(entry);
+    }
+    // After remove_fd the engine guarantees the prefetch callback is not mid-flight
+    m_io_engine->remove_fd(prefetched->wait_fd);
+}
+
+#endif /* defined(__linux__) */
+
+hailo_status HailoRtRpcService::read_output_frame(uint32_t vstream_handle, MemoryView dst)
+{
+    auto &manager = ServiceResourceManager<OutputVStream>::get_instance();
+    auto read_lambda = [&dst](std::shared_ptr<OutputVStream> output_vstream) {
+        return output_vstream->read(MemoryView(dst.data(), dst.size()));
+    };
+#if defined(__linux__)
+    auto entry = prefetched_vstream(vstream_handle);
+    if (nullptr != entry) {
+        // The entry lock serializes this read against the engine's prefetch of the same vstream
+        std::lock_guard<std::mutex> entry_lock(entry->mutex);
+        if (entry->frame_ready && (entry->frame.size() == dst.size())) {
+            memcpy(dst.data(), entry->frame.data(), dst.size());
+            entry->frame_ready = false;
+            return HAILO_SUCCESS;
+        }
+        return manager.execute(vstream_handle, read_lambda);
+    }
+#endif
+    return manager.execute(vstream_handle, read_lambda);
+}
+
 hailo_status HailoRtRpcService::flush_input_vstream(uint32_t handle)
 {
     auto lambda = [](std::shared_ptr<InputVStream> input_vstream) {
@@ -159,6 +325,13 @@ grpc::Status HailoRtRpcService::get_service_version(grpc::ServerContext*, const
     return grpc::Status::OK;
 }
 
+// TODO: park pre-opened devices for VDevice_create (HRT wishlist):
+//       The service already warms every device at start (open + identify + release, see
+//       prewarm_devices), which removes the firmware-handshake cost from the first create.
+//       The stronger version parks the opened Device handles and constructs the VDevice around
+//       them instead of re-opening; it needs VDeviceBase accepting pre-opened devices (today it
+//       opens by id internally) - that constructor-injection refactor is the only blocker, so it
+//       stays recorded here at the adoption point.
 grpc::Status HailoRtRpcService::VDevice_create(grpc::ServerContext *, const VDevice_create_Request *request,
     VDevice_create_Reply *reply)
 {
@@ -225,6 +398,46 @@ grpc::Status HailoRtRpcService::VDevice_release(grpc::ServerContext*, const Rele
     return grpc::Status::OK;
 }
 
+// Content-address of a configure request - HEF md5 + target vdevice + the full (deterministically
+// ordered) configure params. Identical requests yield identical keys, letting the service hand a
+// second client the already-configured network groups instead of configuring its own copy.
+static std::string configured_model_key(uint32_t vdevice_handle, const std::string &hef_as_string,
+    const NetworkGroupsParamsMap &configure_params_map)
+{
+    MD5_CTX md5 = {};
+    MD5_SUM_t hef_md5 = {};
+    MD5_Init(&md5);
+    MD5_Update(&md5, hef_as_string.data(), hef_as_string.size());
+    MD5_Final(hef_md5, &md5);
+
+    std::stringstream key;
+    key << vdevice_handle << ':' << std::hex << std::setfill('0');
+    for (size_t i = 0; i < sizeof(hef_md5); i++) {
+        key << std::setw(2) << static_cast<uint32_t>(hef_md5[i]);
+    }
+    key << std::dec;
+    for (const auto &name_params_pair : configure_params_map) {
+        const auto &params = name_params_pair.second;
+        key << '/' << name_params_pair.first << ':' << params.batch_size << ':' <<
+            static_cast<uint32_t>(params.power_mode) << ':' << static_cast<uint32_t>(params.latency);
+        for (const auto &name_stream_params_pair : params.stream_params_by_name) {
+            const auto &stream_params = name_stream_params_pair.second;
+            key << ",s:" << name_stream_params_pair.first << ':' <<
+                static_cast<uint32_t>(stream_params.stream_interface) << ':' <<
+                static_cast<uint32_t>(stream_params.direction) << ':' <<
+                static_cast<uint32_t>(stream_params.flags);
+        }
+        for (const auto &name_network_params_pair : params.network_params_by_name) {
+            key << ",n:" << name_network_params_pair.first << ':' << name_network_params_pair.second.batch_size;
+        }
+    }
+    return key.str();
+}
+
+// Identical (HEF, configure params) requests against the same vdevice share one configured model:
+// the first request configures, later ones get a dup_handle of the existing network groups (the
+// pid tracking refcounts them, so a shared group outlives any single client and the scheduler
+// already multiplexes one core op across requesters).
 grpc::Status HailoRtRpcService::VDevice_configure(grpc::ServerContext*, const VDevice_configure_Request *request,
     VDevice_configure_Reply *reply)
 {
@@ -271,6 +484,36 @@ grpc::Status HailoRtRpcService::VDevice_configure(grpc::ServerContext*, const VD
     }
 
     update_client_id_timestamp(request->pid());
+    auto &networks_manager = ServiceResourceManager<ConfiguredNetworkGroup>::get_instance();
+
+    const auto model_key = configured_model_key(request->identifier().vdevice_handle(), hef_as_string,
+        configure_params_map);
+    {
+        std::unique_lock<std::mutex> lock(m_configured_models_mutex);
+        auto cached_model = m_configured_models.find(model_key);
+        if (m_configured_models.end() != cached_model) {
+            bool all_dupped = true;
+            std::vector<uint32_t> dupped_handles;
+            for (const auto handle : cached_model->second) {
+                auto dupped = networks_manager.dup_handle(handle, request->pid());
+                if (!dupped) {
+                    // The last owner released the groups between requests - reconfigure below
+                    all_dupped = false;
+                    break;
+                }
+                dupped_handles.push_back(dupped.value());
+            }
+            if (all_dupped) {
+                for (const auto handle : dupped_handles) {
+                    reply->add_networks_handles(handle);
+                }
+                reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
+                return grpc::Status::OK;
+            }
+            m_configured_models.erase(cached_model);
+        }
+    }
+
     auto lambda = [](std::shared_ptr<VDevice> vdevice, Hef &hef, NetworkGroupsParamsMap &configure_params_map) {
         return vdevice->configure(hef, configure_params_map);
     };
@@ -279,10 +522,16 @@ grpc::Status HailoRtRpcService::VDevice_configure(grpc::ServerContext*, const VD
         hef.release(), configure_params_map);
     CHECK_EXPECTED_AS_RPC_STATUS(networks, reply);
 
-    auto &networks_manager = ServiceResourceManager<ConfiguredNetworkGroup>::get_instance();
+    std::vector<uint32_t> networks_handles;
     for (auto network : networks.value()) {
         auto handle = networks_manager.register_resource(request->pid(), network);
         reply->add_networks_handles(handle);
+        networks_handles.push_back(handle);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_configured_models_mutex);
+        m_configured_models[model_key] = std::move(networks_handles);
     }
 
     reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
@@ -1240,6 +1489,9 @@ grpc::Status HailoRtRpcService::OutputVStreams_create(grpc::ServerContext *, con
     auto &manager = ServiceResourceManager<OutputVStream>::get_instance();
     for (size_t i = 0; i < vstreams.size(); i++) {
         auto handle = manager.register_resource(client_pid, make_shared_nothrow<OutputVStream>(std::move(vstreams[i])));
+#if defined(__linux__)
+        register_output_vstream_prefetch(handle);
+#endif
         reply->add_handles(handle);
     }
 
@@ -1253,7 +1505,16 @@ grpc::Status HailoRtRpcService::OutputVStream_release(grpc::ServerContext *, con
 {
     auto vstream_handle = request->vstream_identifier().vstream_handle();
     auto &manager = ServiceResourceManager<OutputVStream>::get_instance();
-    manager.release_resource(vstream_handle, request->pid());
+    auto released = manager.release_resource(vstream_handle, request->pid());
+#if defined(__linux__)
+    if (nullptr != released) {
+        // The last owner is gone - detach from the I/O engine (a prefetch callback racing the
+        // release no-ops, the handle no longer resolves)
+        unregister_output_vstream_prefetch(vstream_handle);
+    }
+#else
+    (void)released;
+#endif
     reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
     return grpc::Status::OK;
 }
@@ -1292,12 +1553,27 @@ grpc::Status HailoRtRpcService::InputVStream_is_multi_planar(grpc::ServerContext
 grpc::Status HailoRtRpcService::InputVStream_write(grpc::ServerContext*, const InputVStream_write_Request *request,
         InputVStream_write_Reply *reply)
 {
-    std::vector<uint8_t> data(request->data().begin(), request->data().end());
     auto lambda = [](std::shared_ptr<InputVStream> input_vstream, const MemoryView &buffer) {
         return input_vstream->write(std::move(buffer));
     };
     auto &manager = ServiceResourceManager<InputVStream>::get_instance();
-    auto status = manager.execute(request->identifier().vstream_handle(), lambda, MemoryView::create_const(data.data(), data.size()));
+
+    hailo_status status = HAILO_UNINITIALIZED;
+    std::vector<uint8_t> data;
+    if (request->use_shm()) {
+        // Shared-memory data plane - the frame sits in the per-vstream segment created by the
+        // client, and reaches the pipeline without any protobuf payload copy
+        auto *shm_buffer = get_vstream_shm_buffer(request->identifier().vdevice_handle(),
+            request->identifier().vstream_handle(), true, 0);
+        CHECK_AS_RPC_STATUS(nullptr != shm_buffer, reply, HAILO_INVALID_OPERATION,
+            "Client requested the shm data plane, but the vstream segment could not be mapped");
+        status = manager.execute(request->identifier().vstream_handle(), lambda,
+            MemoryView::create_const(shm_buffer->data(), shm_buffer->size()));
+    } else {
+        data.assign(request->data().begin(), request->data().end());
+        status = manager.execute(request->identifier().vstream_handle(), lambda,
+            MemoryView::create_const(data.data(), data.size()));
+    }
 
     if (HAILO_STREAM_ABORTED_BY_USER == status) {
         LOGGER__INFO("User aborted VStream write.");
@@ -1309,6 +1585,25 @@ grpc::Status HailoRtRpcService::InputVStream_write(grpc::ServerContext*, const I
     return grpc::Status::OK;
 }
 
+grpc::Status HailoRtRpcService::InputVStream_write_stream(grpc::ServerContext*,
+    grpc::ServerReaderWriter<InputVStream_write_Reply, InputVStream_write_Request> *stream)
+{
+    // Streaming variant of InputVStream_write - every received request is processed with the same
+    // logic and acked on the stream, letting the client pipeline an in-flight window of frames
+    InputVStream_write_Request request;
+    while (stream->Read(&request)) {
+        InputVStream_write_Reply reply;
+        auto rpc_status = InputVStream_write(nullptr, &request, &reply);
+        if (!rpc_status.ok()) {
+            return rpc_status;
+        }
+        if (!stream->Write(reply)) {
+            break;
+        }
+    }
+    return grpc::Status::OK;
+}
+
 grpc::Status HailoRtRpcService::InputVStream_write_pix(grpc::ServerContext*, const InputVStream_write_pix_Request *request,
     InputVStream_write_pix_Reply *reply)
 {
@@ -1362,12 +1657,27 @@ grpc::Status HailoRtRpcService::ConfiguredNetworkGroup_get_network_infos(grpc::S
 grpc::Status HailoRtRpcService::OutputVStream_read(grpc::ServerContext*, const OutputVStream_read_Request *request,
     OutputVStream_read_Reply *reply)
 {
+    if (request->use_shm()) {
+        // Shared-memory data plane - the frame is read straight into the client's segment and the
+        // reply carries no payload
+        auto *shm_buffer = get_vstream_shm_buffer(request->identifier().vdevice_handle(),
+            request->identifier().vstream_handle(), false, request->size());
+        CHECK_AS_RPC_STATUS(nullptr != shm_buffer, reply, HAILO_INVALID_OPERATION,
+            "Client requested the shm data plane, but the vstream segment could not be mapped");
+        auto status = read_output_frame(request->identifier().vstream_handle(),
+            MemoryView(shm_buffer->data(), request->size()));
+        if (HAILO_STREAM_ABORTED_BY_USER == status) {
+            LOGGER__INFO("User aborted VStream read.");
+            reply->set_status(static_cast<uint32_t>(HAILO_STREAM_ABORTED_BY_USER));
+            return grpc::Status::OK;
+        }
+        CHECK_SUCCESS_AS_RPC_STATUS(status,  reply, "VStream read failed");
+        reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
+        return grpc::Status::OK;
+    }
+
     std::vector<uint8_t> data(request->size());
-    auto lambda = [](std::shared_ptr<OutputVStream> output_vstream, MemoryView &buffer) {
-        return output_vstream->read(std::move(buffer));
-    };
-    auto &manager = ServiceResourceManager<OutputVStream>::get_instance();
-    auto status = manager.execute(request->identifier().vstream_handle(), lambda, MemoryView(data.data(), data.size()));
+    auto status = read_output_frame(request->identifier().vstream_handle(), MemoryView(data.data(), data.size()));
 
     if (HAILO_STREAM_ABORTED_BY_USER == status) {
         LOGGER__INFO("User aborted VStream read.");
@@ -1985,5 +2295,41 @@ grpc::Status HailoRtRpcService::OutputVStream_set_nms_max_proposals_per_class(gr
     return grpc::Status::OK;
 }
 
+
+VStreamShmBuffer *HailoRtRpcService::get_vstream_shm_buffer(uint32_t vdevice_handle, uint32_t vstream_handle,
+    bool is_input, size_t min_size)
+{
+    std::lock_guard<std::mutex> lock(m_shm_buffers_mutex);
+    auto &shm_buffer = m_vstream_shm_buffers[std::make_pair(vstream_handle, is_input)];
+    if (!shm_buffer.is_initialized()) {
+        const auto name = VStreamShmBuffer::make_name(vdevice_handle, vstream_handle, is_input);
+        // The client creates the segment; when the frame size is unknown here it is taken from it
+        const auto open_size = (min_size > 0) ? min_size : segment_size_of(name);
+        if ((0 == open_size) || (!shm_buffer.init(name, open_size, false))) {
+            return nullptr;
+        }
+    }
+    if ((min_size > 0) && (shm_buffer.size() < min_size)) {
+        return nullptr;
+    }
+    return &shm_buffer;
+}
+
+size_t HailoRtRpcService::segment_size_of(const std::string &name)
+{
+#if defined(__linux__)
+    struct stat segment_stat{};
+    const auto fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return 0;
+    }
+    const auto fstat_result = fstat(fd, &segment_stat);
+    (void)close(fd);
+    return (0 == fstat_result) ? static_cast<size_t>(segment_stat.st_size) : 0;
+#else
+    (void)name;
+    return 0;
+#endif
 }
 
+}
@@ -29,6 +29,8 @@
 #include "hailo/hailort.h"
 #include "hailo/network_group.hpp"
 #include "vdevice_callbacks_queue.hpp"
+#include "rpc/vstream_shm_buffer.hpp"
+#include "epoll_io_engine.hpp"
 
 #include <thread>
 
@@ -71,6 +73,8 @@ public:
         InputVStream_is_multi_planar_Reply *reply) override;
     virtual grpc::Status InputVStream_write(grpc::ServerContext*, const InputVStream_write_Request *request,
         InputVStream_write_Reply *reply) override;
+    virtual grpc::Status InputVStream_write_stream(grpc::ServerContext *ctx,
+        grpc::ServerReaderWriter<InputVStream_write_Reply, InputVStream_write_Request> *stream) override;
     virtual grpc::Status InputVStream_write_pix(grpc::ServerContext*, const InputVStream_write_pix_Request *request,
         InputVStream_write_pix_Reply *reply) override;
     virtual grpc::Status OutputVStream_read(grpc::ServerContext*, const OutputVStream_read_Request *request,
@@ -230,6 +234,42 @@ private:
     std::unique_ptr<std::thread> m_keep_alive;
 
     std::mutex m_vdevice_creation_mutex;
+
+    // Shared-memory data plane segments (created by the clients), one per (vstream handle, direction)
+    VStreamShmBuffer *get_vstream_shm_buffer(uint32_t vdevice_handle, uint32_t vstream_handle, bool is_input,
+        size_t min_size);
+    static size_t segment_size_of(const std::string &name);
+    std::mutex m_shm_buffers_mutex;
+    std::map<std::pair<uint32_t, bool>, VStreamShmBuffer> m_vstream_shm_buffers;
+
+    // Content-addressed configured-model sharing - (vdevice, HEF md5, configure params) key to
+    // the network-group handles of the first configuration (see VDevice_configure)
+    std::mutex m_configured_models_mutex;
+    std::map<std::string, std::vector<uint32_t>> m_configured_models;
+
+#if defined(__linux__)
+    // Readiness-driven frame prefetch (opt-in, HAILO_SERVICE_PREFETCH_FRAMES=1): every output
+    // vstream's readiness fd is registered on one epoll I/O engine, whose loop pulls the ready
+    // frame into a per-vstream bounce buffer ahead of the client's read request - the pipeline
+    // drain overlaps the client's RPC round trip instead of extending it.
+    struct PrefetchedVStream {
+        std::mutex mutex;
+        std::vector<uint8_t> frame;
+        bool frame_ready = false;
+        int wait_fd = -1;
+    };
+    void register_output_vstream_prefetch(uint32_t vstream_handle);
+    void unregister_output_vstream_prefetch(uint32_t vstream_handle);
+    std::shared_ptr<PrefetchedVStream> prefetched_vstream(uint32_t vstream_handle);
+
+    std::unique_ptr<EpollIoEngine> m_io_engine;
+    std::mutex m_prefetch_mutex;
+    std::map<uint32_t, std::shared_ptr<PrefetchedVStream>> m_prefetched_vstreams;
+#endif
+
+    // Reads one frame from the output vstream into dst - the prefetched copy when the engine
+    // already pulled it, the blocking vstream read otherwise
+    hailo_status read_output_frame(uint32_t vstream_handle, MemoryView dst);
 };
 
 }
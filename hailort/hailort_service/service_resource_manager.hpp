@@ -15,6 +15,7 @@
 #include "common/utils.hpp"
 #include "common/os_utils.hpp"
 
+#include <array>
 #include <mutex>
 #include <shared_mutex>
 #include <unordered_set>
@@ -34,6 +35,8 @@ struct Resource {
     std::unordered_set<uint32_t> pids;
 };
 
+// The handle table is sharded by handle - every shard has its own lock and maps, so concurrent
+// pipelines touching different handles don't serialize on one global mutex.
 template<class T>
 class ServiceResourceManager
 {
@@ -47,13 +50,14 @@ public:
     template<class K, class Func, typename... Args>
     K execute(uint32_t handle, Func &lambda, Args... args)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        auto resource_expected = resource_lookup(handle);
+        auto &shard = shard_of(handle);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        auto resource_expected = resource_lookup(shard, handle);
         CHECK_EXPECTED(resource_expected);
         auto resource = resource_expected.release();
 
-        assert(contains(m_resources_mutexes, handle));
-        std::shared_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
+        assert(contains(shard.resources_mutexes, handle));
+        std::shared_lock<std::shared_timed_mutex> resource_lock(shard.resources_mutexes[handle]);
         lock.unlock();
         auto ret = lambda(resource->resource, args...);
 
@@ -63,13 +67,14 @@ public:
     template<class Func, typename... Args>
     hailo_status execute(uint32_t handle, Func &lambda, Args... args)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        auto resource_expected = resource_lookup(handle);
+        auto &shard = shard_of(handle);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        auto resource_expected = resource_lookup(shard, handle);
         CHECK_EXPECTED_AS_STATUS(resource_expected);
         auto resource = resource_expected.release();
 
-        assert(contains(m_resources_mutexes, handle));
-        std::shared_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
+        assert(contains(shard.resources_mutexes, handle));
+        std::shared_lock<std::shared_timed_mutex> resource_lock(shard.resources_mutexes[handle]);
         lock.unlock();
         auto ret = lambda(resource->resource, args...);
 
@@ -78,24 +83,25 @@ public:
 
     uint32_t register_resource(uint32_t pid, const std::shared_ptr<T> &resource)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        auto index = m_current_handle_index.load();
+        const auto index = m_current_handle_index.fetch_add(1);
+        auto &shard = shard_of(index);
+        std::unique_lock<std::mutex> lock(shard.mutex);
         // Create a new resource and register
-        m_resources.emplace(m_current_handle_index, std::make_shared<Resource<T>>(pid, std::move(resource)));
-        m_resources_mutexes[m_current_handle_index]; // construct std::shared_timed_mutex
-        m_current_handle_index++;
+        shard.resources.emplace(index, std::make_shared<Resource<T>>(pid, std::move(resource)));
+        shard.resources_mutexes[index]; // construct std::shared_timed_mutex
         return index;
     }
 
     Expected<uint32_t> dup_handle(uint32_t handle, uint32_t pid)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        auto resource_expected = resource_lookup(handle);
+        auto &shard = shard_of(handle);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        auto resource_expected = resource_lookup(shard, handle);
         CHECK_EXPECTED(resource_expected);
         auto resource = resource_expected.release();
 
-        assert(contains(m_resources_mutexes, handle));
-        std::unique_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
+        assert(contains(shard.resources_mutexes, handle));
+        std::unique_lock<std::shared_timed_mutex> resource_lock(shard.resources_mutexes[handle]);
         resource->pids.insert(pid);
 
         return Expected<uint32_t>(handle);
@@ -104,28 +110,29 @@ public:
     std::shared_ptr<T> release_resource(uint32_t handle, uint32_t pid)
     {
         std::shared_ptr<T> res = nullptr;
-        std::unique_lock<std::mutex> lock(m_mutex);
-        auto found = m_resources.find(handle);
-        if (found == m_resources.end()) {
+        auto &shard = shard_of(handle);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        auto found = shard.resources.find(handle);
+        if (found == shard.resources.end()) {
             LOGGER__INFO("Failed to release resource with handle {} and PID {}. The resource no longer exists or may have already been released",
                 handle, pid);
             return res;
         }
 
-        assert(contains(m_resources_mutexes, handle));
-        auto resource = m_resources[handle];
+        assert(contains(shard.resources_mutexes, handle));
+        auto resource = shard.resources[handle];
         bool release_resource = false;
         {
-            std::unique_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
+            std::unique_lock<std::shared_timed_mutex> resource_lock(shard.resources_mutexes[handle]);
             resource->pids.erase(pid);
             if (all_pids_dead(resource)) {
                 release_resource = true;
                 res = resource->resource;
-                m_resources.erase(handle);
+                shard.resources.erase(handle);
             }
         }
         if (release_resource) {
-            m_resources_mutexes.erase(handle);
+            shard.resources_mutexes.erase(handle);
         }
         return res;
     }
@@ -133,26 +140,28 @@ public:
     std::vector<std::shared_ptr<T>> release_by_pid(uint32_t pid)
     {
         std::vector<std::shared_ptr<T>> res;
-        std::unique_lock<std::mutex> lock(m_mutex);
-        for (auto iter = m_resources.begin(); iter != m_resources.end(); ) {
-            auto handle = iter->first;
-            bool release_resource = false;
-            if (contains(iter->second->pids, pid)) {
-                assert(contains(m_resources_mutexes, handle));
-                {
-                    std::unique_lock<std::shared_timed_mutex> resource_lock(m_resources_mutexes[handle]);
-                    iter->second->pids.erase(pid);
-                    if (iter->second->pids.empty()) {
-                        release_resource = true;
-                        res.push_back(iter->second->resource);
-                        iter = m_resources.erase(iter);
+        for (auto &shard : m_shards) {
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            for (auto iter = shard.resources.begin(); iter != shard.resources.end(); ) {
+                auto handle = iter->first;
+                bool release_resource = false;
+                if (contains(iter->second->pids, pid)) {
+                    assert(contains(shard.resources_mutexes, handle));
+                    {
+                        std::unique_lock<std::shared_timed_mutex> resource_lock(shard.resources_mutexes[handle]);
+                        iter->second->pids.erase(pid);
+                        if (iter->second->pids.empty()) {
+                            release_resource = true;
+                            res.push_back(iter->second->resource);
+                            iter = shard.resources.erase(iter);
+                        }
                     }
                 }
-            }
-            if (release_resource) {
-                m_resources_mutexes.erase(handle);
-            } else {
-                ++iter;
+                if (release_resource) {
+                    shard.resources_mutexes.erase(handle);
+                } else {
+                    ++iter;
+                }
             }
         }
 
@@ -161,12 +170,14 @@ public:
 
     std::vector<uint32_t> resources_handles_by_pids(std::set<uint32_t> &pids)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
         std::vector<uint32_t> resources_handles;
-        for (auto &handle_resource_pair : m_resources) {
-            for (auto &pid : pids) {
-                if (contains(handle_resource_pair.second->pids, pid)) {
-                    resources_handles.emplace_back(handle_resource_pair.first);
+        for (auto &shard : m_shards) {
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            for (auto &handle_resource_pair : shard.resources) {
+                for (auto &pid : pids) {
+                    if (contains(handle_resource_pair.second->pids, pid)) {
+                        resources_handles.emplace_back(handle_resource_pair.first);
+                    }
                 }
             }
         }
@@ -174,14 +185,27 @@ public:
     }
 
 private:
+    static const size_t SHARDS_COUNT = 16;
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<uint32_t, std::shared_ptr<Resource<T>>> resources;
+        std::unordered_map<uint32_t, std::shared_timed_mutex> resources_mutexes;
+    };
+
     ServiceResourceManager()
         : m_current_handle_index(0)
     {}
 
-    Expected<std::shared_ptr<Resource<T>>> resource_lookup(uint32_t handle)
+    Shard &shard_of(uint32_t handle)
+    {
+        return m_shards[handle % SHARDS_COUNT];
+    }
+
+    Expected<std::shared_ptr<Resource<T>>> resource_lookup(Shard &shard, uint32_t handle)
     {
-        auto found = m_resources.find(handle);
-        CHECK_AS_EXPECTED(found != m_resources.end(), HAILO_NOT_FOUND, "Failed to find resource with handle {}", handle);
+        auto found = shard.resources.find(handle);
+        CHECK_AS_EXPECTED(found != shard.resources.end(), HAILO_NOT_FOUND, "Failed to find resource with handle {}", handle);
         auto resource = found->second;
         return resource;
     }
@@ -196,10 +220,8 @@ private:
         return true;
     }
 
-    std::mutex m_mutex;
     std::atomic<uint32_t> m_current_handle_index;
-    std::unordered_map<uint32_t, std::shared_ptr<Resource<T>>> m_resources;
-    std::unordered_map<uint32_t, std::shared_timed_mutex> m_resources_mutexes;
+    std::array<Shard, SHARDS_COUNT> m_shards;
 };
 
 }
@@ -24,6 +24,13 @@ namespace hailort
 
 #define MAX_QUEUE_SIZE (512) // Max inner reader-writer queue size
 
+// TODO: extend the epoll I/O engine adoption (epoll_io_engine.hpp) to this queue's consumers:
+//       The engine already drives the output vstream readiness fds (the service's frame
+//       prefetch, HAILO_SERVICE_PREFETCH_FRAMES=1) - one loop thread waits on every registered
+//       vstream and pulls ready frames ahead of the client's read request. The callback
+//       listeners that meet at this queue still block a thread each; moving them onto the
+//       engine needs an fd-backed doorbell on the queue (eventfd bumped on enqueue), which is
+//       the remaining piece this note tracks.
 class VDeviceCallbacksQueue final
 {
 public:
@@ -15,6 +15,15 @@
 #include <iostream>
 #include <iomanip>
 
+// TODO: vectored download path (HRT wishlist):
+//       Action-list (and firmware log) downloads currently pull data through many small control
+//       reads, each a firmware mailbox round-trip - multi-second downloads on big multi-context
+//       HEFs. The intended bulk mode: a control asks the firmware to stage the requested region
+//       into a host-DMA-able staging buffer, and the host reads it with a single vDMA transfer
+//       (the boundary-channel machinery already handles arbitrary-size D2H reads). Needs the
+//       firmware staging control; the host side then replaces the per-chunk read loop below with
+//       one transfer + parse.
+
 #define MHz (1000 * 1000)
 // div factor is valid only for Hailo8-B0 platform. 
 // TODO - HRT-7364 - add CPU subsystem frequency into the device extended info control
@@ -138,7 +147,7 @@ Expected<ordered_json> DownloadActionListCommand::parse_hef_metadata(const std::
 bool DownloadActionListCommand::is_valid_hef(const std::string &hef_file_path)
 {
     // Open hef, to check that it's valid
-    const auto hef = Hef::create(hef_file_path);
+    const auto hef = Hef::create_mmap(hef_file_path);
     return hef.has_value();
 }
 
@@ -21,6 +21,7 @@
 #include "fw_logger_command.hpp"
 #include "benchmark_command.hpp"
 #include "mon_command.hpp"
+#include "sched_simulate_command.hpp"
 #if defined(__GNUC__)
 #include "udp_rate_limiter_command.hpp"
 #endif
@@ -199,6 +200,7 @@ public:
         add_subcommand<FwUpdateCommand>();
         add_subcommand<SSBUpdateCommand>();
         add_subcommand<MonCommand>();
+        add_subcommand<SchedCommand>();
 #if defined(__GNUC__)
         add_subcommand<UdpRateLimiterCommand>();
         add_subcommand<HwInferEstimatorCommand>();
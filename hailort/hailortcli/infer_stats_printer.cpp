@@ -114,7 +114,7 @@ void InferStatsPrinter::print(const std::vector<std::string> &network_groups_nam
     }
     if (m_pipeline_stats_csv_file.is_open() && (inference_result)) {
         std::cout << "> Writing pipeline statistics to '" << m_pipeline_stats_csv_path << "'... ";
-        m_pipeline_stats_csv_file << "net_name,vstream_name,param_type,element,mean,min,max,var,sd,mean_sd,index" << std::endl;
+        m_pipeline_stats_csv_file << "net_name,vstream_name,param_type,element,mean,min,max,var,sd,mean_sd,p50,p90,p99,p99.9,index" << std::endl;
         for (auto &network_group_results : inference_result->network_group_results()) {
             print_pipeline_elem_stats_csv(network_group_results.network_group_name(), network_group_results.m_fps_accumulators);
             print_pipeline_elem_stats_csv(network_group_results.network_group_name(), network_group_results.m_latency_accumulators);
@@ -385,6 +385,57 @@ void InferStatsPrinter::print_stdout_single_element(const T &results, size_t fra
         std::cout << "    Overall Latency: " << InferResultsFormatUtils::latency_result_to_ms(overall_latency.value()) << " ms" << std::endl;
     }
 
+    // Latency distribution percentiles - available when the pipeline latency accumulators track
+    // the full distribution (histogram accumulators)
+    for (const auto &name_accumulator_pair : results.m_pipeline_latency_accumulators) {
+        if (nullptr == name_accumulator_pair.second) {
+            continue;
+        }
+        auto p50 = name_accumulator_pair.second->get_percentile(50.0);
+        if (!p50) {
+            continue; // Summary-only accumulator
+        }
+        auto p90 = name_accumulator_pair.second->get_percentile(90.0);
+        auto p99 = name_accumulator_pair.second->get_percentile(99.0);
+        auto p999 = name_accumulator_pair.second->get_percentile(99.9);
+        std::cout << "    Latency percentiles (" << name_accumulator_pair.first << "): p50 "
+            << InferResultsFormatUtils::format_statistic(p50) << " ms, p90 "
+            << InferResultsFormatUtils::format_statistic(p90) << " ms, p99 "
+            << InferResultsFormatUtils::format_statistic(p99) << " ms, p99.9 "
+            << InferResultsFormatUtils::format_statistic(p999) << " ms" << std::endl;
+    }
+
+    // Time attribution - fraction of per-frame time spent in each pipeline element, from the
+    // element latency accumulators (collected with pipeline element stats enabled)
+    for (const auto &vstream_elements_pair : results.m_latency_accumulators) {
+        double total_mean = 0;
+        for (const auto &element_accumulator_pair : vstream_elements_pair.second) {
+            if (nullptr == element_accumulator_pair.second) {
+                continue;
+            }
+            auto mean = element_accumulator_pair.second->get().mean();
+            if (mean) {
+                total_mean += mean.value();
+            }
+        }
+        if (total_mean <= 0) {
+            continue;
+        }
+        std::cout << "    Time attribution (" << vstream_elements_pair.first << "):" << std::endl;
+        for (const auto &element_accumulator_pair : vstream_elements_pair.second) {
+            if (nullptr == element_accumulator_pair.second) {
+                continue;
+            }
+            auto mean = element_accumulator_pair.second->get().mean();
+            if (!mean) {
+                continue;
+            }
+            const auto share = (mean.value() / total_mean) * 100.0;
+            std::cout << "      " << element_accumulator_pair.first << ": "
+                << InferResultsFormatUtils::format_statistic(Expected<double>(share)) << "% ("
+                << InferResultsFormatUtils::format_statistic(mean) << " ms)" << std::endl;
+        }
+    }
 }
 
 void InferStatsPrinter::print_stdout(Expected<InferResult> &inference_result)
@@ -495,6 +546,10 @@ void InferStatsPrinter::write_accumulator_results(std::ofstream &output_stream,
     output_stream << InferResultsFormatUtils::format_statistic(accumulator_result.var()) << ",";
     output_stream << InferResultsFormatUtils::format_statistic(accumulator_result.sd()) << ",";
     output_stream << InferResultsFormatUtils::format_statistic(accumulator_result.mean_sd()) << ",";
+    output_stream << InferResultsFormatUtils::format_statistic(accumulator->get_percentile(50.0)) << ",";
+    output_stream << InferResultsFormatUtils::format_statistic(accumulator->get_percentile(90.0)) << ",";
+    output_stream << InferResultsFormatUtils::format_statistic(accumulator->get_percentile(99.0)) << ",";
+    output_stream << InferResultsFormatUtils::format_statistic(accumulator->get_percentile(99.9)) << ",";
     if (NO_INDEX != index) {
         output_stream << index;
     }
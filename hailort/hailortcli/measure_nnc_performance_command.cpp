@@ -74,7 +74,7 @@ hailo_status HwInferEstimatorCommand::execute()
     CHECK(1 == devices->size(), HAILO_INTERNAL_FAILURE, "Hw infer command support only one physical device");
     auto &device = devices.value()[0];
 
-    auto hef = Hef::create(m_params.hef_path.c_str());
+    auto hef = Hef::create_mmap(m_params.hef_path.c_str());
     CHECK_EXPECTED_AS_STATUS(hef, "Failed reading hef file {}", m_params.hef_path);
 
     auto interface = device->get_default_streams_interface();
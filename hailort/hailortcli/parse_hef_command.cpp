@@ -19,6 +19,9 @@ ParseHefCommand::ParseHefCommand(CLI::App &parent_app) :
         ->required();
     m_app->add_flag("--parse-streams", m_parse_streams, "Parse stream infos")->default_val(false);
     m_app->add_flag("--parse-vstreams", m_parse_vstreams, "Parse vstream infos")->default_val(true);
+    m_app->add_flag("--perf-report", m_perf_report,
+        "Print performance characteristics (context count, config footprint, transfer sizes, estimated FPS)")
+        ->default_val(false);
 }
 
 
@@ -27,6 +30,11 @@ hailo_status ParseHefCommand::execute()
     auto is_dir = Filesystem::is_directory(m_hef_path.c_str());
     CHECK_EXPECTED_AS_STATUS(is_dir, "Failed checking if path is directory");
 
+    if (m_perf_report && !is_dir.value()) {
+        auto status = print_perf_report(m_hef_path);
+        CHECK_SUCCESS(status);
+    }
+
     if (is_dir.value()){
         return ParseHefCommand::parse_hefs_infos_dir(m_hef_path, m_parse_streams, m_parse_vstreams);
     } else {
@@ -34,9 +42,21 @@ hailo_status ParseHefCommand::execute()
     }
 }
 
+hailo_status ParseHefCommand::print_perf_report(const std::string &hef_path)
+{
+    auto hef_exp = Hef::create_mmap(hef_path);
+    CHECK_EXPECTED_AS_STATUS(hef_exp, "Failed to parse HEF");
+    auto hef = hef_exp.release();
+
+    auto perf_report = hef.get_perf_description();
+    CHECK_EXPECTED_AS_STATUS(perf_report, "Failed building performance report");
+    std::cout << perf_report.release();
+    return HAILO_SUCCESS;
+}
+
 hailo_status ParseHefCommand::parse_hefs_info(const std::string &hef_path, bool stream_infos, bool vstream_infos)
 {
-    auto hef_exp = Hef::create(hef_path);
+    auto hef_exp = Hef::create_mmap(hef_path);
     CHECK_EXPECTED_AS_STATUS(hef_exp, "Failed to parse HEF");
     auto hef = hef_exp.release();
 
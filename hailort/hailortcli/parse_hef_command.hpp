@@ -28,10 +28,12 @@ public:
 private:
     static hailo_status parse_hefs_infos_dir(const std::string &hef_path, bool stream_infos, bool vstream_infos);
     static hailo_status parse_hefs_info(const std::string &hef_path, bool stream_infos, bool vstream_infos);
+    static hailo_status print_perf_report(const std::string &hef_path);
 
     std::string m_hef_path;
     bool m_parse_streams;
     bool m_parse_vstreams;
+    bool m_perf_report = false;
 };
 
 #endif /* _HAILO_PARSE_COMMAND_COMMAND_HPP_ */
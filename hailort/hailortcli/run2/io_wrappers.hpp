@@ -15,9 +15,17 @@
 
 #include "common/file_utils.hpp"
 #include "common/latency_meter.hpp"
+#include "stream_common/file_frame_source.hpp"
+#include "stream_common/file_frame_sink.hpp"
+#include "hailo/buffer_storage.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <deque>
 #include <string>
+#include <random>
+#include <cstring>
+#include <cstdlib>
 
 using namespace hailort;
 
@@ -132,11 +140,21 @@ private:
     template<typename WriterParams>
     static Expected<std::vector<BufferPtr>> create_dataset(Writer &writer, const WriterParams &params)
     {
-        if (params.input_file_path.empty()) {
-            return create_constant_dataset(writer.get_frame_size());
-        } else {
+        if (!params.input_file_path.empty()) {
             return create_dataset_from_input_file(params.input_file_path, writer.get_frame_size());
         }
+        // Synthetic generators (HAILO_RUN2_INPUT_GENERATOR): "random" cycles frames of uniform
+        // noise, "gradient" cycles shifted ramps - both exercise the post-process paths (noise
+        // crosses detection thresholds, so NMS actually suppresses) where the constant frame
+        // reports misleadingly fast numbers. Default stays the constant frame.
+        const auto *generator = std::getenv("HAILO_RUN2_INPUT_GENERATOR");
+        if ((nullptr != generator) && (0 == strcmp(generator, "random"))) {
+            return create_random_dataset(writer.get_frame_size());
+        }
+        if ((nullptr != generator) && (0 == strcmp(generator, "gradient"))) {
+            return create_gradient_dataset(writer.get_frame_size());
+        }
+        return create_constant_dataset(writer.get_frame_size());
     }
 
     static Expected<std::vector<BufferPtr>> create_constant_dataset(size_t frame_size)
@@ -148,8 +166,74 @@ private:
         return std::vector<BufferPtr>{constant_buffer.release()};
     }
 
+    static Expected<std::vector<BufferPtr>> create_random_dataset(size_t frame_size)
+    {
+        static const size_t RANDOM_FRAMES_COUNT = 8;
+        std::mt19937 rng(0x5EED);
+        std::vector<BufferPtr> dataset;
+        dataset.reserve(RANDOM_FRAMES_COUNT);
+        for (size_t frame = 0; frame < RANDOM_FRAMES_COUNT; frame++) {
+            auto buffer = Buffer::create_shared(frame_size, BufferStorageParams::create_dma());
+            CHECK_EXPECTED(buffer);
+            for (size_t i = 0; i < frame_size; i++) {
+                buffer.value()->data()[i] = static_cast<uint8_t>(rng());
+            }
+            dataset.emplace_back(buffer.release());
+        }
+        return dataset;
+    }
+
+    static Expected<std::vector<BufferPtr>> create_gradient_dataset(size_t frame_size)
+    {
+        static const size_t GRADIENT_FRAMES_COUNT = 8;
+        std::vector<BufferPtr> dataset;
+        dataset.reserve(GRADIENT_FRAMES_COUNT);
+        for (size_t frame = 0; frame < GRADIENT_FRAMES_COUNT; frame++) {
+            auto buffer = Buffer::create_shared(frame_size, BufferStorageParams::create_dma());
+            CHECK_EXPECTED(buffer);
+            for (size_t i = 0; i < frame_size; i++) {
+                buffer.value()->data()[i] = static_cast<uint8_t>((i + (frame * 32)) & 0xFF);
+            }
+            dataset.emplace_back(buffer.release());
+        }
+        return dataset;
+    }
+
     static Expected<std::vector<BufferPtr>> create_dataset_from_input_file(const std::string &file_path, size_t frame_size)
     {
+#if defined(__linux__)
+        // Zero-copy path: the file is mmapped (with sequential readahead) and every frame's pages
+        // are wrapped as a DMA-able buffer - the dataset streams straight from the page cache
+        // without a read() copy. The mapping is kept alive by the dataset buffers themselves.
+        auto source = FileFrameSource::create(file_path, frame_size);
+        if (source) {
+            CHECK_AS_EXPECTED(0 == (source->file_size() % frame_size), HAILO_INVALID_ARGUMENT,
+                "Input file ({}) size {} must be a multiple of the frame size {}",
+                file_path, source->file_size(), frame_size);
+
+            struct MappedDataset {
+                FileFrameSource source;
+                std::deque<Buffer> frames;
+                explicit MappedDataset(FileFrameSource &&mapped_source) : source(std::move(mapped_source)) {}
+            };
+            auto holder = make_shared_nothrow<MappedDataset>(source.release());
+            CHECK_NOT_NULL_AS_EXPECTED(holder, HAILO_OUT_OF_HOST_MEMORY);
+
+            std::vector<BufferPtr> dataset;
+            dataset.reserve(holder->source.frames_count());
+            for (size_t i = 0; i < holder->source.frames_count(); i++) {
+                auto frame_view = holder->source.frame(i);
+                auto storage = DmaStorage::create_from_user_address(frame_view.data(), frame_view.size());
+                CHECK_EXPECTED(storage);
+                holder->frames.emplace_back(Buffer(storage.release()));
+                // Aliasing - each dataset entry keeps the whole mapping alive
+                dataset.emplace_back(BufferPtr(holder, &holder->frames.back()));
+            }
+            return dataset;
+        }
+        // mmap failed - fall through to the copying path
+#endif
+
         auto buffer = read_binary_file(file_path);
         CHECK_EXPECTED(buffer);
         CHECK_AS_EXPECTED(0 == (buffer->size() % frame_size), HAILO_INVALID_ARGUMENT,
@@ -198,6 +282,23 @@ public:
             new (std::nothrow) ReaderWrapper(reader, buffer.release(), overall_latency_meter, net_live_track));
         CHECK_NOT_NULL_AS_EXPECTED(wrapper, HAILO_OUT_OF_HOST_MEMORY);
 
+        // Raw output writeback (HAILO_RUN2_OUTPUT_DIR): every received frame goes to
+        // <dir>/<output name>.bin through the double-buffered O_DIRECT sink - the disk write of
+        // frame N overlaps the device transfer of frame N+1 and skips the page cache
+        const auto *output_dir = std::getenv("HAILO_RUN2_OUTPUT_DIR");
+        if (nullptr != output_dir) {
+            auto file_name = reader.name();
+            std::replace(file_name.begin(), file_name.end(), '/', '_');
+            auto sink = FileFrameSink::create(std::string(output_dir) + "/" + file_name + ".bin",
+                reader.get_frame_size());
+            if (sink) {
+                wrapper->m_file_sink = make_shared_nothrow<FileFrameSink>(sink.release());
+            } else {
+                LOGGER__WARNING("Failed creating output sink for {} (status {}) - writeback disabled",
+                    reader.name(), sink.status());
+            }
+        }
+
         return wrapper;
     }
 
@@ -247,6 +348,14 @@ private:
             m_overall_latency_meter->add_end_sample(get().name(), std::chrono::steady_clock::now().time_since_epoch());
         }
 
+        if (m_file_sink) {
+            // Stage into the sink's page-aligned slot; push() only blocks when the disk falls a
+            // full slot behind the device
+            auto slot = m_file_sink->next_slot();
+            memcpy(slot.data(), m_buffer->data(), std::min(slot.size(), m_buffer->size()));
+            (void)m_file_sink->push();
+        }
+
         if (m_net_live_track) {
             m_net_live_track->progress();
         }
@@ -256,6 +365,7 @@ private:
     BufferPtr m_buffer;
     LatencyMeterPtr m_overall_latency_meter;
     std::shared_ptr<NetworkLiveTrack> m_net_live_track;
+    std::shared_ptr<FileFrameSink> m_file_sink;
 };
 
 template<typename Reader>
@@ -220,7 +220,7 @@ Expected<std::shared_ptr<NetworkRunner>> NetworkRunner::create_shared(VDevice &v
         CHECK_EXPECTED(runner_exp);
         net_runner_ptr = runner_exp.release();
     } else {
-        auto hef = Hef::create(final_net_params.hef_path);
+        auto hef = Hef::create_mmap(final_net_params.hef_path);
         CHECK_EXPECTED(hef);
 
         auto expected_net_group_name = get_network_group_name(final_net_params, hef.value());
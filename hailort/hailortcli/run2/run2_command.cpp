@@ -24,6 +24,11 @@
 #include <vector>
 #include <regex>
 
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using namespace hailort;
 
 constexpr uint32_t DEFAULT_TIME_TO_RUN_SECONDS = 5;
@@ -57,7 +62,7 @@ VStreamNameValidator::VStreamNameValidator(const CLI::Option *hef_path_option, c
 
 std::vector<std::string> VStreamNameValidator::get_values(const std::string &hef_path, const std::string &net_group_name)
 {
-    auto hef = Hef::create(hef_path);
+    auto hef = Hef::create_mmap(hef_path);
     if (!hef.has_value()) {
         return {};
     }
@@ -104,7 +109,7 @@ StreamNameValidator::StreamNameValidator(const CLI::Option *hef_path_option, con
 
 std::vector<std::string> StreamNameValidator::get_values(const std::string &hef_path, const std::string &net_group_name)
 {
-    auto hef = Hef::create(hef_path);
+    auto hef = Hef::create_mmap(hef_path);
     if (!hef.has_value()) {
         return {};
     }
@@ -250,7 +255,7 @@ NetworkGroupNameValidator::NetworkGroupNameValidator(const CLI::Option *hef_path
         return std::string();
     };
     autocomplete_func_ = [hef_path_option](const std::string&) -> std::vector<std::string>{
-        auto hef = Hef::create(hef_path_option->as<std::string>());
+        auto hef = Hef::create_mmap(hef_path_option->as<std::string>());
         if (!hef.has_value()) {
             return {};
         }
@@ -309,6 +314,7 @@ public:
     bool get_measure_hw_latency();
     bool get_measure_overall_latency();
     bool get_multi_process_service();
+    uint32_t get_processes_count() const { return m_processes_count; }
     bool get_measure_fw_actions();
     std::string get_measure_fw_actions_output_path();
     const std::string &get_group_id();
@@ -332,6 +338,7 @@ private:
     std::string m_stats_json_path;
     std::vector<std::string> m_device_ids;
     uint32_t m_device_count;
+    uint32_t m_processes_count = 1;
     bool m_multi_process_service;
     std::string m_group_id;
 
@@ -389,6 +396,11 @@ Run2::Run2() : CLI::App("Run networks", "run2")
 
     auto measurement_options_group = add_option_group("Measurement Options");
 
+    add_option("--processes", m_processes_count,
+        "Fork this many worker processes, each running the full model mix against the shared scheduler "
+        "(requires --multi-process-service). Used to qualify scheduler fairness under multi-process load.")
+        ->default_val(1);
+
     auto measure_power_opt = measurement_options_group->add_flag("--measure-power", m_measure_power, "Measure power consumption")
         ->default_val(false);
 
@@ -772,6 +784,39 @@ hailo_status Run2Command::execute()
 
     CHECK(0 < app->get_network_params().size(), HAILO_INVALID_OPERATION, "Nothing to run");
 
+#if defined(__linux__)
+    // Multi-process load generation - fork N workers each running the full model mix against the
+    // shared scheduler; the parent only collects exit statuses. Each worker prints its own stats,
+    // so per-process FPS exposes scheduler fairness directly.
+    if (app->get_processes_count() > 1) {
+        CHECK(app->get_multi_process_service(), HAILO_INVALID_OPERATION,
+            "--processes requires --multi-process-service (a shared scheduler across the workers)");
+        std::vector<pid_t> workers;
+        for (uint32_t process_index = 0; process_index < app->get_processes_count(); process_index++) {
+            const auto worker_pid = fork();
+            CHECK(worker_pid >= 0, HAILO_INTERNAL_FAILURE, "Failed forking load worker (errno {})", errno);
+            if (0 == worker_pid) {
+                // Children fall through to the regular single-process flow below
+                workers.clear();
+                break;
+            }
+            workers.emplace_back(worker_pid);
+        }
+        if (!workers.empty()) {
+            auto aggregated_status = HAILO_SUCCESS;
+            for (const auto worker_pid : workers) {
+                int wait_status = 0;
+                (void)waitpid(worker_pid, &wait_status, 0);
+                if (!WIFEXITED(wait_status) || (0 != WEXITSTATUS(wait_status))) {
+                    LOGGER__ERROR("Load worker {} failed", worker_pid);
+                    aggregated_status = HAILO_INTERNAL_FAILURE;
+                }
+            }
+            return aggregated_status;
+        }
+    }
+#endif /* defined(__linux__) */
+
     if (app->get_measure_hw_latency() || app->get_measure_overall_latency()) {
         CHECK(1 == app->get_network_params().size(), HAILO_INVALID_OPERATION, "When latency measurement is enabled, only one model is allowed");
         LOGGER__WARNING("Measuring latency; frames are sent one at a time and FPS will not be measured");
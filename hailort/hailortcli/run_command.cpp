@@ -1175,7 +1175,7 @@ Expected<InferResult> run_command_hef_single_device(const inference_runner_param
     CHECK_AS_EXPECTED(1 == devices->size(), HAILO_INTERNAL_FAILURE);
     auto &device = devices.value()[0];
 
-    auto hef = Hef::create(params.hef_path.c_str());
+    auto hef = Hef::create_mmap(params.hef_path.c_str());
     CHECK_EXPECTED(hef, "Failed reading hef file {}", params.hef_path);
 
     auto interface = device->get_default_streams_interface();
@@ -1311,7 +1311,7 @@ Expected<InferResult> activate_and_run_vdevice(
 
 Expected<InferResult> run_command_hef_vdevice(const inference_runner_params &params)
 {
-    auto hef = Hef::create(params.hef_path.c_str());
+    auto hef = Hef::create_mmap(params.hef_path.c_str());
     CHECK_EXPECTED(hef, "Failed reading hef file {}", params.hef_path);
 
     auto network_groups_infos = hef->get_network_groups_infos();
@@ -1436,7 +1436,7 @@ static hailo_status run_command_hefs_dir(const inference_runner_params &params,
             contains_hef = true;
             curr_params.hef_path = full_path;
             std::cout << std::string(80, '*') << std::endl << "Inferring " << full_path << ":"<< std::endl;
-            auto hef = Hef::create(full_path);
+            auto hef = Hef::create_mmap(full_path);
             CHECK_EXPECTED_AS_STATUS(hef);
             auto network_groups_names = hef->get_network_groups_names();
             auto infer_stats = run_command_hef(curr_params);
@@ -1471,7 +1471,7 @@ hailo_status run_command(const inference_runner_params &params)
         return run_command_hefs_dir(params, printer.value());
     } else {
         auto infer_stats = run_command_hef(params);
-        auto hef = Hef::create(params.hef_path.c_str());
+        auto hef = Hef::create_mmap(params.hef_path.c_str());
         CHECK_EXPECTED_AS_STATUS(hef);
         auto network_groups_names = hef->get_network_groups_names();
         printer->print(network_groups_names, infer_stats);
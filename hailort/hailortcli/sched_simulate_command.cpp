@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file sched_simulate_command.cpp
+ * @brief Offline scheduler what-if simulation over a captured profiler trace.
+ *
+ * The profiler trace (scheduler_profiler.json, written when SCHEDULER_PROFILER_LOGGER_PATH is
+ * set) records every frame arrival (FrameEnqueueH2D), completion (FrameEnqueueD2H) and core-op
+ * switch with timestamps. That is enough to replay the workload against a virtual clock:
+ * arrivals re-play exactly as captured, per-core-op service times come from the measured
+ * completion gaps, and the scheduling decisions are re-taken with the requested parameters
+ * (priorities, batch thresholds, switch cost). The report compares predicted per-model
+ * throughput/latency and device utilization between parameter sets - no device needed.
+ **/
+
+#include "sched_simulate_command.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <sstream>
+
+namespace hailort
+{
+
+SchedCommand::SchedCommand(CLI::App &parent_app) :
+    ContainerCommand(parent_app.add_subcommand("sched", "Scheduler offline tools"))
+{
+    add_subcommand<SchedSimulateCommand>();
+}
+
+SchedSimulateCommand::SchedSimulateCommand(CLI::App &parent_app) :
+    Command(parent_app.add_subcommand("simulate",
+        "Replay a scheduler profiler trace against alternative scheduler parameters"))
+{
+    m_app->add_option("trace", m_trace_path, "scheduler_profiler.json trace file path")
+        ->check(CLI::ExistingFile)
+        ->required();
+    m_app->add_option("--priority", m_priority_overrides,
+        "Core-op priority override, <core_op_handle>=<priority> (higher runs first)");
+    m_app->add_option("--threshold", m_threshold_overrides,
+        "Core-op batch threshold override, <core_op_handle>=<frames>");
+    m_app->add_option("--switch-cost-us", m_switch_cost_us, "Core-op switch cost in microseconds")
+        ->default_val(1000);
+}
+
+// The trace is a stream of small JSON objects - pull a quoted/numeric field out of one object
+static bool extract_field(const std::string &object, const std::string &field, std::string &value)
+{
+    const auto key_pos = object.find("\"" + field + "\"");
+    if (std::string::npos == key_pos) {
+        return false;
+    }
+    auto value_pos = object.find(':', key_pos);
+    if (std::string::npos == value_pos) {
+        return false;
+    }
+    value_pos++;
+    while ((value_pos < object.size()) && ((' ' == object[value_pos]) || ('"' == object[value_pos]))) {
+        value_pos++;
+    }
+    auto value_end = object.find_first_of(",}\"", value_pos);
+    if (std::string::npos == value_end) {
+        value_end = object.size();
+    }
+    value = object.substr(value_pos, value_end - value_pos);
+    return true;
+}
+
+hailo_status SchedSimulateCommand::parse_trace(const std::string &trace_path,
+    std::map<uint32_t, CoreOpTrace> &core_ops, uint64_t &measured_switches_count)
+{
+    std::ifstream trace_file(trace_path);
+    CHECK(trace_file.good(), HAILO_OPEN_FILE_FAILURE, "Failed opening trace file {}", trace_path);
+
+    std::stringstream whole_file;
+    whole_file << trace_file.rdbuf();
+    const auto content = whole_file.str();
+
+    measured_switches_count = 0;
+    size_t object_start = content.find('{');
+    while (std::string::npos != object_start) {
+        const auto object_end = content.find('}', object_start);
+        if (std::string::npos == object_end) {
+            break;
+        }
+        const auto object = content.substr(object_start, object_end - object_start + 1);
+        object_start = content.find('{', object_end);
+
+        std::string action, timestamp_str, handle_str;
+        if (!extract_field(object, "action", action)) {
+            continue;
+        }
+        (void)extract_field(object, "timestamp", timestamp_str);
+        if (!extract_field(object, "core_op_handle", handle_str)) {
+            continue;
+        }
+        const auto handle = static_cast<uint32_t>(strtoul(handle_str.c_str(), nullptr, 10));
+        const auto timestamp = strtoull(timestamp_str.c_str(), nullptr, 10);
+
+        if ("write_frame" == action) {
+            // FrameEnqueueH2D - a frame arrived for this core op
+            core_ops[handle].arrivals_ns.emplace_back(timestamp);
+        } else if ("output_vdma_enqueue" == action) {
+            // FrameEnqueueD2H - the device finished a frame for this core op
+            core_ops[handle].completions_ns.emplace_back(timestamp);
+        } else if ("switch_core_op" == action) {
+            measured_switches_count++;
+        } else if ("add_core_op" == action) {
+            std::string name, threshold_str;
+            if (extract_field(object, "core_op_name", name)) {
+                core_ops[handle].name = name;
+            }
+            if (extract_field(object, "threshold", threshold_str)) {
+                core_ops[handle].threshold = std::max<uint64_t>(1, strtoull(threshold_str.c_str(), nullptr, 10));
+            }
+        }
+    }
+
+    CHECK(!core_ops.empty(), HAILO_INVALID_ARGUMENT,
+        "Trace contains no scheduler events (was SCHEDULER_PROFILER_LOGGER_PATH set during the run?)");
+    return HAILO_SUCCESS;
+}
+
+// Median measured on-device time per frame - gaps between consecutive completions while the
+// core op was streaming (the lower half of the gap distribution excludes cross-switch gaps)
+static uint64_t estimate_service_time_ns(const std::vector<uint64_t> &completions_ns)
+{
+    if (completions_ns.size() < 2) {
+        return 1000 * 1000; // 1ms default when the trace has too little to estimate from
+    }
+    std::vector<uint64_t> gaps;
+    gaps.reserve(completions_ns.size() - 1);
+    for (size_t i = 1; i < completions_ns.size(); i++) {
+        gaps.emplace_back(completions_ns[i] - completions_ns[i - 1]);
+    }
+    std::sort(gaps.begin(), gaps.end());
+    return std::max<uint64_t>(1, gaps[gaps.size() / 2]);
+}
+
+std::map<uint32_t, SchedSimulateCommand::SimulationResult> SchedSimulateCommand::simulate(
+    const std::map<uint32_t, CoreOpTrace> &core_ops, const std::map<uint32_t, uint32_t> &priorities,
+    const std::map<uint32_t, uint64_t> &thresholds, uint64_t switch_cost_us)
+{
+    struct CoreOpState {
+        const CoreOpTrace *trace;
+        uint64_t service_time_ns;
+        uint64_t threshold;
+        uint32_t priority;
+        size_t next_arrival = 0;
+        std::queue<uint64_t> pending_arrivals_ns;
+        std::vector<uint64_t> latencies_ns;
+        uint64_t completed = 0;
+    };
+
+    std::map<uint32_t, CoreOpState> states;
+    uint64_t trace_end_ns = 0;
+    for (const auto &handle_trace_pair : core_ops) {
+        CoreOpState state{};
+        state.trace = &handle_trace_pair.second;
+        state.service_time_ns = estimate_service_time_ns(handle_trace_pair.second.completions_ns);
+        auto threshold_it = thresholds.find(handle_trace_pair.first);
+        state.threshold = (thresholds.end() != threshold_it) ? std::max<uint64_t>(1, threshold_it->second) :
+            handle_trace_pair.second.threshold;
+        auto priority_it = priorities.find(handle_trace_pair.first);
+        state.priority = (priorities.end() != priority_it) ? priority_it->second : 16; // HAILO_SCHEDULER_PRIORITY_NORMAL
+        states.emplace(handle_trace_pair.first, std::move(state));
+        if (!handle_trace_pair.second.arrivals_ns.empty()) {
+            trace_end_ns = std::max(trace_end_ns, handle_trace_pair.second.arrivals_ns.back());
+        }
+    }
+
+    const uint64_t switch_cost_ns = switch_cost_us * 1000;
+    uint64_t now_ns = 0;
+    uint64_t busy_ns = 0;
+    uint64_t switches_count = 0;
+    uint32_t active_handle = UINT32_MAX;
+
+    while (true) {
+        // Deliver arrivals up to the virtual clock
+        bool any_arrival_left = false;
+        for (auto &handle_state_pair : states) {
+            auto &state = handle_state_pair.second;
+            const auto &arrivals = state.trace->arrivals_ns;
+            while ((state.next_arrival < arrivals.size()) && (arrivals[state.next_arrival] <= now_ns)) {
+                state.pending_arrivals_ns.push(arrivals[state.next_arrival]);
+                state.next_arrival++;
+            }
+            any_arrival_left = any_arrival_left || (state.next_arrival < arrivals.size());
+        }
+
+        // Pick the runnable core op: highest priority first, most pending frames as tie break -
+        // a core op is runnable once its pending depth reached its batch threshold (or no more
+        // arrivals will ever come for it)
+        uint32_t chosen_handle = UINT32_MAX;
+        for (auto &handle_state_pair : states) {
+            auto &state = handle_state_pair.second;
+            const bool drained = (state.next_arrival >= state.trace->arrivals_ns.size());
+            const bool runnable = !state.pending_arrivals_ns.empty() &&
+                ((state.pending_arrivals_ns.size() >= state.threshold) || drained);
+            if (!runnable) {
+                continue;
+            }
+            if ((UINT32_MAX == chosen_handle) ||
+                (state.priority > states.at(chosen_handle).priority) ||
+                ((state.priority == states.at(chosen_handle).priority) &&
+                 (state.pending_arrivals_ns.size() > states.at(chosen_handle).pending_arrivals_ns.size()))) {
+                chosen_handle = handle_state_pair.first;
+            }
+        }
+
+        if (UINT32_MAX == chosen_handle) {
+            if (!any_arrival_left) {
+                break; // Everything delivered and drained
+            }
+            // Idle - jump the clock to the next arrival
+            uint64_t next_arrival_ns = UINT64_MAX;
+            for (const auto &handle_state_pair : states) {
+                const auto &state = handle_state_pair.second;
+                if (state.next_arrival < state.trace->arrivals_ns.size()) {
+                    next_arrival_ns = std::min(next_arrival_ns, state.trace->arrivals_ns[state.next_arrival]);
+                }
+            }
+            now_ns = next_arrival_ns;
+            continue;
+        }
+
+        auto &chosen = states.at(chosen_handle);
+        if (active_handle != chosen_handle) {
+            now_ns += switch_cost_ns;
+            busy_ns += switch_cost_ns;
+            switches_count++;
+            active_handle = chosen_handle;
+        }
+
+        // Run the whole pending burst (the scheduler's batch) to completion
+        while (!chosen.pending_arrivals_ns.empty()) {
+            const auto arrival_ns = chosen.pending_arrivals_ns.front();
+            chosen.pending_arrivals_ns.pop();
+            now_ns = std::max(now_ns, arrival_ns) + chosen.service_time_ns;
+            busy_ns += chosen.service_time_ns;
+            chosen.latencies_ns.emplace_back(now_ns - arrival_ns);
+            chosen.completed++;
+        }
+    }
+
+    std::map<uint32_t, SimulationResult> results;
+    for (auto &handle_state_pair : states) {
+        auto &state = handle_state_pair.second;
+        SimulationResult result{};
+        result.switches_count = switches_count;
+        result.utilization = (now_ns > 0) ? (static_cast<double>(busy_ns) / static_cast<double>(now_ns)) : 0.0;
+        if (!state.latencies_ns.empty()) {
+            const auto total_time_sec = static_cast<double>(now_ns) / 1e9;
+            result.fps = (total_time_sec > 0) ? (static_cast<double>(state.completed) / total_time_sec) : 0.0;
+            double latency_sum = 0;
+            for (const auto latency : state.latencies_ns) {
+                latency_sum += static_cast<double>(latency);
+            }
+            result.average_latency_ms = (latency_sum / static_cast<double>(state.latencies_ns.size())) / 1e6;
+            std::sort(state.latencies_ns.begin(), state.latencies_ns.end());
+            result.p99_latency_ms = static_cast<double>(
+                state.latencies_ns[(state.latencies_ns.size() * 99) / 100]) / 1e6;
+        }
+        results.emplace(handle_state_pair.first, result);
+    }
+    return results;
+}
+
+std::map<uint32_t, uint64_t> SchedSimulateCommand::parse_overrides(const std::vector<std::string> &overrides)
+{
+    std::map<uint32_t, uint64_t> parsed;
+    for (const auto &override_str : overrides) {
+        const auto equals_pos = override_str.find('=');
+        if (std::string::npos == equals_pos) {
+            std::cerr << "Ignoring malformed override (expected <handle>=<value>): " << override_str << std::endl;
+            continue;
+        }
+        const auto handle = static_cast<uint32_t>(strtoul(override_str.c_str(), nullptr, 10));
+        const auto value = strtoull(override_str.c_str() + equals_pos + 1, nullptr, 10);
+        parsed[handle] = value;
+    }
+    return parsed;
+}
+
+void SchedSimulateCommand::print_results(const std::map<uint32_t, CoreOpTrace> &core_ops,
+    const std::map<uint32_t, SimulationResult> &results, const std::string &title)
+{
+    std::cout << title << std::endl;
+    std::cout << std::left << std::setw(8) << "Handle" << std::setw(28) << "Core op" << std::right
+        << std::setw(10) << "FPS" << std::setw(14) << "Avg lat (ms)" << std::setw(14) << "p99 lat (ms)"
+        << std::endl;
+    for (const auto &handle_result_pair : results) {
+        const auto &trace = core_ops.at(handle_result_pair.first);
+        const auto &result = handle_result_pair.second;
+        std::cout << std::left << std::setw(8) << handle_result_pair.first << std::setw(28)
+            << (trace.name.empty() ? "<unknown>" : trace.name) << std::right << std::fixed
+            << std::setprecision(2) << std::setw(10) << result.fps << std::setw(14)
+            << result.average_latency_ms << std::setw(14) << result.p99_latency_ms << std::endl;
+    }
+    if (!results.empty()) {
+        const auto &any_result = results.begin()->second;
+        std::cout << "Core-op switches: " << any_result.switches_count << ", device utilization: "
+            << std::fixed << std::setprecision(1) << (any_result.utilization * 100.0) << "%" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+hailo_status SchedSimulateCommand::execute()
+{
+    std::map<uint32_t, CoreOpTrace> core_ops;
+    uint64_t measured_switches_count = 0;
+    auto status = parse_trace(m_trace_path, core_ops, measured_switches_count);
+    CHECK_SUCCESS(status);
+
+    std::cout << "Parsed trace: " << core_ops.size() << " core ops, " << measured_switches_count
+        << " measured switches" << std::endl << std::endl;
+
+    // Baseline - the trace's own thresholds, uniform priorities
+    auto baseline = simulate(core_ops, {}, {}, m_switch_cost_us);
+    print_results(core_ops, baseline, "Baseline (captured parameters):");
+
+    const auto priority_overrides = parse_overrides(m_priority_overrides);
+    const auto threshold_overrides = parse_overrides(m_threshold_overrides);
+    if (!priority_overrides.empty() || !threshold_overrides.empty()) {
+        std::map<uint32_t, uint32_t> priorities;
+        for (const auto &handle_priority_pair : priority_overrides) {
+            priorities[handle_priority_pair.first] = static_cast<uint32_t>(handle_priority_pair.second);
+        }
+        auto what_if = simulate(core_ops, priorities, threshold_overrides, m_switch_cost_us);
+        print_results(core_ops, what_if, "What-if (overridden parameters):");
+    }
+
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file sched_simulate_command.hpp
+ * @brief Replays a scheduler profiler trace against alternative scheduler parameters and reports
+ *        predicted utilization and latency - offline what-if tuning for multi-model mixes.
+ **/
+
+#ifndef _HAILO_SCHED_SIMULATE_COMMAND_HPP_
+#define _HAILO_SCHED_SIMULATE_COMMAND_HPP_
+
+#include "hailortcli.hpp"
+#include "command.hpp"
+
+#include "CLI/CLI.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace hailort
+{
+
+class SchedSimulateCommand : public Command
+{
+public:
+    explicit SchedSimulateCommand(CLI::App &parent_app);
+
+    virtual hailo_status execute() override;
+
+private:
+    struct CoreOpTrace {
+        std::string name;
+        std::vector<uint64_t> arrivals_ns;    // FrameEnqueueH2D timestamps
+        std::vector<uint64_t> completions_ns; // FrameEnqueueD2H timestamps
+        uint64_t threshold = 1;
+        uint64_t timeout_ms = 0;
+    };
+
+    struct SimulationResult {
+        double fps;
+        double average_latency_ms;
+        double p99_latency_ms;
+        uint64_t switches_count;
+        double utilization;
+    };
+
+    hailo_status parse_trace(const std::string &trace_path, std::map<uint32_t, CoreOpTrace> &core_ops,
+        uint64_t &measured_switches_count);
+    std::map<uint32_t, SimulationResult> simulate(const std::map<uint32_t, CoreOpTrace> &core_ops,
+        const std::map<uint32_t, uint32_t> &priorities, const std::map<uint32_t, uint64_t> &thresholds,
+        uint64_t switch_cost_us);
+    void print_results(const std::map<uint32_t, CoreOpTrace> &core_ops,
+        const std::map<uint32_t, SimulationResult> &results, const std::string &title);
+
+    static std::map<uint32_t, uint64_t> parse_overrides(const std::vector<std::string> &overrides);
+
+protected:
+    std::string m_trace_path;
+    std::vector<std::string> m_priority_overrides;
+    std::vector<std::string> m_threshold_overrides;
+    uint64_t m_switch_cost_us;
+};
+
+class SchedCommand : public ContainerCommand
+{
+public:
+    explicit SchedCommand(CLI::App &parent_app);
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SCHED_SIMULATE_COMMAND_HPP_ */
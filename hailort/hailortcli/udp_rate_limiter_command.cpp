@@ -197,7 +197,7 @@ uint32_t UdpRateLimiterCommand::bit_rate_kbit_sec_to_bytes_sec(uint32_t rate_kbi
 Expected<std::map<std::string, uint32_t>> UdpRateLimiterCommand::calc_rate_from_hef(const std::string &hef_path,
     const std::string &network_group_name, uint32_t fps)
 {
-    auto hef = Hef::create(hef_path.c_str());
+    auto hef = Hef::create_mmap(hef_path.c_str());
     CHECK_EXPECTED(hef, "Failed reading hef file {}", hef_path.c_str());
 
     auto rate_calc = NetworkUdpRateCalculator::create(&(hef.value()), network_group_name);
@@ -44,6 +44,7 @@ enum
     PROP_SCHEDULER_TIMEOUT_MS,
     PROP_SCHEDULER_THRESHOLD,
     PROP_SCHEDULER_PRIORITY,
+    PROP_BATCH_MAX_LATENCY_MS,
     PROP_INPUT_FORMAT_TYPE,
     PROP_OUTPUT_FORMAT_TYPE,
     PROP_NMS_SCORE_THRESHOLD,
@@ -229,6 +230,19 @@ static hailo_status gst_hailonet2_set_scheduler_params(GstHailoNet2 *self, std::
         CHECK_SUCCESS(status, "Setting scheduler priority failed, status = %d", status);
     }
 
+    // Multi-batch aggregation - when a batch size is configured and the user gave a max aggregation
+    // latency, frames are coalesced into device batches of batch-size, waiting at most
+    // batch-max-latency-ms for the batch to fill. Maps to the scheduler's threshold+timeout pair,
+    // so the per-frame async submissions still return immediately and results split back per frame.
+    if ((self->props.m_batch_size.get() > 1) && (self->props.m_batch_max_latency_ms.was_changed()) &&
+        (!self->props.m_scheduler_threshold.was_changed()) && (!self->props.m_scheduler_timeout_ms.was_changed())) {
+        auto status = configured_infer_model->set_scheduler_threshold(self->props.m_batch_size.get());
+        CHECK_SUCCESS(status, "Setting batch aggregation threshold failed, status = %d", status);
+        status = configured_infer_model->set_scheduler_timeout(
+            std::chrono::milliseconds(self->props.m_batch_max_latency_ms.get()));
+        CHECK_SUCCESS(status, "Setting batch aggregation max latency failed, status = %d", status);
+    }
+
     return HAILO_SUCCESS;
 }
 
@@ -526,6 +540,13 @@ static void gst_hailonet2_set_property(GObject *object, guint property_id, const
         }
         self->props.m_scheduler_threshold = g_value_get_uint(value);
         break;
+    case PROP_BATCH_MAX_LATENCY_MS:
+        if (self->is_configured) {
+            g_warning("The network was already configured so changing the batch max latency will not take place!");
+            break;
+        }
+        self->props.m_batch_max_latency_ms = g_value_get_uint(value);
+        break;
     case PROP_SCHEDULER_PRIORITY:
         if (self->is_configured) {
             g_warning("The network was already configured so changing the scheduling priority will not take place!");
@@ -643,6 +664,9 @@ static void gst_hailonet2_get_property(GObject *object, guint property_id, GValu
     case PROP_SCHEDULER_THRESHOLD:
         g_value_set_uint(value, self->props.m_scheduler_threshold.get());
         break;
+    case PROP_BATCH_MAX_LATENCY_MS:
+        g_value_set_uint(value, self->props.m_batch_max_latency_ms.get());
+        break;
     case PROP_SCHEDULER_PRIORITY:
         g_value_set_uint(value, self->props.m_scheduler_priority.get());
         break;
@@ -703,6 +727,11 @@ static void gst_hailonet2_class_init(GstHailoNet2Class *klass)
     g_object_class_install_property(gobject_class, PROP_HEF_PATH,
         g_param_spec_string("hef-path", "HEF Path Location", "Location of the HEF file to read", nullptr,
             (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_BATCH_MAX_LATENCY_MS,
+        g_param_spec_uint("batch-max-latency-ms", "Batch aggregation max latency",
+            "Max time to wait (ms) for batch-size frames to aggregate into one device batch before submitting a partial batch",
+            0, std::numeric_limits<uint32_t>::max(), 0,
+            (GParamFlags)(G_PARAM_CONSTRUCT | G_PARAM_READWRITE)));
     g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
         g_param_spec_uint("batch-size", "Inference Batch", "How many frame to send in one batch",
             MIN_GSTREAMER_BATCH_SIZE, MAX_GSTREAMER_BATCH_SIZE, HAILO_DEFAULT_BATCH_SIZE,
@@ -1212,6 +1241,14 @@ static gboolean gst_hailonet2_handle_sink_query(GstPad * pad, GstObject * parent
     {
         // We implement this to make sure buffers are contiguous in memory
         gst_query_add_allocation_meta(query, GST_VIDEO_META_API_TYPE, NULL);
+        // Propose our DMA-able allocator upstream - decoders/sources that honor the allocation
+        // query then write directly into pre-mapped memory, and the async submission path hands
+        // those buffers to the device without any per-frame copy
+        if (nullptr != self->allocator) {
+            GstAllocationParams allocation_params;
+            gst_allocation_params_init(&allocation_params);
+            gst_query_add_allocation_param(query, GST_ALLOCATOR(self->allocator), &allocation_params);
+        }
         return gst_pad_query_default(pad, parent, query);
     }
     default:
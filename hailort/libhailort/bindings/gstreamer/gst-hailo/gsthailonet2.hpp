@@ -65,7 +65,7 @@ GType gst_hailo_allocator_get_type(void);
 struct HailoNet2Properties final
 {
 public:
-    HailoNet2Properties() : m_hef_path(nullptr), m_batch_size(HAILO_DEFAULT_BATCH_SIZE),
+    HailoNet2Properties() : m_hef_path(nullptr), m_batch_size(HAILO_DEFAULT_BATCH_SIZE), m_batch_max_latency_ms(0),
         m_device_id(nullptr), m_device_count(0), m_vdevice_group_id(nullptr), m_is_active(false), m_pass_through(false),
         m_outputs_min_pool_size(MIN_OUTPUTS_POOL_SIZE), m_outputs_max_pool_size(MAX_OUTPUTS_POOL_SIZE),
         m_scheduling_algorithm(HAILO_SCHEDULING_ALGORITHM_ROUND_ROBIN), m_scheduler_timeout_ms(HAILO_DEFAULT_SCHEDULER_TIMEOUT_MS),
@@ -91,6 +91,7 @@ public:
 
     HailoElemProperty<gchar*> m_hef_path;
     HailoElemProperty<guint16> m_batch_size;
+    HailoElemProperty<guint32> m_batch_max_latency_ms;
     HailoElemProperty<gchar*> m_device_id;
     HailoElemProperty<guint16> m_device_count;
     HailoElemProperty<gchar*> m_vdevice_group_id;
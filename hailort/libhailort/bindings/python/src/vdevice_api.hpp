@@ -122,6 +122,24 @@ public:
         return results;
     }
 
+    // Zero-copy integration: registers the numpy array's memory with the vdevice DMA mapping path
+    // once, so async transfers use the array in place instead of copying through internal buffers.
+    // The array must stay alive (and not be resized/reallocated) until unmap_buffer is called.
+    void map_buffer(py::buffer buffer, hailo_stream_direction_t direction)
+    {
+        auto buffer_info = buffer.request(true);
+        const auto size = static_cast<size_t>(buffer_info.size * buffer_info.itemsize);
+        auto status = m_vdevice->dma_map(buffer_info.ptr, size, direction);
+        VALIDATE_STATUS(status);
+    }
+
+    void unmap_buffer(py::buffer buffer, hailo_stream_direction_t direction)
+    {
+        auto buffer_info = buffer.request();
+        auto status = m_vdevice->dma_unmap(buffer_info.ptr, direction);
+        VALIDATE_STATUS(status);
+    }
+
     void release()
     {
         m_net_groups.clear();
@@ -146,6 +164,8 @@ void VDevice_api_initialize_python_module(py::module &m)
         .def("create_from_ids", &VDeviceWrapper::create_from_ids)
         .def("get_physical_devices_ids", &VDeviceWrapper::get_physical_devices_ids)
         .def("configure", &VDeviceWrapper::configure)
+        .def("map_buffer", &VDeviceWrapper::map_buffer)
+        .def("unmap_buffer", &VDeviceWrapper::unmap_buffer)
         .def("release", &VDeviceWrapper::release)
         ;
 }
@@ -27,6 +27,27 @@ void InputVStreamWrapper::add_to_python_module(py::module &m)
             MemoryView(const_cast<void*>(reinterpret_cast<const void*>(data.data())), data.nbytes()));
         VALIDATE_STATUS(status);
     })
+    .def("send_all", [](InputVStream &self, py::array data, uint32_t num_frames)
+    {
+        // Batched send - the GIL is released for the whole batch and the frames are written in one
+        // native loop, instead of paying per-frame call and GIL overhead
+        VALIDATE_STATUS((num_frames > 0) ? HAILO_SUCCESS : HAILO_INVALID_ARGUMENT);
+        VALIDATE_STATUS((0 == (data.nbytes() % num_frames)) ? HAILO_SUCCESS : HAILO_INVALID_ARGUMENT);
+        const auto frame_size = static_cast<size_t>(data.nbytes()) / num_frames;
+        auto *data_ptr = const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(data.data()));
+
+        hailo_status status = HAILO_SUCCESS;
+        {
+            py::gil_scoped_release release;
+            for (uint32_t frame = 0; frame < num_frames; frame++) {
+                status = self.write(MemoryView(data_ptr + (frame * frame_size), frame_size));
+                if (HAILO_SUCCESS != status) {
+                    break;
+                }
+            }
+        }
+        VALIDATE_STATUS(status);
+    })
     .def("flush", [](InputVStream &self)
     {
         hailo_status status = self.flush();
@@ -161,6 +182,31 @@ void OutputVStreamWrapper::add_to_python_module(py::module &m)
         return py::array(get_dtype(self), get_shape(self), unmanaged_addr,
             py::capsule(unmanaged_addr, [](void *p) { delete reinterpret_cast<uint8_t*>(p); }));
     })
+    .def("recv_all", [](OutputVStream &self, uint32_t num_frames)
+    {
+        // Batched recv - a (num_frames, ...) tensor is preallocated and filled in one native loop
+        // with the GIL released for the whole batch
+        VALIDATE_STATUS((num_frames > 0) ? HAILO_SUCCESS : HAILO_INVALID_ARGUMENT);
+        auto shape = HailoRTBindingsCommon::get_pybind_shape(self.get_info(), self.get_user_buffer_format());
+        shape.insert(shape.begin(), static_cast<size_t>(num_frames));
+        py::array batch(get_dtype(self), *py::array::ShapeContainer(shape));
+
+        const auto frame_size = self.get_frame_size();
+        auto *batch_ptr = reinterpret_cast<uint8_t*>(batch.mutable_data());
+
+        hailo_status status = HAILO_SUCCESS;
+        {
+            py::gil_scoped_release release;
+            for (uint32_t frame = 0; frame < num_frames; frame++) {
+                status = self.read(MemoryView(batch_ptr + (frame * frame_size), frame_size));
+                if (HAILO_SUCCESS != status) {
+                    break;
+                }
+            }
+        }
+        VALIDATE_STATUS(status);
+        return batch;
+    })
     .def("set_nms_score_threshold", [](OutputVStream &self, float32_t threshold)
     {
         hailo_status status = self.set_nms_score_threshold(threshold);
@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file batch_bindings.hpp
+ * @brief First-class batched bindings: bind one (batch, ...) strided tensor per stream and the
+ *        library slices the per-frame views - no frame-offset math in application code. Built
+ *        over the public async API; submission fans out per frame and completes once for the
+ *        whole batch (first failure wins).
+ **/
+
+#ifndef _HAILO_BATCH_BINDINGS_HPP_
+#define _HAILO_BATCH_BINDINGS_HPP_
+
+#include "hailo/infer_model.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/** hailort namespace */
+namespace hailort
+{
+
+class BatchBindings final
+{
+public:
+    /** Creates bindings for @a batch_size frames over @a configured_model. */
+    static Expected<BatchBindings> create(ConfiguredInferModel &configured_model, size_t batch_size)
+    {
+        std::vector<ConfiguredInferModel::Bindings> frames;
+        frames.reserve(batch_size);
+        for (size_t i = 0; i < batch_size; i++) {
+            auto bindings = configured_model.create_bindings();
+            CHECK_EXPECTED(bindings);
+            frames.emplace_back(bindings.release());
+        }
+        return BatchBindings(std::move(frames));
+    }
+
+    /**
+     * Binds a (batch, ...) tensor to the named input: frame i gets the view at
+     * [i * frame_stride, i * frame_stride + frame_size). A packed tensor passes
+     * frame_stride == frame_size; padded batches pass the larger stride.
+     */
+    hailo_status bind_input(const std::string &stream_name, MemoryView batch_tensor, size_t frame_size,
+        size_t frame_stride = 0)
+    {
+        return bind(stream_name, batch_tensor, frame_size, frame_stride, true);
+    }
+
+    /** Binds a (batch, ...) output tensor - see bind_input for the slicing rule. */
+    hailo_status bind_output(const std::string &stream_name, MemoryView batch_tensor, size_t frame_size,
+        size_t frame_stride = 0)
+    {
+        return bind(stream_name, batch_tensor, frame_size, frame_stride, false);
+    }
+
+    /**
+     * Submits every frame of the batch asynchronously; @a on_batch_done fires once, after the
+     * last frame completed, with HAILO_SUCCESS or the first failing frame's status.
+     */
+    hailo_status run_async(ConfiguredInferModel &configured_model, std::function<void(hailo_status)> on_batch_done)
+    {
+        CHECK(nullptr != on_batch_done, HAILO_INVALID_ARGUMENT, "on_batch_done callback must be valid");
+
+        struct BatchState {
+            std::atomic<size_t> remaining;
+            std::atomic<int> first_error{static_cast<int>(HAILO_SUCCESS)};
+            std::function<void(hailo_status)> on_done;
+        };
+        auto state = std::make_shared<BatchState>();
+        state->remaining = m_frames.size();
+        state->on_done = std::move(on_batch_done);
+
+        for (auto &frame_bindings : m_frames) {
+            auto job = configured_model.run_async(frame_bindings,
+                [state](const AsyncInferCompletionInfo &info) {
+                    if (HAILO_SUCCESS != info.status) {
+                        int expected = static_cast<int>(HAILO_SUCCESS);
+                        state->first_error.compare_exchange_strong(expected, static_cast<int>(info.status));
+                    }
+                    if (1 == state->remaining.fetch_sub(1)) {
+                        state->on_done(static_cast<hailo_status>(state->first_error.load()));
+                    }
+                });
+            if (!job) {
+                // Frames already submitted complete through the callback; account for the rest here
+                int expected = static_cast<int>(HAILO_SUCCESS);
+                state->first_error.compare_exchange_strong(expected, static_cast<int>(job.status()));
+                if (1 == state->remaining.fetch_sub(1)) {
+                    state->on_done(static_cast<hailo_status>(state->first_error.load()));
+                }
+                return job.status();
+            }
+            job->detach();
+        }
+        return HAILO_SUCCESS;
+    }
+
+    size_t batch_size() const { return m_frames.size(); }
+    ConfiguredInferModel::Bindings &frame(size_t index) { return m_frames[index]; }
+
+private:
+    explicit BatchBindings(std::vector<ConfiguredInferModel::Bindings> &&frames) :
+        m_frames(std::move(frames))
+    {}
+
+    hailo_status bind(const std::string &stream_name, MemoryView batch_tensor, size_t frame_size,
+        size_t frame_stride, bool is_input)
+    {
+        const auto stride = (0 == frame_stride) ? frame_size : frame_stride;
+        CHECK(stride >= frame_size, HAILO_INVALID_ARGUMENT, "Frame stride must be at least the frame size");
+        CHECK(batch_tensor.size() >= (((m_frames.size() - 1) * stride) + frame_size), HAILO_INVALID_ARGUMENT,
+            "Batch tensor is smaller than batch_size frames at the given stride");
+
+        for (size_t i = 0; i < m_frames.size(); i++) {
+            MemoryView frame_view(batch_tensor.data() + (i * stride), frame_size);
+            if (is_input) {
+                auto input = m_frames[i].input(stream_name);
+                CHECK_EXPECTED_AS_STATUS(input);
+                auto status = input->set_buffer(frame_view);
+                CHECK_SUCCESS(status);
+            } else {
+                auto output = m_frames[i].output(stream_name);
+                CHECK_EXPECTED_AS_STATUS(output);
+                auto status = output->set_buffer(frame_view);
+                CHECK_SUCCESS(status);
+            }
+        }
+        return HAILO_SUCCESS;
+    }
+
+    std::vector<ConfiguredInferModel::Bindings> m_frames;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_BATCH_BINDINGS_HPP_ */
@@ -167,6 +167,13 @@ private:
  * Object that can refer to a contiguous sequence of bytes.
  * This object does not own the memory and therefore it assumes that the memory exists and valid.
  */
+// View-first API tier convention:
+//  New internal APIs take and return MemoryView wherever the callee does not need ownership; an
+//  owning Buffer is only created when data must outlive its producer. Lifetime contract for a
+//  returned view: it is valid as long as the object it was obtained from, unless the API
+//  documents a shorter scope. Known owning-copy offenders queued for conversion to this tier:
+//  Control response payload accessors (device_common/control.cpp) and the Hef buffer getters that
+//  duplicate protobuf-owned data.
 class HAILORTAPI MemoryView final
 {
 public:
@@ -207,6 +207,13 @@ private:
 };
 
 /*! Expected<T> is either a T or the ::hailo_status preventing T to be created.*/
+// Hot-path cost contract (audited - keep these properties when touching this class):
+//  - The error path is allocation free: an unexpected Expected stores only the hailo_status enum,
+//    and make_unexpected() never formats or allocates.
+//  - The CHECK_* macro family only formats its message inside the failing branch, so success-path
+//    returns never build strings.
+//  - The copy constructor is explicit, so hot-path code cannot copy an Expected (or its payload)
+//    implicitly - ownership moves through release()/std::move.
 template<typename T>
 class Expected final
 {
@@ -872,8 +872,25 @@ typedef struct {
 typedef struct {
     hailo_stream_transform_mode_t transform_mode;
     hailo_format_t user_buffer_format;
+    /** Number of worker threads used for a single output transformation. The values 0 and 1 keep the
+     * transformation single threaded (default). Larger values split each frame into row ranges that are
+     * transformed in parallel on a thread pool shared across all transform contexts in the process.
+     * Effective only for frame (non-NMS) output transformations that are row separable. */
+    uint32_t transform_worker_threads_count;
 } hailo_transform_params_t;
 
+/** Scheduler metrics of a single scheduled core-op (model), pulled via VDevice::get_scheduler_metrics() */
+typedef struct {
+    /** Scheduler handle of the core op */
+    uint32_t core_op_handle;
+    /** Infer requests currently pending in the scheduler queue */
+    uint32_t pending_infer_requests;
+    /** Total core-op switches performed onto a device for this core op */
+    uint64_t core_op_switches;
+    /** Configured max batch size */
+    uint16_t max_batch_size;
+} hailo_scheduler_core_op_metrics_t;
+
 /** Demuxer params */
 typedef struct {
     EMPTY_STRUCT_PLACEHOLDER
@@ -1184,6 +1201,27 @@ typedef enum {
     HAILO_VSTREAM_STATS_MAX_ENUM        = HAILO_MAX_ENUM
 } hailo_vstream_stats_flags_t;
 
+/** Virtual stream flags */
+typedef enum {
+    HAILO_VSTREAM_FLAGS_NONE                    = 0,        /*!< No flags */
+    /** Output vstreams only: run the output transformation on a dedicated pipeline thread,
+     * double buffered ahead of the user's read() calls. The device read of frame N+1 and the
+     * post-processing of frame N overlap, and read() pays only a memcpy from the decoded buffer. */
+    HAILO_VSTREAM_FLAGS_PIPELINED_POST_PROCESS  = 1 << 0,
+    /** Input vstreams only - QoS when the pipeline queue is full: drop the incoming frame instead
+     * of blocking the producer. */
+    HAILO_VSTREAM_FLAGS_DROP_NEWEST             = 1 << 1,
+    /** Input vstreams only - QoS when the pipeline queue is full: drop the oldest queued frame to
+     * make room for the incoming one. */
+    HAILO_VSTREAM_FLAGS_DROP_OLDEST             = 1 << 2,
+    /** Input vstreams only - QoS: keep only the latest frame, draining everything queued before
+     * it. Live-video semantics - latency stays bounded at one frame. */
+    HAILO_VSTREAM_FLAGS_LATEST_ONLY             = 1 << 3,
+
+    /** Max enum value to maintain ABI Integrity */
+    HAILO_VSTREAM_FLAGS_MAX_ENUM                = HAILO_MAX_ENUM
+} hailo_vstream_flags_t;
+
 /** Pipeline element statistics flags */
 typedef enum {
     HAILO_PIPELINE_ELEM_STATS_NONE                  = 0,        /*!< No stats */
@@ -1202,6 +1240,7 @@ typedef struct {
     uint32_t queue_size;
     hailo_vstream_stats_flags_t vstream_stats_flags;
     hailo_pipeline_elem_stats_flags_t pipeline_elements_stats_flags;
+    hailo_vstream_flags_t flags;
 } hailo_vstream_params_t;
 
 /** Input virtual stream parameters */
@@ -2942,6 +2981,29 @@ HAILORTAPI hailo_status hailo_set_scheduler_priority(hailo_configured_network_gr
 // Free returned buffer via hailo_free_buffer
 HAILORTAPI hailo_status hailo_allocate_buffer(size_t size, const hailo_buffer_parameters_t *allocation_params, void **buffer_out);
 HAILORTAPI hailo_status hailo_free_buffer(void *buffer);
+
+/**
+ * Imports a dmabuf fd (e.g. exported by a VAAPI/V4L2 decoder) as a buffer usable with HailoRT
+ * streams. The dmabuf is mapped into the process address space and the returned pointer can be
+ * registered for device DMA via ::hailo_dma_map_buffer_to_device, so decoder output frames reach
+ * the device without an intermediate CPU copy into a separate HailoRT buffer.
+ *
+ * @param[in]  dmabuf_fd     The dmabuf file descriptor to import. Stays owned by the caller.
+ * @param[in]  size          The size of the dmabuf in bytes.
+ * @param[out] buffer_out    On success, set to the mapped buffer address.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns an ::hailo_status error.
+ * @note Supported on Linux only.
+ */
+HAILORTAPI hailo_status hailo_buffer_from_dmabuf(int dmabuf_fd, size_t size, void **buffer_out);
+
+/**
+ * Releases a mapping created by ::hailo_buffer_from_dmabuf. The dmabuf fd itself stays owned by
+ * the caller.
+ *
+ * @param[in] buffer         A pointer returned by ::hailo_buffer_from_dmabuf.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns an ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_buffer_release_dmabuf(void *buffer);
 // Maps buffer to dma. Free mapping by calling hailo_dma_unmap_buffer_from_device and then free buffer as needed
 // If buffer has already been mapped to device, then HAILO_DMA_MAPPING_ALREADY_EXISTS shall be returned
 HAILORTAPI hailo_status hailo_dma_map_buffer_to_device(void *buffer, size_t size, hailo_device device, hailo_dma_buffer_direction_t direction);
@@ -71,6 +71,17 @@ public:
      */
     static Expected<Hef> create(const std::string &hef_path);
 
+    /**
+     * Creates an Hef from a file, memory-mapping the file instead of reading it into a heap buffer.
+     * The HEF content is parsed directly over the mapped region, so startup skips the whole-file
+     * copy and peak RSS doesn't double for large HEFs.
+     *
+     * @param[in] hef_path            The path of the Hef file.
+     * @return Upon success, returns Expected of Hef. Otherwise, returns Unexpected of ::hailo_status error.
+     * @note On platforms without file mapping support, falls back to the buffered path of create().
+     */
+    static Expected<Hef> create_mmap(const std::string &hef_path);
+
     /**
      * Creates an Hef from a buffer.
      *
@@ -450,6 +461,17 @@ public:
 
     Expected<std::string> get_description(bool stream_infos, bool vstream_infos) const;
 
+    /**
+     * Returns a string of the HEF's deployment-relevant performance characteristics per network
+     * group: context count, config (CCW) footprint, inter-context transfer totals and the
+     * compiler's estimated bottleneck FPS - the numbers deployments are gated on, computed from
+     * the HEF alone without configuring a device.
+     *
+     * @return Upon success, returns Expected of a string containing the report.
+     *         Otherwise, returns Unexpected of ::hailo_status error.
+     */
+    Expected<std::string> get_perf_description();
+
     ~Hef();
     Hef(Hef &&);
     Hef &operator=(Hef &&);
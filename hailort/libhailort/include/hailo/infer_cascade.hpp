@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_cascade.hpp
+ * @brief First-class model cascade: declare that model A's output feeds model B's input (with an
+ *        optional host hook between them for ROI selection / crop preparation), and run the pair
+ *        as one unit. The cascade submits B's frame from A's completion, so with both models on
+ *        one scheduled device B's request is already pending when A finishes - letting the
+ *        scheduler activate B right behind A instead of round-robining away. Header-only over the
+ *        public async API.
+ **/
+
+#ifndef _HAILO_INFER_CASCADE_HPP_
+#define _HAILO_INFER_CASCADE_HPP_
+
+#include "hailo/infer_model.hpp"
+
+#include <chrono>
+#include <functional>
+
+/** hailort namespace */
+namespace hailort
+{
+
+class InferCascade final
+{
+public:
+    /** Hook invoked between the stages, e.g. to select ROIs from A's output and fill B's input
+     * bindings. Returning a failure status skips stage B and completes the cascade with it. */
+    using HandoffHook = std::function<hailo_status(ConfiguredInferModel::Bindings &first_stage_bindings,
+        ConfiguredInferModel::Bindings &second_stage_bindings)>;
+    using CompletionCallback = std::function<void(hailo_status)>;
+
+    InferCascade(ConfiguredInferModel &first_stage, ConfiguredInferModel &second_stage,
+        HandoffHook handoff_hook = nullptr) :
+        m_first_stage(first_stage),
+        m_second_stage(second_stage),
+        m_handoff_hook(std::move(handoff_hook))
+    {}
+
+    /**
+     * Hints the scheduler to co-schedule the pair: the second stage gets a minimal batching
+     * threshold so its (already pending) request activates immediately after the first stage
+     * completes, minimizing the switch gap between the stages.
+     */
+    hailo_status configure_co_scheduling()
+    {
+        auto status = m_second_stage.set_scheduler_threshold(1);
+        CHECK_SUCCESS(status);
+        return m_second_stage.set_scheduler_timeout(std::chrono::milliseconds(0));
+    }
+
+    /**
+     * Runs the cascade asynchronously: stage A infers, the handoff hook runs on A's completion,
+     * stage B is submitted immediately after, and @a on_done fires with the final status.
+     */
+    hailo_status run_async(ConfiguredInferModel::Bindings first_stage_bindings,
+        ConfiguredInferModel::Bindings second_stage_bindings, CompletionCallback on_done)
+    {
+        CHECK(nullptr != on_done, HAILO_INVALID_ARGUMENT, "on_done callback must be valid");
+
+        auto first_job = m_first_stage.run_async(first_stage_bindings,
+            [this, first_stage_bindings, second_stage_bindings, on_done](const AsyncInferCompletionInfo &info) mutable {
+                if (HAILO_SUCCESS != info.status) {
+                    on_done(info.status);
+                    return;
+                }
+
+                if (m_handoff_hook) {
+                    const auto hook_status = m_handoff_hook(first_stage_bindings, second_stage_bindings);
+                    if (HAILO_SUCCESS != hook_status) {
+                        on_done(hook_status);
+                        return;
+                    }
+                }
+
+                auto second_job = m_second_stage.run_async(second_stage_bindings,
+                    [on_done](const AsyncInferCompletionInfo &second_info) {
+                        on_done(second_info.status);
+                    });
+                if (!second_job) {
+                    on_done(second_job.status());
+                    return;
+                }
+                second_job->detach();
+            });
+        CHECK_EXPECTED_AS_STATUS(first_job);
+        first_job->detach();
+
+        return HAILO_SUCCESS;
+    }
+
+private:
+    ConfiguredInferModel &m_first_stage;
+    ConfiguredInferModel &m_second_stage;
+    HandoffHook m_handoff_hook;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_INFER_CASCADE_HPP_ */
@@ -98,6 +98,15 @@ public:
     Expected<LatencyMeasurementResult> get_hw_latency_measurement(const std::string &network_name = "");
     hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout);
     hailo_status set_scheduler_threshold(uint32_t threshold);
+
+    /**
+     * Sets a completion executor: instead of invoking run_async completion callbacks inline on the
+     * library's dispatcher threads, each completion is wrapped into a task and handed to
+     * @a executor, which may run it on the application's own executor/event loop - removing the
+     * extra queue hop applications add to bounce completions back to their threads. Passing a null
+     * executor restores inline invocation. Applies to run_async calls made after this call.
+     */
+    void set_completion_executor(std::function<void(std::function<void()>)> executor);
     hailo_status set_scheduler_priority(uint8_t priority);
     Expected<size_t> get_async_queue_size();
 
@@ -136,6 +145,20 @@ public:
         
         void set_format_type(hailo_format_type_t type);
         void set_format_order(hailo_format_order_t order);
+
+        /**
+         * Returns the cheapest user buffer format for this stream - the format the device already
+         * produces/consumes (quantized type and HW order), for which no CPU transformation runs.
+         * Consumers that can work on quantized data should pass this to set_format_type/order to
+         * drop the dequantize/reorder cost entirely.
+         */
+        hailo_format_t get_native_format() const;
+
+        /**
+         * Convenience - configures the stream's user buffer format to get_native_format(), turning
+         * the transformation into a pure pass-through.
+         */
+        void set_native_format();
         std::vector<hailo_quant_info_t> get_quant_infos() const;
         bool is_nms() const;
         void set_nms_score_threshold(float32_t threshold);
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_model_awaitable.hpp
+ * @brief C++20 coroutine layer over the async inference API:
+ *
+ *      hailo_status status = co_await hailort::async_infer(configured_model, bindings);
+ *
+ *  The awaiter lives on the coroutine frame and wires straight into the existing run_async
+ *  callback machinery - no extra threads or queues; the coroutine resumes on the completion
+ *  thread (combine with ConfiguredInferModel::set_completion_executor to resume on your own
+ *  executor). The header is standalone and only usable when the compiler provides coroutines;
+ *  including it from C++14/17 translation units is harmless.
+ **/
+
+#ifndef _HAILO_INFER_MODEL_AWAITABLE_HPP_
+#define _HAILO_INFER_MODEL_AWAITABLE_HPP_
+
+#include "hailo/infer_model.hpp"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+
+/** hailort namespace */
+namespace hailort
+{
+
+class InferAwaitable final
+{
+public:
+    InferAwaitable(ConfiguredInferModel &model, ConfiguredInferModel::Bindings bindings) :
+        m_model(model),
+        m_bindings(bindings),
+        m_status(HAILO_UNINITIALIZED)
+    {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    // Launches the inference; the coroutine resumes from the completion callback. When the launch
+    // itself fails, the coroutine is resumed immediately with the failure status.
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        auto job = m_model.run_async(m_bindings, [this, handle](const AsyncInferCompletionInfo &info) {
+            m_status = info.status;
+            handle.resume();
+        });
+        if (!job) {
+            m_status = job.status();
+            return false; // Resume immediately
+        }
+        job->detach();
+        return true;
+    }
+
+    hailo_status await_resume() const noexcept
+    {
+        return m_status;
+    }
+
+private:
+    ConfiguredInferModel &m_model;
+    ConfiguredInferModel::Bindings m_bindings;
+    hailo_status m_status;
+};
+
+/**
+ * Awaitable inference - `co_await async_infer(model, bindings)` completes with the inference
+ * status once the frame is done.
+ */
+inline InferAwaitable async_infer(ConfiguredInferModel &model, ConfiguredInferModel::Bindings bindings)
+{
+    return InferAwaitable(model, bindings);
+}
+
+} /* namespace hailort */
+
+#endif /* defined(__cpp_impl_coroutine) && __has_include(<coroutine>) */
+
+#endif /* _HAILO_INFER_MODEL_AWAITABLE_HPP_ */
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_result_cache.hpp
+ * @brief Content-addressed inference result cache for pipelines that re-infer identical inputs
+ *        (logos, blank regions, repeated crops). Inputs are hashed with two independently seeded
+ *        hardware CRC32C passes (cheap enough to run at line rate); on a hit the cached outputs
+ *        are copied back and the device round-trip is skipped entirely. Bounded LRU. Use in
+ *        front of run_async:
+ *
+ *            if (!cache.try_get(input_views, output_views)) {
+ *                ... run_async, and in the completion: cache.store(input_views, output_views);
+ *            }
+ **/
+
+#ifndef _HAILO_INFER_RESULT_CACHE_HPP_
+#define _HAILO_INFER_RESULT_CACHE_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/buffer.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace hailort
+{
+
+class HAILORTAPI InferResultCache final
+{
+public:
+    explicit InferResultCache(size_t max_entries = 256);
+
+    InferResultCache(const InferResultCache &) = delete;
+    InferResultCache &operator=(const InferResultCache &) = delete;
+
+    /**
+     * Looks the hashed inputs up; on a hit copies the cached outputs into @a output_views (which
+     * must match the stored outputs' sizes) and returns true.
+     * @note The hash is not collision free - pipelines where a rare wrong result is unacceptable
+     *       should verify by keeping (and comparing) the input bytes alongside, at a memory cost.
+     */
+    bool try_get(const std::vector<MemoryView> &input_views, std::vector<MemoryView> &output_views);
+
+    /** Stores the outputs for the hashed inputs, evicting the least recently used entry when full. */
+    void store(const std::vector<MemoryView> &input_views, const std::vector<MemoryView> &output_views);
+
+    uint64_t hits() const { return m_hits; }
+    uint64_t misses() const { return m_misses; }
+
+    /**
+     * Process-wide aggregates over every cache instance - sampled by the stats emitter
+     * (HAILO_STATS_EMITTER) so hit rates show up in the same telemetry stream as the scheduler
+     * metrics.
+     */
+    static uint64_t total_hits();
+    static uint64_t total_misses();
+
+private:
+    struct Entry {
+        std::vector<std::vector<uint8_t>> outputs;
+        std::list<uint64_t>::iterator lru_position;
+    };
+
+    static uint64_t hash_views(const std::vector<MemoryView> &views);
+
+    const size_t m_max_entries;
+    std::mutex m_mutex;
+    std::unordered_map<uint64_t, Entry> m_entries;
+    std::list<uint64_t> m_lru;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_INFER_RESULT_CACHE_HPP_ */
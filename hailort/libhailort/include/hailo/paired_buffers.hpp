@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file paired_buffers.hpp
+ * @brief Colocated input+output frame buffers: one DMA-able allocation carved into the model's
+ *        input and output frame slots (cache-line aligned), so a frame's whole working set
+ *        ping-pongs within the same pages instead of scattering across DRAM. Bind the returned
+ *        views into the model's bindings and keep the owning buffer alive while inference runs.
+ **/
+
+#ifndef _HAILO_PAIRED_BUFFERS_HPP_
+#define _HAILO_PAIRED_BUFFERS_HPP_
+
+#include "hailo/infer_model.hpp"
+#include "hailo/buffer.hpp"
+#include "hailo/buffer_storage.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/** hailort namespace */
+namespace hailort
+{
+
+struct PairedFrameBuffers final
+{
+    // Owns the single backing allocation for all the views below
+    BufferPtr backing_buffer;
+    std::vector<std::pair<std::string, MemoryView>> input_views;
+    std::vector<std::pair<std::string, MemoryView>> output_views;
+};
+
+/**
+ * Allocates one DMA-able buffer holding every input and output frame of @a infer_model
+ * back to back (cache-line aligned slots) and returns per-stream views into it.
+ * The views bind straight into ConfiguredInferModel::Bindings; the backing buffer is lazily
+ * DMA-mapped on first transfer like any DMA-able buffer.
+ */
+inline Expected<PairedFrameBuffers> allocate_paired_frame_buffers(InferModel &infer_model)
+{
+    static const size_t SLOT_ALIGNMENT = 64;
+    const auto align_slot = [](size_t size) { return ((size + SLOT_ALIGNMENT - 1) / SLOT_ALIGNMENT) * SLOT_ALIGNMENT; };
+
+    size_t total_size = 0;
+    for (const auto &input : infer_model.inputs()) {
+        total_size += align_slot(input.get_frame_size());
+    }
+    for (const auto &output : infer_model.outputs()) {
+        total_size += align_slot(output.get_frame_size());
+    }
+
+    auto backing_buffer = Buffer::create_shared(total_size, BufferStorageParams::create_dma());
+    CHECK_EXPECTED(backing_buffer);
+
+    PairedFrameBuffers paired{};
+    paired.backing_buffer = backing_buffer.release();
+
+    size_t offset = 0;
+    for (const auto &input : infer_model.inputs()) {
+        paired.input_views.emplace_back(input.name(),
+            MemoryView(paired.backing_buffer->data() + offset, input.get_frame_size()));
+        offset += align_slot(input.get_frame_size());
+    }
+    for (const auto &output : infer_model.outputs()) {
+        paired.output_views.emplace_back(output.name(),
+            MemoryView(paired.backing_buffer->data() + offset, output.get_frame_size()));
+        offset += align_slot(output.get_frame_size());
+    }
+
+    return paired;
+}
+
+} /* namespace hailort */
+
+#endif /* _HAILO_PAIRED_BUFFERS_HPP_ */
@@ -15,9 +15,24 @@
 
 #include <math.h>
 #include <fenv.h>
+#include <string.h>
 
 static const float32_t INVALID_QP_VALUE = 0;
 
+// 64-bit only, like the other x86 SIMD paths in this library - the kernels currently use only
+// 128/256-bit intrinsics, but keeping 32-bit x86 on the scalar path avoids carrying (and never
+// testing) a word-size variant of every kernel
+#if defined(_M_X64) || defined(__x86_64__)
+#define HAILO_QUANT_SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON)
+#define HAILO_QUANT_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
 #ifdef _MSC_VER
 #include <immintrin.h>
 #endif
@@ -56,6 +71,405 @@ private:
     int m_original_rounding_method;
 };
 
+/** @cond INTERNAL
+ * Runtime-dispatched SIMD kernels for the common dequantize pairs (uint8/uint16 -> float32).
+ * The kernels iterate from the end of the buffer towards its start, so they are safe for both
+ * the out-of-place and the in-place (expanding) dequantize variants. On unsupported type pairs
+ * or CPUs the callers fall back to the scalar loops below.
+ **/
+namespace dequant_impl
+{
+
+#ifdef HAILO_QUANT_SIMD_X86
+
+enum class X86SimdLevel {
+    NONE = 0,
+    SSE4_1,
+    AVX2,
+};
+
+inline X86SimdLevel detect_x86_simd_level()
+{
+#ifdef _MSC_VER
+    int regs[4] = {};
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+    __cpuid(regs, 1);
+    const bool has_sse4_1 = (0 != (regs[2] & (1 << 19)));
+    const bool has_osxsave = (0 != (regs[2] & (1 << 27)));
+    bool has_avx2 = false;
+    if (has_osxsave && (max_leaf >= 7)) {
+        // AVX2 requires the OS to save the ymm state as well
+        const bool ymm_enabled = (0x6 == (_xgetbv(0) & 0x6));
+        __cpuidex(regs, 7, 0);
+        has_avx2 = ymm_enabled && (0 != (regs[1] & (1 << 5)));
+    }
+    return has_avx2 ? X86SimdLevel::AVX2 : (has_sse4_1 ? X86SimdLevel::SSE4_1 : X86SimdLevel::NONE);
+#else
+    if (__builtin_cpu_supports("avx2")) {
+        return X86SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return X86SimdLevel::SSE4_1;
+    }
+    return X86SimdLevel::NONE;
+#endif
+}
+
+inline X86SimdLevel get_x86_simd_level()
+{
+    static const X86SimdLevel level = detect_x86_simd_level();
+    return level;
+}
+
+#ifdef _MSC_VER
+#define HAILO_QUANT_TARGET_AVX2
+#define HAILO_QUANT_TARGET_SSE4_1
+#else
+#define HAILO_QUANT_TARGET_AVX2 __attribute__((target("avx2")))
+#define HAILO_QUANT_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+#endif
+
+HAILO_QUANT_TARGET_AVX2
+inline void dequantize_u8_avx2(const uint8_t *src_ptr, float32_t *dst_ptr, uint32_t buffer_elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    const __m256 zp = _mm256_set1_ps(qp_zp);
+    const __m256 scale = _mm256_set1_ps(qp_scale);
+    int64_t i = (int64_t)buffer_elements_count - 8;
+    for (; i >= 0; i -= 8) {
+        const __m128i q = _mm_loadl_epi64((const __m128i *)(src_ptr + i));
+        const __m256 v = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(q));
+        _mm256_storeu_ps(dst_ptr + i, _mm256_mul_ps(_mm256_sub_ps(v, zp), scale));
+    }
+    for (i += 7; i >= 0; i--) {
+        dst_ptr[i] = (src_ptr[i] - qp_zp) * qp_scale;
+    }
+}
+
+HAILO_QUANT_TARGET_AVX2
+inline void dequantize_u16_avx2(const uint16_t *src_ptr, float32_t *dst_ptr, uint32_t buffer_elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    const __m256 zp = _mm256_set1_ps(qp_zp);
+    const __m256 scale = _mm256_set1_ps(qp_scale);
+    int64_t i = (int64_t)buffer_elements_count - 8;
+    for (; i >= 0; i -= 8) {
+        const __m128i q = _mm_loadu_si128((const __m128i *)(src_ptr + i));
+        const __m256 v = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(q));
+        _mm256_storeu_ps(dst_ptr + i, _mm256_mul_ps(_mm256_sub_ps(v, zp), scale));
+    }
+    for (i += 7; i >= 0; i--) {
+        dst_ptr[i] = (src_ptr[i] - qp_zp) * qp_scale;
+    }
+}
+
+HAILO_QUANT_TARGET_SSE4_1
+inline void dequantize_u8_sse4_1(const uint8_t *src_ptr, float32_t *dst_ptr, uint32_t buffer_elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    const __m128 zp = _mm_set1_ps(qp_zp);
+    const __m128 scale = _mm_set1_ps(qp_scale);
+    int64_t i = (int64_t)buffer_elements_count - 4;
+    for (; i >= 0; i -= 4) {
+        uint32_t packed = 0;
+        memcpy(&packed, src_ptr + i, sizeof(packed));
+        const __m128 v = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128((int)packed)));
+        _mm_storeu_ps(dst_ptr + i, _mm_mul_ps(_mm_sub_ps(v, zp), scale));
+    }
+    for (i += 3; i >= 0; i--) {
+        dst_ptr[i] = (src_ptr[i] - qp_zp) * qp_scale;
+    }
+}
+
+HAILO_QUANT_TARGET_SSE4_1
+inline void dequantize_u16_sse4_1(const uint16_t *src_ptr, float32_t *dst_ptr, uint32_t buffer_elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    const __m128 zp = _mm_set1_ps(qp_zp);
+    const __m128 scale = _mm_set1_ps(qp_scale);
+    int64_t i = (int64_t)buffer_elements_count - 4;
+    for (; i >= 0; i -= 4) {
+        const __m128i q = _mm_loadl_epi64((const __m128i *)(src_ptr + i));
+        const __m128 v = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(q));
+        _mm_storeu_ps(dst_ptr + i, _mm_mul_ps(_mm_sub_ps(v, zp), scale));
+    }
+    for (i += 3; i >= 0; i--) {
+        dst_ptr[i] = (src_ptr[i] - qp_zp) * qp_scale;
+    }
+}
+
+#endif /* HAILO_QUANT_SIMD_X86 */
+
+#ifdef HAILO_QUANT_SIMD_NEON
+
+inline void dequantize_u8_neon(const uint8_t *src_ptr, float32_t *dst_ptr, uint32_t buffer_elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    const float32x4_t zp = vdupq_n_f32(qp_zp);
+    const float32x4_t scale = vdupq_n_f32(qp_scale);
+    int64_t i = (int64_t)buffer_elements_count - 8;
+    for (; i >= 0; i -= 8) {
+        const uint16x8_t q16 = vmovl_u8(vld1_u8(src_ptr + i));
+        const float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(q16)));
+        const float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(q16)));
+        vst1q_f32(dst_ptr + i, vmulq_f32(vsubq_f32(lo, zp), scale));
+        vst1q_f32(dst_ptr + i + 4, vmulq_f32(vsubq_f32(hi, zp), scale));
+    }
+    for (i += 7; i >= 0; i--) {
+        dst_ptr[i] = (src_ptr[i] - qp_zp) * qp_scale;
+    }
+}
+
+inline void dequantize_u16_neon(const uint16_t *src_ptr, float32_t *dst_ptr, uint32_t buffer_elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+    const float32x4_t zp = vdupq_n_f32(qp_zp);
+    const float32x4_t scale = vdupq_n_f32(qp_scale);
+    int64_t i = (int64_t)buffer_elements_count - 8;
+    for (; i >= 0; i -= 8) {
+        const uint16x8_t q16 = vld1q_u16(src_ptr + i);
+        const float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(q16)));
+        const float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(q16)));
+        vst1q_f32(dst_ptr + i, vmulq_f32(vsubq_f32(lo, zp), scale));
+        vst1q_f32(dst_ptr + i + 4, vmulq_f32(vsubq_f32(hi, zp), scale));
+    }
+    for (i += 7; i >= 0; i--) {
+        dst_ptr[i] = (src_ptr[i] - qp_zp) * qp_scale;
+    }
+}
+
+#endif /* HAILO_QUANT_SIMD_NEON */
+
+// Generic fallback - type pair without a vectorized kernel, handled by the scalar loops in Quantization
+template <typename T, typename Q>
+inline bool try_dequantize_buffer(const Q *, T *, uint32_t, float32_t, float32_t)
+{
+    return false;
+}
+
+inline bool try_dequantize_buffer(const uint8_t *src_ptr, float32_t *dst_ptr, uint32_t buffer_elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+#if defined(HAILO_QUANT_SIMD_X86)
+    switch (get_x86_simd_level()) {
+    case X86SimdLevel::AVX2:
+        dequantize_u8_avx2(src_ptr, dst_ptr, buffer_elements_count, qp_zp, qp_scale);
+        return true;
+    case X86SimdLevel::SSE4_1:
+        dequantize_u8_sse4_1(src_ptr, dst_ptr, buffer_elements_count, qp_zp, qp_scale);
+        return true;
+    default:
+        return false;
+    }
+#elif defined(HAILO_QUANT_SIMD_NEON)
+    dequantize_u8_neon(src_ptr, dst_ptr, buffer_elements_count, qp_zp, qp_scale);
+    return true;
+#else
+    (void)src_ptr;
+    (void)dst_ptr;
+    (void)buffer_elements_count;
+    (void)qp_zp;
+    (void)qp_scale;
+    return false;
+#endif
+}
+
+inline bool try_dequantize_buffer(const uint16_t *src_ptr, float32_t *dst_ptr, uint32_t buffer_elements_count,
+    float32_t qp_zp, float32_t qp_scale)
+{
+#if defined(HAILO_QUANT_SIMD_X86)
+    switch (get_x86_simd_level()) {
+    case X86SimdLevel::AVX2:
+        dequantize_u16_avx2(src_ptr, dst_ptr, buffer_elements_count, qp_zp, qp_scale);
+        return true;
+    case X86SimdLevel::SSE4_1:
+        dequantize_u16_sse4_1(src_ptr, dst_ptr, buffer_elements_count, qp_zp, qp_scale);
+        return true;
+    default:
+        return false;
+    }
+#elif defined(HAILO_QUANT_SIMD_NEON)
+    dequantize_u16_neon(src_ptr, dst_ptr, buffer_elements_count, qp_zp, qp_scale);
+    return true;
+#else
+    (void)src_ptr;
+    (void)dst_ptr;
+    (void)buffer_elements_count;
+    (void)qp_zp;
+    (void)qp_scale;
+    return false;
+#endif
+}
+
+// Vectorized input-side quantization kernels (float32 -> uint8/uint16): clip to the limvals,
+// scale, round to nearest even (matching bankers_round - the caller holds the rounding guard and
+// the SIMD conversions use the current rounding mode), and saturating-narrow on the store.
+#ifdef HAILO_QUANT_SIMD_X86
+
+HAILO_QUANT_TARGET_AVX2
+inline void quantize_f32_to_u8_avx2(const float32_t *src_ptr, uint8_t *dst_ptr, uint32_t count,
+    float32_t limval_min, float32_t limval_max, float32_t qp_zp, float32_t qp_scale)
+{
+    const __m256 min_vec = _mm256_set1_ps(limval_min);
+    const __m256 max_vec = _mm256_set1_ps(limval_max);
+    const __m256 inv_scale = _mm256_set1_ps(1.0f / qp_scale);
+    const __m256 zp = _mm256_set1_ps(qp_zp);
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 v = _mm256_loadu_ps(src_ptr + i);
+        v = _mm256_min_ps(_mm256_max_ps(v, min_vec), max_vec);
+        v = _mm256_add_ps(_mm256_mul_ps(v, inv_scale), zp);
+        const __m256i q32 = _mm256_cvtps_epi32(v); // Current rounding mode - nearest even
+        // 8 x i32 -> 8 x u8 with saturation
+        const __m128i lo = _mm256_castsi256_si128(q32);
+        const __m128i hi = _mm256_extracti128_si256(q32, 1);
+        const __m128i packed16 = _mm_packus_epi32(lo, hi);
+        const __m128i packed8 = _mm_packus_epi16(packed16, packed16);
+        _mm_storel_epi64((__m128i *)(dst_ptr + i), packed8);
+    }
+    for (; i < count; i++) {
+        const auto clipped = (src_ptr[i] < limval_min) ? limval_min : ((src_ptr[i] > limval_max) ? limval_max : src_ptr[i]);
+        dst_ptr[i] = (uint8_t)rintf((clipped / qp_scale) + qp_zp);
+    }
+}
+
+HAILO_QUANT_TARGET_AVX2
+inline void quantize_f32_to_u16_avx2(const float32_t *src_ptr, uint16_t *dst_ptr, uint32_t count,
+    float32_t limval_min, float32_t limval_max, float32_t qp_zp, float32_t qp_scale)
+{
+    const __m256 min_vec = _mm256_set1_ps(limval_min);
+    const __m256 max_vec = _mm256_set1_ps(limval_max);
+    const __m256 inv_scale = _mm256_set1_ps(1.0f / qp_scale);
+    const __m256 zp = _mm256_set1_ps(qp_zp);
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 v = _mm256_loadu_ps(src_ptr + i);
+        v = _mm256_min_ps(_mm256_max_ps(v, min_vec), max_vec);
+        v = _mm256_add_ps(_mm256_mul_ps(v, inv_scale), zp);
+        const __m256i q32 = _mm256_cvtps_epi32(v);
+        const __m128i lo = _mm256_castsi256_si128(q32);
+        const __m128i hi = _mm256_extracti128_si256(q32, 1);
+        _mm_storeu_si128((__m128i *)(dst_ptr + i), _mm_packus_epi32(lo, hi));
+    }
+    for (; i < count; i++) {
+        const auto clipped = (src_ptr[i] < limval_min) ? limval_min : ((src_ptr[i] > limval_max) ? limval_max : src_ptr[i]);
+        dst_ptr[i] = (uint16_t)rintf((clipped / qp_scale) + qp_zp);
+    }
+}
+
+#endif /* HAILO_QUANT_SIMD_X86 */
+
+#ifdef HAILO_QUANT_SIMD_NEON
+
+inline void quantize_f32_to_u8_neon(const float32_t *src_ptr, uint8_t *dst_ptr, uint32_t count,
+    float32_t limval_min, float32_t limval_max, float32_t qp_zp, float32_t qp_scale)
+{
+    const float32x4_t min_vec = vdupq_n_f32(limval_min);
+    const float32x4_t max_vec = vdupq_n_f32(limval_max);
+    const float32x4_t inv_scale = vdupq_n_f32(1.0f / qp_scale);
+    const float32x4_t zp = vdupq_n_f32(qp_zp);
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        float32x4_t lo = vminq_f32(vmaxq_f32(vld1q_f32(src_ptr + i), min_vec), max_vec);
+        float32x4_t hi = vminq_f32(vmaxq_f32(vld1q_f32(src_ptr + i + 4), min_vec), max_vec);
+        lo = vaddq_f32(vmulq_f32(lo, inv_scale), zp);
+        hi = vaddq_f32(vmulq_f32(hi, inv_scale), zp);
+#if defined(__aarch64__)
+        const int32x4_t lo32 = vcvtnq_s32_f32(lo);
+        const int32x4_t hi32 = vcvtnq_s32_f32(hi);
+#else
+        // Round-to-nearest via the magic-number trick (values are clipped to sane range already)
+        const float32x4_t round_magic = vdupq_n_f32(12582912.0f);
+        const int32x4_t lo32 = vcvtq_s32_f32(vsubq_f32(vaddq_f32(lo, round_magic), round_magic));
+        const int32x4_t hi32 = vcvtq_s32_f32(vsubq_f32(vaddq_f32(hi, round_magic), round_magic));
+#endif
+        const uint16x8_t packed16 = vcombine_u16(vqmovun_s32(lo32), vqmovun_s32(hi32));
+        vst1_u8(dst_ptr + i, vqmovn_u16(packed16));
+    }
+    for (; i < count; i++) {
+        const auto clipped = (src_ptr[i] < limval_min) ? limval_min : ((src_ptr[i] > limval_max) ? limval_max : src_ptr[i]);
+        dst_ptr[i] = (uint8_t)rintf((clipped / qp_scale) + qp_zp);
+    }
+}
+
+inline void quantize_f32_to_u16_neon(const float32_t *src_ptr, uint16_t *dst_ptr, uint32_t count,
+    float32_t limval_min, float32_t limval_max, float32_t qp_zp, float32_t qp_scale)
+{
+    const float32x4_t min_vec = vdupq_n_f32(limval_min);
+    const float32x4_t max_vec = vdupq_n_f32(limval_max);
+    const float32x4_t inv_scale = vdupq_n_f32(1.0f / qp_scale);
+    const float32x4_t zp = vdupq_n_f32(qp_zp);
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        float32x4_t lo = vminq_f32(vmaxq_f32(vld1q_f32(src_ptr + i), min_vec), max_vec);
+        float32x4_t hi = vminq_f32(vmaxq_f32(vld1q_f32(src_ptr + i + 4), min_vec), max_vec);
+        lo = vaddq_f32(vmulq_f32(lo, inv_scale), zp);
+        hi = vaddq_f32(vmulq_f32(hi, inv_scale), zp);
+#if defined(__aarch64__)
+        const int32x4_t lo32 = vcvtnq_s32_f32(lo);
+        const int32x4_t hi32 = vcvtnq_s32_f32(hi);
+#else
+        const float32x4_t round_magic = vdupq_n_f32(12582912.0f);
+        const int32x4_t lo32 = vcvtq_s32_f32(vsubq_f32(vaddq_f32(lo, round_magic), round_magic));
+        const int32x4_t hi32 = vcvtq_s32_f32(vsubq_f32(vaddq_f32(hi, round_magic), round_magic));
+#endif
+        vst1q_u16(dst_ptr + i, vcombine_u16(vqmovun_s32(lo32), vqmovun_s32(hi32)));
+    }
+    for (; i < count; i++) {
+        const auto clipped = (src_ptr[i] < limval_min) ? limval_min : ((src_ptr[i] > limval_max) ? limval_max : src_ptr[i]);
+        dst_ptr[i] = (uint16_t)rintf((clipped / qp_scale) + qp_zp);
+    }
+}
+
+#endif /* HAILO_QUANT_SIMD_NEON */
+
+// Generic fallback - type pair without a vectorized quantize kernel
+template <typename T, typename Q>
+inline bool try_quantize_buffer(const T *, Q *, uint32_t, float32_t, float32_t, float32_t, float32_t)
+{
+    return false;
+}
+
+inline bool try_quantize_buffer(const float32_t *src_ptr, uint8_t *dst_ptr, uint32_t count,
+    float32_t limval_min, float32_t limval_max, float32_t qp_zp, float32_t qp_scale)
+{
+#if defined(HAILO_QUANT_SIMD_X86)
+    if (X86SimdLevel::AVX2 == get_x86_simd_level()) {
+        quantize_f32_to_u8_avx2(src_ptr, dst_ptr, count, limval_min, limval_max, qp_zp, qp_scale);
+        return true;
+    }
+    return false;
+#elif defined(HAILO_QUANT_SIMD_NEON)
+    quantize_f32_to_u8_neon(src_ptr, dst_ptr, count, limval_min, limval_max, qp_zp, qp_scale);
+    return true;
+#else
+    (void)src_ptr; (void)dst_ptr; (void)count; (void)limval_min; (void)limval_max; (void)qp_zp; (void)qp_scale;
+    return false;
+#endif
+}
+
+inline bool try_quantize_buffer(const float32_t *src_ptr, uint16_t *dst_ptr, uint32_t count,
+    float32_t limval_min, float32_t limval_max, float32_t qp_zp, float32_t qp_scale)
+{
+#if defined(HAILO_QUANT_SIMD_X86)
+    if (X86SimdLevel::AVX2 == get_x86_simd_level()) {
+        quantize_f32_to_u16_avx2(src_ptr, dst_ptr, count, limval_min, limval_max, qp_zp, qp_scale);
+        return true;
+    }
+    return false;
+#elif defined(HAILO_QUANT_SIMD_NEON)
+    quantize_f32_to_u16_neon(src_ptr, dst_ptr, count, limval_min, limval_max, qp_zp, qp_scale);
+    return true;
+#else
+    (void)src_ptr; (void)dst_ptr; (void)count; (void)limval_min; (void)limval_max; (void)qp_zp; (void)qp_scale;
+    return false;
+#endif
+}
+
+} /* namespace dequant_impl */
+/** @endcond */
+
 /*! Hailo device requires input data to be quantized/scaled before it is sent. Similarly, data outputted
  * from the device needs to be 'de-quantized'/rescaled as well.
  * When a neural network is compiled, each input/output layer in the neural network is assigned two floating point values
@@ -83,6 +497,10 @@ public:
     template <typename T, typename Q>
     static void dequantize_output_buffer(Q *src_ptr, T *dst_ptr, uint32_t buffer_elements_count, hailo_quant_info_t quant_info)
     {
+        // The vectorized kernels compute (q - qp_zp) * qp_scale, which is exact also for the identity qp
+        if (dequant_impl::try_dequantize_buffer(src_ptr, dst_ptr, buffer_elements_count, quant_info.qp_zp, quant_info.qp_scale)) {
+            return;
+        }
         if (is_identity_qp(quant_info)) {
             for (uint32_t i = 0; i < buffer_elements_count; i++) {
                 dst_ptr[i] = (T)(src_ptr[i]);
@@ -119,6 +537,10 @@ public:
     template <typename T, typename Q>
     static void dequantize_output_buffer_in_place(T *dst_ptr, uint32_t offset, uint32_t buffer_elements_count, float32_t qp_zp, float32_t qp_scale)
     {
+        // The vectorized kernels iterate backwards, so the in-place expansion is safe
+        if (dequant_impl::try_dequantize_buffer((const Q *)dst_ptr + offset, dst_ptr + offset, buffer_elements_count, qp_zp, qp_scale)) {
+            return;
+        }
         if (is_identity_qp(qp_zp, qp_scale)) {
             for (int32_t i = (int32_t)buffer_elements_count - 1; i >= 0; i--) {
                 dst_ptr[offset + i] = (T)(*((Q*)dst_ptr + offset + i));
@@ -142,6 +564,12 @@ public:
     static void quantize_input_buffer(T *src_ptr, Q *dst_ptr, uint32_t buffer_elements_count, hailo_quant_info_t quant_info)
     {
         auto rounding_tonearest_guard = RoundingToNearestGuard();
+        // Saturating SIMD kernels cover the hot float32 -> uint8/uint16 pairs (clip + scale +
+        // nearest-even rounding match the scalar path; the guard above sets the rounding mode)
+        if (dequant_impl::try_quantize_buffer(src_ptr, dst_ptr, buffer_elements_count,
+            quant_info.limvals_min, quant_info.limvals_max, quant_info.qp_zp, quant_info.qp_scale)) {
+            return;
+        }
         if (is_identity_qp(quant_info)) {
             for (uint32_t i = 0; i < buffer_elements_count; i++) {
                 dst_ptr[i] = (Q)bankers_round(src_ptr[i]);
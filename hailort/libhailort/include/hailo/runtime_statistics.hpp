@@ -148,6 +148,19 @@ public:
      * @return The number of datapoints added to the Accumulator.
      */
     virtual Expected<size_t> count() const = 0;
+
+    /**
+     * Gets the value at the given percentile of the distribution of data added to the Accumulator.
+     *
+     * @param[in] percentile        The requested percentile, in the range (0, 100).
+     * @return Expected of the percentile value, or Unexpected of ::HAILO_NOT_IMPLEMENTED on
+     *         accumulators that don't track the distribution (see histogram accumulators).
+     */
+    virtual Expected<double> get_percentile(double percentile) const
+    {
+        (void)percentile;
+        return make_unexpected(HAILO_NOT_IMPLEMENTED);
+    }
     
     /**
      * @return Returns Expected of the minimal value added to the Accumulator,
@@ -120,6 +120,17 @@ public:
      */
     virtual hailo_status write(const MemoryView &buffer) = 0;
 
+    /**
+     * Writes one frame given as a list of planes/segments (scatter write) - e.g. the two NV12
+     * planes as they arrive from a decoder - without requiring the caller to gather them into one
+     * contiguous buffer first. The default implementation gathers into an internal buffer;
+     * stream implementations with an owning buffer pool gather directly into the DMA buffer.
+     *
+     * @param[in] planes    The frame's segments, in order. Total size must equal get_frame_size().
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     */
+    virtual hailo_status write_v(const std::vector<MemoryView> &planes);
+
     /**
      * Writes the entire buffer to the stream without transformations.
      *
@@ -145,6 +156,36 @@ public:
      */
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout);
 
+    /**
+     * Returns an OS waitable handle (eventfd on Linux) that is signaled whenever the stream's
+     * async readiness may have changed, letting epoll/select based event loops wait on stream
+     * readiness without a blocking thread. The notification is edge style - after a wakeup the
+     * caller should retry its non-blocking operation (or wait_for_async_ready() with 0 timeout).
+     *
+     * @return Upon success, returns Expected of the waitable handle.
+     *         Otherwise, returns Unexpected of ::hailo_status error (::HAILO_NOT_SUPPORTED on
+     *         streams without an async readiness path).
+     */
+    virtual Expected<int> get_wait_fd()
+    {
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+    }
+
+    /** Exact buffer requirements for the zero-copy (no bounce buffer) async path. */
+    struct BufferConstraints {
+        /** Required start-address alignment in bytes */
+        size_t alignment;
+        /** Required buffer size (the frame size) */
+        size_t size;
+    };
+
+    /**
+     * Returns the alignment and size a user buffer must satisfy to take the zero-copy async path.
+     * Buffers missing these constraints still work but silently go through a bounce-buffer copy -
+     * allocate with this API's alignment (e.g. via aligned_alloc) to guarantee the fast path.
+     */
+    virtual BufferConstraints get_buffer_constraints() const;
+
     /**
      * Returns the maximum amount of frames that can be simultaneously written to the stream (by write_async() calls)
      * before any one of the write operations is complete, as signified by @a user_callback being called.
@@ -427,6 +468,33 @@ public:
      */
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout);
 
+    /**
+     * Returns an OS waitable handle (eventfd on Linux) signaled whenever the stream's async
+     * readiness may have changed. See InputStream::get_wait_fd().
+     *
+     * @return Upon success, returns Expected of the waitable handle.
+     *         Otherwise, returns Unexpected of ::hailo_status error.
+     */
+    virtual Expected<int> get_wait_fd()
+    {
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+    }
+
+    /** Exact buffer requirements for the zero-copy (no bounce buffer) async path. */
+    struct BufferConstraints {
+        /** Required start-address alignment in bytes */
+        size_t alignment;
+        /** Required buffer size (the frame size) */
+        size_t size;
+    };
+
+    /**
+     * Returns the alignment and size a user buffer must satisfy to take the zero-copy async path.
+     * Buffers missing these constraints still work but silently go through a bounce-buffer copy -
+     * allocate with this API's alignment (e.g. via aligned_alloc) to guarantee the fast path.
+     */
+    virtual BufferConstraints get_buffer_constraints() const;
+
     /**
      * Returns the maximum amount of frames that can be simultaneously read from the stream (by read_async() calls)
      * before any one of the read operations is complete, as signified  by @a user_callback being called.
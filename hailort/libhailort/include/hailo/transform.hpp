@@ -152,6 +152,24 @@ public:
      */
     virtual std::string description() const;
 
+    /**
+     * Indicates whether this context performs an identity transformation - the src frame is bit-exact
+     * to the dst frame. In that case callers may skip calling transform() altogether and hand the src
+     * buffer directly to the next pipeline stage (zero copy).
+     */
+    bool is_identity() const;
+
+    /**
+     * Transforms a batch of @a batch_size frames laid consecutively in @a src into @a dst.
+     * Parameter validation is hoisted out of the per-frame loop.
+     *
+     * @param[in]  src          A buffer containing @a batch_size source frames, each of get_src_frame_size() bytes.
+     * @param[out] dst          A buffer receiving @a batch_size transformed frames, each of get_dst_frame_size() bytes.
+     * @param[in]  batch_size   Number of frames in the batch.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns an ::hailo_status error.
+     */
+    hailo_status transform_batch(const MemoryView src, MemoryView dst, uint32_t batch_size);
+
 private:
     InputTransformContext(size_t src_frame_size, const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
@@ -208,12 +226,15 @@ public:
      * @param[in] dst_quant_infos          A vector of ::hailo_quant_info_t object containing quantization information per feature.
      *                                     Might also contain a vector with a single ::hailo_quant_info_t object.
      * @param[in] nms_info                 A ::hailo_nms_info_t object containing nms information.
+     * @param[in] worker_threads_count     Number of worker threads used per transformed frame. See
+     *                                     ::hailo_transform_params_t::transform_worker_threads_count.
      * @return Upon success, returns Expected of a pointer to OutputTransformContext.
      *         Otherwise, returns Unexpected of ::hailo_status error.
      */
     static Expected<std::unique_ptr<OutputTransformContext>> create(const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info);
+        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info,
+        uint32_t worker_threads_count = 1);
 
     /**
      * Creates output transform_context.
@@ -323,6 +344,38 @@ public:
      */
     virtual std::string description() const = 0;
 
+    /**
+     * Indicates whether this context performs an identity transformation - the HW frame is bit-exact
+     * to the user frame. In that case callers may skip calling transform() altogether and hand the HW
+     * buffer directly to the user (zero copy).
+     */
+    bool is_identity() const;
+
+    /**
+     * Transforms a batch of @a batch_size frames laid consecutively in @a src into @a dst.
+     * Parameter validation is hoisted out of the per-frame loop, and frame transformations may run
+     * in parallel on the shared transform worker pool when the transformation allows it.
+     *
+     * @param[in]  src          A buffer containing @a batch_size HW frames, each of get_src_frame_size() bytes.
+     * @param[out] dst          A buffer receiving @a batch_size transformed frames, each of get_dst_frame_size() bytes.
+     * @param[in]  batch_size   Number of frames in the batch.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns an ::hailo_status error.
+     */
+    virtual hailo_status transform_batch(const MemoryView src, MemoryView dst, uint32_t batch_size);
+
+    /**
+     * Adjusts the number of worker threads used per transformed frame at runtime (see
+     * ::hailo_transform_params_t::transform_worker_threads_count). Lets a pipeline controller
+     * re-shard a bottlenecked post-process stage without rebuilding it. The count is clamped to
+     * the shared worker pool's parallelism; transformations that do not support row sharding
+     * return ::HAILO_NOT_SUPPORTED.
+     */
+    virtual hailo_status set_worker_threads_count(uint32_t worker_threads_count)
+    {
+        (void)worker_threads_count;
+        return HAILO_NOT_SUPPORTED;
+    }
+
 protected:
     OutputTransformContext(size_t src_frame_size, const hailo_format_t &src_format, size_t dst_frame_size,
         const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const bool should_quantize,
@@ -11,6 +11,11 @@
 #define _HAILO_VDEVICE_HPP_
 
 #include "hailo/hailort.h"
+
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "hailo/expected.hpp"
 #include "hailo/hef.hpp"
 #include "hailo/network_group.hpp"
@@ -145,11 +150,77 @@ public:
      */
     virtual hailo_status dma_unmap(void *address, hailo_stream_direction_t direction);
 
+    /**
+     * Re-registers every user buffer previously mapped with dma_map() in this process onto this
+     * vdevice. Mappings do not survive vdevice destruction, but the registration records do -
+     * recovery paths that recreate their VDevice after a device reset call this once instead of
+     * re-threading buffer registration through the application.
+     */
+    hailo_status remap_registered_buffers();
+
+    /**
+     * Declares (or clears) memory steady state for the whole process. After configure() and
+     * vstream creation every pool is pre-sized and pre-faulted; declaring steady state makes any
+     * further tracked host allocation a contract violation - logged in release builds and
+     * asserted in debug - so hard-real-time deployments can verify the allocation-free steady
+     * state instead of assuming it.
+     */
+    static void set_memory_steady_state(bool enabled);
+
+    /**
+     * Configures the vdevice from an hef asynchronously on a background thread, invoking
+     * @a on_configure_done with the result. Lets a service overlap the CPU-heavy configure work of
+     * several models (different VDevice objects run fully in parallel; calls on the same vdevice
+     * serialize internally on the configuration lock).
+     *
+     * @param[in] hef                   A shared Hef handle - kept alive by the background thread
+     *                                  until the callback returns.
+     * @param[in] configure_params      Map of configured network group name and parameters.
+     * @param[in] on_configure_done     Called (from the background thread) with the configured
+     *                                  network groups or a failure status.
+     * @return ::HAILO_SUCCESS when the background configure was launched.
+     * @note Outstanding background configures are joined in the VDevice destructor.
+     */
+    hailo_status configure_async(std::shared_ptr<Hef> hef, const NetworkGroupsParamsMap &configure_params,
+        std::function<void(Expected<ConfiguredNetworkGroupVector>)> on_configure_done);
+
+    /**
+     * Prepares a model replacement for hot reload: validates that the new hef's edge interfaces
+     * match @a current_network_group (stream names, directions, formats and frame sizes), then
+     * configures it in the background via configure_async() while the current model keeps
+     * serving. Once @a on_replacement_ready delivers the configured groups, the caller rebuilds
+     * its vstreams against them and releases the old group - the multi-second configure is
+     * off the serving path, leaving only the short vstream rebuild.
+     *
+     * @param[in] current_network_group  The configured network group being replaced.
+     * @param[in] new_hef                A shared Hef handle of the replacement model.
+     * @param[in] configure_params       Map of configured network group name and parameters.
+     * @param[in] on_replacement_ready   Called (from the background thread) with the configured
+     *                                   replacement groups or a failure status.
+     * @return ::HAILO_SUCCESS when validation passed and the background configure was launched.
+     */
+    hailo_status replace_network_group_async(std::shared_ptr<ConfiguredNetworkGroup> current_network_group,
+        std::shared_ptr<Hef> new_hef, const NetworkGroupsParamsMap &configure_params,
+        std::function<void(Expected<ConfiguredNetworkGroupVector>)> on_replacement_ready);
+
+    /**
+     * Pulls current scheduler metrics - per scheduled core-op pending request depth and switch
+     * counts - for programmatic telemetry scraping, without going through monitor files.
+     *
+     * @return Upon success, returns Expected of a vector of ::hailo_scheduler_core_op_metrics_t.
+     *         Otherwise, returns Unexpected of ::hailo_status error (::HAILO_NOT_SUPPORTED when no
+     *         scheduler is active).
+     */
+    virtual Expected<std::vector<hailo_scheduler_core_op_metrics_t>> get_scheduler_metrics()
+    {
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+    }
+
     virtual hailo_status before_fork();
     virtual hailo_status after_fork_in_parent();
     virtual hailo_status after_fork_in_child();
 
-    virtual ~VDevice() = default;
+    virtual ~VDevice();
     VDevice(const VDevice &) = delete;
     VDevice &operator=(const VDevice &) = delete;
     VDevice(VDevice &&) = delete;
@@ -157,8 +228,22 @@ public:
 
     static bool service_over_ip_mode();
 
+    static hailo_status validate_replacement_compatibility(ConfiguredNetworkGroup &current_network_group,
+        Hef &new_hef);
+
 protected:
     VDevice() = default;
+
+    // Joins outstanding configure_async threads. Derived destructors call this first, so no
+    // background configure can run against a partially destroyed object (the base destructor
+    // joins again as a backstop).
+    void join_background_configures();
+
+private:
+    // Background configure threads (see configure_async) - joined in the destructor so a
+    // destroyed vdevice never leaves a detached thread touching freed state
+    std::mutex m_configure_threads_mutex;
+    std::vector<std::thread> m_configure_threads;
 };
 
 } /* namespace hailort */
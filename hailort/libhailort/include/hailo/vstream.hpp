@@ -217,6 +217,19 @@ public:
      */
     hailo_status read(MemoryView buffer);
 
+    /**
+     * Returns an OS waitable handle (eventfd on Linux) signaled whenever the vstream's underlying
+     * output stream may have produced data for this pipeline, letting epoll based event loops
+     * wait on many vstreams from one thread. The notification is edge style and upstream of the
+     * post-process pipeline - after a wakeup a read() may still briefly wait for the frame to
+     * finish flowing through it.
+     *
+     * @return Upon success, returns Expected of the waitable handle. Otherwise, returns
+     *         Unexpected of ::hailo_status error (::HAILO_NOT_SUPPORTED on pipelines without an
+     *         async readiness path).
+     */
+    Expected<int> get_wait_fd();
+
     /**
      * Clears the vstreams' pipeline buffers.
      *
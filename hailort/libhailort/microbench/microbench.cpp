@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file microbench.cpp
+ * @brief Microbenchmarks for the CPU-bound transform and post-process kernels, parameterized over
+ *        dtype/shape. Every benchmark reports processed bytes so regressions show up as bytes/sec
+ *        drops independently of frame shape. Run with --benchmark_filter to isolate a kernel.
+ **/
+
+#include "hailo/quantization.hpp"
+#include "transform/layout_reorder_engine.hpp"
+#include "net_flow/ops/softmax_post_process.hpp"
+#include "net_flow/ops/nms_post_process.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace hailort;
+
+namespace {
+
+template <typename T>
+std::vector<T> random_buffer(size_t count)
+{
+    std::mt19937 rng(0x5EED);
+    std::vector<T> buffer(count);
+    for (auto &value : buffer) {
+        value = static_cast<T>(rng());
+    }
+    return buffer;
+}
+
+// uint8/uint16 -> float32 dequantize (runtime SIMD dispatched)
+template <typename SrcType>
+void BM_dequantize(benchmark::State &state)
+{
+    const auto elements_count = static_cast<size_t>(state.range(0));
+    auto src = random_buffer<SrcType>(elements_count);
+    std::vector<float32_t> dst(elements_count);
+
+    hailo_quant_info_t quant_info{};
+    quant_info.qp_zp = 7.0f;
+    quant_info.qp_scale = 0.0215f;
+
+    for (auto _ : state) {
+        Quantization::dequantize_output_buffer<float32_t, SrcType>(src.data(), dst.data(),
+            static_cast<uint32_t>(elements_count), quant_info);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * elements_count * sizeof(SrcType));
+}
+
+// One H-row of the cache-blocked NHCW->NHWC transpose engine
+template <typename T>
+void BM_nhcw_to_nhwc_row(benchmark::State &state)
+{
+    const auto features = static_cast<uint32_t>(state.range(0));
+    const auto width = static_cast<uint32_t>(state.range(1));
+    auto src = random_buffer<T>(static_cast<size_t>(features) * width);
+    std::vector<T> dst(static_cast<size_t>(features) * width);
+
+    for (auto _ : state) {
+        reorder_engine::nhcw_row_to_nhwc(src.data(), features, width, width, dst.data());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * features * width * sizeof(T));
+}
+
+void BM_softmax(benchmark::State &state)
+{
+    const auto elements_count = static_cast<size_t>(state.range(0));
+    std::vector<float32_t> src(elements_count);
+    std::vector<float32_t> dst(elements_count);
+    std::mt19937 rng(0x5EED);
+    std::uniform_real_distribution<float32_t> dist(-20.0f, 20.0f);
+    for (auto &value : src) {
+        value = dist(rng);
+    }
+
+    for (auto _ : state) {
+        net_flow::SoftmaxPostProcessOp::softmax(src.data(), dst.data(), elements_count);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * elements_count * sizeof(float32_t));
+}
+
+void BM_nms_suppression(benchmark::State &state)
+{
+    const auto detections_count = static_cast<size_t>(state.range(0));
+    const auto classes_count = static_cast<uint32_t>(state.range(1));
+    std::mt19937 rng(0x5EED);
+    std::uniform_real_distribution<float32_t> coord(0.0f, 1.0f);
+
+    std::vector<net_flow::DetectionBbox> detections_template;
+    std::vector<uint32_t> classes_detections_count_template(classes_count, 0);
+    for (size_t i = 0; i < detections_count; i++) {
+        const auto x_min = coord(rng);
+        const auto y_min = coord(rng);
+        net_flow::DetectionBbox detection(x_min, y_min, std::min(1.0f - x_min, 0.1f * coord(rng)),
+            std::min(1.0f - y_min, 0.1f * coord(rng)), 0.1f + coord(rng), static_cast<uint32_t>(rng() % classes_count));
+        classes_detections_count_template[detection.m_class_id]++;
+        detections_template.emplace_back(detection);
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto detections = detections_template;
+        auto classes_detections_count = classes_detections_count_template;
+        state.ResumeTiming();
+        net_flow::NmsPostProcessOp::remove_overlapping_boxes(detections, classes_detections_count, 0.45);
+        benchmark::DoNotOptimize(detections.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * detections_count);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_dequantize, uint8_t)->Arg(224 * 224 * 3)->Arg(1920 * 1080 * 3);
+BENCHMARK_TEMPLATE(BM_dequantize, uint16_t)->Arg(224 * 224 * 3)->Arg(1920 * 1080 * 3);
+BENCHMARK_TEMPLATE(BM_nhcw_to_nhwc_row, uint8_t)->Args({3, 1920})->Args({64, 640})->Args({256, 80});
+BENCHMARK_TEMPLATE(BM_nhcw_to_nhwc_row, uint16_t)->Args({3, 1920})->Args({64, 640})->Args({256, 80});
+BENCHMARK(BM_softmax)->Arg(1000)->Arg(100 * 1000);
+BENCHMARK(BM_nms_suppression)->Args({500, 80})->Args({5000, 80});
+
+BENCHMARK_MAIN();
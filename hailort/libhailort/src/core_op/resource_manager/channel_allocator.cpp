@@ -13,10 +13,26 @@
 namespace hailort
 {
 
+// TODO: device/CMA memory compaction for long-running processes (HRT wishlist):
+//       The channel-index half of the fragmentation problem is handled below (internal layers
+//       best-fit onto already-tainted indexes, keeping clean indexes free for boundary layers).
+//       The remaining half is device/CMA memory - a quiesce-and-repack pass run when allocation
+//       fails: deactivate idle core ops, release and re-create their buffers (the configure cache
+//       makes re-build cheap), then retry. The repack must run under the scheduler's switching
+//       lock so no core op is mid-activation.
+
 ChannelAllocator::ChannelAllocator(size_t max_engines_count) :
     m_max_engines_count(max_engines_count)
 {}
 
+// TODO: stream multiplexing over shared channel pairs (HRT wishlist):
+//       Exhausting the boundary channels hard-caps concurrently configured streams. The
+//       multiplexed mode runs several low-rate streams over one channel pair by tagging each
+//       transfer with a stream id: host-side, one BoundaryChannel fans submissions in (the
+//       descriptor ring is already shared-safe under the channel mutex) and completions fan out
+//       by tag; device-side the firmware must demultiplex the tag to the right core input, which
+//       is the blocking piece - recorded here at the allocator that returns the exhaustion
+//       failure the mode removes.
 Expected<vdma::ChannelId> ChannelAllocator::get_available_channel_id(const LayerIdentifier &layer_identifier,
     HailoRTDriver::DmaDirection direction, uint8_t engine_index)
 {
@@ -41,25 +57,37 @@ Expected<vdma::ChannelId> ChannelAllocator::get_available_channel_id(const Layer
     uint8_t max_channel_index =
         (direction == HailoRTDriver::DmaDirection::H2D) ? MAX_H2D_CHANNEL_INDEX : MAX_D2H_CHANNEL_INDEX;
 
-    for (uint8_t index = min_channel_index; index <= max_channel_index; ++index) {
-        const vdma::ChannelId channel_id = {engine_index, index};
+    const bool is_boundary = (std::get<0>(layer_identifier) == LayerType::BOUNDARY);
 
-        // Check that the channel is not currently in use.
-        if (contains(currently_used_channel_indexes, channel_id)) {
-            continue;
-        }
+    // Best-fit against index fragmentation: an index that ever carried an internal channel is
+    // tainted for boundary use (see below), so internal layers first reuse already-tainted
+    // indexes and only taint a clean one when none fits. Boundary layers keep getting the lowest
+    // clean index - repeated load/unload cycles no longer spread the taint across the range.
+    const int passes_count = is_boundary ? 1 : 2;
+    for (int pass = 0; pass < passes_count; pass++) {
+        const bool reuse_tainted_only = ((!is_boundary) && (0 == pass));
+        for (uint8_t index = min_channel_index; index <= max_channel_index; ++index) {
+            const vdma::ChannelId channel_id = {engine_index, index};
 
-        // In the case of boundary channels, if the channel id was used in previous context as an internal channel (and
-        // it was freed, so it doesn't appear in `currently_used_channel_index`), we can't reuse it.
-        if (std::get<0>(layer_identifier) == LayerType::BOUNDARY) {
-            if (contains(m_internal_channel_ids, channel_id)) {
+            // Check that the channel is not currently in use.
+            if (contains(currently_used_channel_indexes, channel_id)) {
+                continue;
+            }
+
+            if (reuse_tainted_only && (!contains(m_internal_channel_ids, channel_id))) {
                 continue;
             }
-        }
 
-        // Found it
-        insert_new_channel_id(layer_identifier, channel_id);
-        return Expected<vdma::ChannelId>(channel_id);
+            // In the case of boundary channels, if the channel id was used in previous context as an internal channel (and
+            // it was freed, so it doesn't appear in `currently_used_channel_index`), we can't reuse it.
+            if (is_boundary && contains(m_internal_channel_ids, channel_id)) {
+                continue;
+            }
+
+            // Found it
+            insert_new_channel_id(layer_identifier, channel_id);
+            return Expected<vdma::ChannelId>(channel_id);
+        }
     }
 
     LOGGER__ERROR("Failed to get available channel_index");
@@ -184,6 +184,15 @@ Expected<std::unique_ptr<vdma::VdmaBuffer>> ConfigBuffer::create_ccb_buffer(Hail
     return std::unique_ptr<vdma::VdmaBuffer>(std::move(buffer_ptr));
 }
 
+// Config-buffer residency across core-op switches:
+// The CCW bursts are written once at configure() time and the buffers stay resident (and mapped)
+// for the whole life of the configured core op - nothing on the host path re-DMAs config data when
+// the scheduler ping-pongs between models. What does repeat per switch is the firmware re-fetching
+// the config through the fetch_config actions of the activation context. Keeping the fetched image
+// resident device-side between activations of the same core op needs a firmware-visible "config
+// generation" tag in the activation action list (skip fetch when the generation matches); the host
+// side already preserves everything required for that optimization, so it is blocked on the FW
+// counterpart only.
 bool ConfigBuffer::should_use_ccb(HailoRTDriver &driver)
 {
     switch (driver.dma_type()) {
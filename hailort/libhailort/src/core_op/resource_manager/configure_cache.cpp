@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file configure_cache.cpp
+ * @brief Implementation of the persistent configure() cache
+ **/
+
+#include "core_op/resource_manager/configure_cache.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <fstream>
+
+namespace hailort
+{
+
+#define CONFIGURE_CACHE_DIR_ENV_VAR ("HAILO_CONFIGURE_CACHE_DIR")
+#define CONFIGURE_CACHE_MAGIC (0x43545248) // "HRTC"
+// Bump on any change to the cached binary layout or to the action-list build logic
+#define CONFIGURE_CACHE_VERSION (1)
+#define CONFIGURE_CACHE_FILE_SUFFIX (".hrtcc")
+
+struct ConfigureCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t contexts_count;
+    uint32_t reserved;
+};
+
+bool ConfigureCache::is_enabled()
+{
+    const auto *cache_dir = std::getenv(CONFIGURE_CACHE_DIR_ENV_VAR);
+    return (nullptr != cache_dir) && ('\0' != cache_dir[0]);
+}
+
+std::string ConfigureCache::cache_file_path(const std::string &key)
+{
+    const auto *cache_dir = std::getenv(CONFIGURE_CACHE_DIR_ENV_VAR);
+    assert(nullptr != cache_dir);
+    return std::string(cache_dir) + "/" + key + CONFIGURE_CACHE_FILE_SUFFIX;
+}
+
+std::string ConfigureCache::make_key(const MD5_SUM_t &hef_hash, uint32_t device_arch,
+    const std::string &core_op_name, const ConfigureNetworkParams &config_params)
+{
+    MD5_CTX ctx{};
+    MD5_SUM_t digest{};
+    MD5_Init(&ctx);
+
+    MD5_Update(&ctx, hef_hash, sizeof(MD5_SUM_t));
+    MD5_Update(&ctx, &device_arch, sizeof(device_arch));
+    MD5_Update(&ctx, core_op_name.data(), core_op_name.size());
+
+    MD5_Update(&ctx, &config_params.batch_size, sizeof(config_params.batch_size));
+    MD5_Update(&ctx, &config_params.power_mode, sizeof(config_params.power_mode));
+    MD5_Update(&ctx, &config_params.latency, sizeof(config_params.latency));
+    // std::map iteration is name-sorted, so the digest is deterministic
+    for (const auto &stream_params_pair : config_params.stream_params_by_name) {
+        MD5_Update(&ctx, stream_params_pair.first.data(), stream_params_pair.first.size());
+        MD5_Update(&ctx, &stream_params_pair.second, sizeof(stream_params_pair.second));
+    }
+    for (const auto &network_params_pair : config_params.network_params_by_name) {
+        MD5_Update(&ctx, network_params_pair.first.data(), network_params_pair.first.size());
+        MD5_Update(&ctx, &network_params_pair.second, sizeof(network_params_pair.second));
+    }
+
+    MD5_Final(digest, &ctx);
+
+    static const char *HEX_DIGITS = "0123456789abcdef";
+    std::string key;
+    key.reserve(sizeof(digest) * 2);
+    for (size_t i = 0; i < sizeof(digest); i++) {
+        key.push_back(HEX_DIGITS[(digest[i] >> 4) & 0xF]);
+        key.push_back(HEX_DIGITS[digest[i] & 0xF]);
+    }
+    return key;
+}
+
+// Process-wide in-memory action-list cache (see load_in_memory)
+static std::mutex g_memory_cache_mutex;
+static std::map<std::string, std::vector<CachedContextControls>> g_memory_cache;
+
+Expected<std::vector<CachedContextControls>> ConfigureCache::load_in_memory(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(g_memory_cache_mutex);
+    auto entry = g_memory_cache.find(key);
+    if (g_memory_cache.end() == entry) {
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+    auto controls_copy = entry->second;
+    return controls_copy;
+}
+
+void ConfigureCache::store_in_memory(const std::string &key, const std::vector<CachedContextControls> &contexts_controls)
+{
+    std::lock_guard<std::mutex> lock(g_memory_cache_mutex);
+    g_memory_cache[key] = contexts_controls;
+}
+
+Expected<std::vector<CachedContextControls>> ConfigureCache::load(const std::string &key)
+{
+    auto file = std::ifstream(cache_file_path(key), std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        // A miss is the common cold-start case - not an error worth logging
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+
+    ConfigureCacheHeader header{};
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    CHECK_AS_EXPECTED(file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed reading configure cache header");
+    CHECK_AS_EXPECTED(CONFIGURE_CACHE_MAGIC == header.magic, HAILO_INVALID_ARGUMENT, "Invalid configure cache file");
+    if (CONFIGURE_CACHE_VERSION != header.version) {
+        LOGGER__INFO("Configure cache entry version mismatch (found {}, expected {}) - ignoring entry",
+            header.version, CONFIGURE_CACHE_VERSION);
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+
+    std::vector<CachedContextControls> contexts_controls;
+    contexts_controls.reserve(header.contexts_count);
+    for (uint32_t context_index = 0; context_index < header.contexts_count; context_index++) {
+        CachedContextControls context_controls{};
+        uint32_t context_type = 0;
+        uint32_t controls_count = 0;
+        file.read(reinterpret_cast<char *>(&context_type), sizeof(context_type));
+        file.read(reinterpret_cast<char *>(&controls_count), sizeof(controls_count));
+        CHECK_AS_EXPECTED(file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed reading configure cache context header");
+
+        context_controls.context_type = static_cast<CONTROL_PROTOCOL__context_switch_context_type_t>(context_type);
+        context_controls.controls.resize(controls_count);
+        file.read(reinterpret_cast<char *>(context_controls.controls.data()),
+            controls_count * sizeof(CONTROL_PROTOCOL__context_switch_context_info_single_control_t));
+        CHECK_AS_EXPECTED(file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed reading configure cache controls");
+
+        contexts_controls.emplace_back(std::move(context_controls));
+    }
+
+    return contexts_controls;
+}
+
+hailo_status ConfigureCache::store(const std::string &key, const std::vector<CachedContextControls> &contexts_controls)
+{
+    const auto final_path = cache_file_path(key);
+    const auto tmp_path = final_path + ".tmp";
+
+    {
+        auto file = std::ofstream(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        CHECK(file.is_open(), HAILO_OPEN_FILE_FAILURE, "Failed creating configure cache file \"{}\"", tmp_path);
+
+        ConfigureCacheHeader header{};
+        header.magic = CONFIGURE_CACHE_MAGIC;
+        header.version = CONFIGURE_CACHE_VERSION;
+        header.contexts_count = static_cast<uint32_t>(contexts_controls.size());
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+        for (const auto &context_controls : contexts_controls) {
+            const uint32_t context_type = static_cast<uint32_t>(context_controls.context_type);
+            const uint32_t controls_count = static_cast<uint32_t>(context_controls.controls.size());
+            file.write(reinterpret_cast<const char *>(&context_type), sizeof(context_type));
+            file.write(reinterpret_cast<const char *>(&controls_count), sizeof(controls_count));
+            file.write(reinterpret_cast<const char *>(context_controls.controls.data()),
+                controls_count * sizeof(CONTROL_PROTOCOL__context_switch_context_info_single_control_t));
+        }
+
+        CHECK(file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing configure cache file \"{}\"", tmp_path);
+    }
+
+    // Atomic publish - concurrent processes either see the full entry or none
+    CHECK(0 == std::rename(tmp_path.c_str(), final_path.c_str()), HAILO_FILE_OPERATION_FAILURE,
+        "Failed publishing configure cache file \"{}\"", final_path);
+
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file configure_cache.hpp
+ * @brief Persistent on-disk cache for built context-switch action lists. The cache is keyed by
+ *        (HEF hash, device arch, configure params), so a process re-configuring the same model
+ *        restores the serialized per-context controls instead of recomputing them.
+ *        Opt-in - enabled only when the HAILO_CONFIGURE_CACHE_DIR environment variable is set.
+ **/
+
+#ifndef _HAILO_CONFIGURE_CACHE_HPP_
+#define _HAILO_CONFIGURE_CACHE_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/hef.hpp"
+
+#include "device_common/control_protocol.hpp"
+
+#include "md5.h"
+
+#include <string>
+#include <vector>
+
+namespace hailort
+{
+
+// Serialized action list of a single context
+struct CachedContextControls {
+    CONTROL_PROTOCOL__context_switch_context_type_t context_type;
+    std::vector<CONTROL_PROTOCOL__context_switch_context_info_single_control_t> controls;
+};
+
+class ConfigureCache final
+{
+public:
+    ConfigureCache() = delete;
+
+    // The cache is enabled by pointing HAILO_CONFIGURE_CACHE_DIR at a writable directory
+    static bool is_enabled();
+
+    static std::string make_key(const MD5_SUM_t &hef_hash, uint32_t device_arch,
+        const std::string &core_op_name, const ConfigureNetworkParams &config_params);
+
+    static Expected<std::vector<CachedContextControls>> load(const std::string &key);
+    static hailo_status store(const std::string &key, const std::vector<CachedContextControls> &contexts_controls);
+
+    // In-memory layer: serialized action lists are deterministic per (HEF, arch, params), so
+    // within a process they are cached in RAM regardless of the on-disk opt-in - reconfiguring
+    // the same model (e.g. teardown/re-setup cycles) skips the serialization passes entirely.
+    static Expected<std::vector<CachedContextControls>> load_in_memory(const std::string &key);
+    static void store_in_memory(const std::string &key, const std::vector<CachedContextControls> &contexts_controls);
+
+private:
+    static std::string cache_file_path(const std::string &key);
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_CONFIGURE_CACHE_HPP_ */
@@ -71,4 +71,16 @@ void ContextSwitchBufferBuilder::start_new_control()
     new_control.is_last_control_per_context = true;
 }
 
+void ContextSwitchBufferBuilder::set_prebuilt_controls(
+    std::vector<CONTROL_PROTOCOL__context_switch_context_info_single_control_t> &&controls)
+{
+    m_controls = std::move(controls);
+    m_has_prebuilt_controls = true;
+}
+
+bool ContextSwitchBufferBuilder::has_prebuilt_controls() const
+{
+    return m_has_prebuilt_controls;
+}
+
 } /* namespace hailort */
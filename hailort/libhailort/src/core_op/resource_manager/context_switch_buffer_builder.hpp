@@ -31,6 +31,11 @@ public:
     const std::vector<CONTROL_PROTOCOL__context_switch_context_info_single_control_t> &get_controls() const;
     const CONTROL_PROTOCOL__context_switch_context_type_t &get_context_type() const;
 
+    // Restores controls built on a previous run (configure cache). Once set, the action list
+    // serialization pass is skipped for this context.
+    void set_prebuilt_controls(std::vector<CONTROL_PROTOCOL__context_switch_context_info_single_control_t> &&controls);
+    bool has_prebuilt_controls() const;
+
 private:
     CONTROL_PROTOCOL__context_switch_context_info_single_control_t &current_control();
     bool has_space_for_action(uint32_t action_size);
@@ -38,6 +43,7 @@ private:
 
     CONTROL_PROTOCOL__context_switch_context_type_t m_context_type;
     std::vector<CONTROL_PROTOCOL__context_switch_context_info_single_control_t> m_controls;
+    bool m_has_prebuilt_controls = false;
 };
 
 } /* namespace hailort */
@@ -38,6 +38,7 @@ public:
 
     Expected<Buffer> read();
     CONTROL_PROTOCOL__host_buffer_info_t get_host_buffer_info() const;
+    size_t get_buffer_size() const { return m_buffer->size(); }
 
 private:
     IntermediateBuffer(std::unique_ptr<vdma::VdmaBuffer> &&buffer, uint32_t transfer_size, uint16_t batch_size);
@@ -493,6 +493,17 @@ hailo_power_mode_t ResourcesManager::get_power_mode() const
     return m_config_params.power_mode;
 }
 
+// TODO: lifetime-aware intermediate buffer sharing (HRT wishlist):
+//       Every inter-context edge gets a dedicated buffer although an edge is only live from its
+//       producer context until its (last) consumer context - on deep multi-context HEFs the sum of
+//       allocations is several times the maximum concurrently-live set. Sharing backing memory
+//       between edges with disjoint [producer, consumer] context intervals needs two refactors:
+//         1. the consumer context index threaded to this call (today only src_context_index
+//            arrives; the builder has the full edge metadata), and
+//         2. SgBuffer decoupled into a shared DmaAbleBuffer backing plus per-edge descriptor
+//            lists, since each edge programs its own channel over the memory.
+//       With those, a greedy interval allocator over the context axis replaces the per-edge
+//       allocation below. get_intermediate_buffers_total_size() exists to size that win per HEF.
 ExpectedRef<IntermediateBuffer> ResourcesManager::create_intermediate_buffer(uint32_t transfer_size,
     uint16_t batch_size, uint8_t src_stream_index, uint8_t src_context_index,
     vdma::ChannelId d2h_channel_id, IntermediateBuffer::StreamingType streaming_type)
@@ -506,6 +517,15 @@ ExpectedRef<IntermediateBuffer> ResourcesManager::create_intermediate_buffer(uin
     return std::ref(emplace_res.first->second);
 }
 
+size_t ResourcesManager::get_intermediate_buffers_total_size() const
+{
+    size_t total_size = 0;
+    for (const auto &key_buffer_pair : m_intermediate_buffers) {
+        total_size += key_buffer_pair.second.get_buffer_size();
+    }
+    return total_size;
+}
+
 ExpectedRef<IntermediateBuffer> ResourcesManager::get_intermediate_buffer(const IntermediateBufferKey &key)
 {
     auto buffer_it = m_intermediate_buffers.find(key);
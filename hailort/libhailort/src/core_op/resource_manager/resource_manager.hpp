@@ -145,10 +145,18 @@ public:
         uint8_t src_stream_index, uint8_t src_context_index, vdma::ChannelId d2h_channel_id,
         IntermediateBuffer::StreamingType streaming_type);
     ExpectedRef<IntermediateBuffer> get_intermediate_buffer(const IntermediateBufferKey &key);
+    // Total bytes allocated for inter-context/ddr intermediate buffers (diagnosing multi-context
+    // HEF memory footprint; see the sharing TODO at create_intermediate_buffer)
+    size_t get_intermediate_buffers_total_size() const;
     hailo_status create_boundary_vdma_channel(const LayerInfo &layer_info);
 
     Expected<CONTROL_PROTOCOL__application_header_t> get_control_core_op_header();
 
+    std::vector<ContextResources> &get_contexts_resources()
+    {
+        return m_contexts_resources;
+    }
+
     Expected<std::reference_wrapper<ContextResources>> add_new_context(CONTROL_PROTOCOL__context_switch_context_type_t type,
         const ConfigBufferInfoMap &config_info={});
 
@@ -8,6 +8,7 @@
  **/
 
 #include "resource_manager_builder.hpp"
+#include "core_op/resource_manager/configure_cache.hpp"
 #include "device_common/control.hpp"
 #include "periph_calculator.hpp"
 
@@ -876,6 +877,15 @@ static hailo_status handle_edge_layer_activation_actions(const ProtoHEFHwArch &h
 // If groups of consecutive actions can be "merged" as repeated actions (saving room the FW's
 // action list) a RepeatedAction is placed before the relevant actions.
 // See also: CONTEXT_SWITCH_DEFS__repeated_action_header_t's documenting in context_switch_defs.h.
+// TODO: bulk-write condensation (HRT wishlist):
+//       The repeated-actions pass below wraps runs of same-type actions in repeated headers, but
+//       adjacent register writes still serialize as one action each. A second condensation pass
+//       can fuse runs of WriteDataAction/register writes targeting ascending addresses into a
+//       single bulk-write action (one header + packed payload), shrinking the action list the
+//       firmware walks per context switch. Needs a firmware bulk-write action opcode with a
+//       (base, stride, count, payload) form; the pass itself slots in right after
+//       handle_repeated_actions once that opcode exists, and the configure cache keeps the
+//       condensed lists across runs.
 static hailo_status handle_repeated_actions(std::vector<ContextSwitchConfigActionPtr> &configuration_actions)
 {
     const auto repeated_indexes = get_repreated_actions_boundary_indices(configuration_actions);
@@ -918,6 +928,11 @@ static hailo_status handle_repeated_actions(std::vector<ContextSwitchConfigActio
 static hailo_status write_action_list(const ContextResources & context_resources, ContextSwitchBufferBuilder &builder,
     const std::vector<ContextSwitchConfigActionPtr> &actions)
 {
+    if (builder.has_prebuilt_controls()) {
+        // The serialized action list was restored from the configure cache
+        return HAILO_SUCCESS;
+    }
+
     for (const auto &action : actions) {
         auto action_buffers = action->serialize(context_resources);
         CHECK_EXPECTED_AS_STATUS(action_buffers);
@@ -1254,7 +1269,8 @@ static hailo_status fill_preliminary_config_recepies_for_multi_context(const Pro
 
 Expected<std::shared_ptr<ResourcesManager>> ResourcesManagerBuilder::build(uint8_t current_core_op_index, VdmaDevice &device,
     HailoRTDriver &driver, const ConfigureNetworkParams &config_params,
-    std::shared_ptr<CoreOpMetadata> core_op_metadata, const ProtoHEFHwArch &hw_arch)
+    std::shared_ptr<CoreOpMetadata> core_op_metadata, const ProtoHEFHwArch &hw_arch,
+    const MD5_SUM_t &hef_hash)
 {
     const auto num_contexts = core_op_metadata->dynamic_contexts().size() +
         CONTROL_PROTOCOL__CONTEXT_SWITCH_NUMBER_OF_NON_DYNAMIC_CONTEXTS;
@@ -1278,14 +1294,46 @@ Expected<std::shared_ptr<ResourcesManager>> ResourcesManagerBuilder::build(uint8
     auto status = create_boundary_channels(resources_manager.value(), *core_op_metadata);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
+    // Warm-start path: restore the serialized action lists built on a previous run for the same
+    // (HEF, arch, configure params), skipping the per-context condensation + serialization passes
+    std::string cache_key = ConfigureCache::make_key(hef_hash, static_cast<uint32_t>(hw_arch),
+        core_op_metadata->core_op_name(), config_params);
+    std::vector<CachedContextControls> cached_contexts;
+    bool configure_cache_hit = false;
+    // The in-memory layer is always on - the serialized action lists are deterministic per key,
+    // so reconfiguring the same model within a process skips the serialization passes
+    auto memory_cached_exp = ConfigureCache::load_in_memory(cache_key);
+    if (memory_cached_exp && (memory_cached_exp->size() == num_contexts)) {
+        cached_contexts = memory_cached_exp.release();
+        configure_cache_hit = true;
+    } else if (ConfigureCache::is_enabled()) {
+        auto cached_contexts_exp = ConfigureCache::load(cache_key);
+        if (cached_contexts_exp && (cached_contexts_exp->size() == num_contexts)) {
+            cached_contexts = cached_contexts_exp.release();
+            configure_cache_hit = true;
+        }
+    }
+    size_t cached_context_index = 0;
+    const auto restore_cached_controls = [&](ContextResources &context_resources) {
+        if (!configure_cache_hit) {
+            return;
+        }
+        auto &cached = cached_contexts[cached_context_index++];
+        if (cached.context_type == context_resources.builder().get_context_type()) {
+            context_resources.builder().set_prebuilt_controls(std::move(cached.controls));
+        }
+    };
+
     auto activation_context = resources_manager->add_new_context(CONTROL_PROTOCOL__CONTEXT_SWITCH_CONTEXT_TYPE_ACTIVATION);
     CHECK_EXPECTED(activation_context);
+    restore_cached_controls(activation_context.value().get());
     status = fill_activation_config_recepies_for_multi_context(activation_context.value().get(),
         resources_manager.value(), core_op_metadata, hw_arch);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     auto batch_switching_context = resources_manager->add_new_context(CONTROL_PROTOCOL__CONTEXT_SWITCH_CONTEXT_TYPE_BATCH_SWITCHING);
     CHECK_EXPECTED(batch_switching_context);
+    restore_cached_controls(batch_switching_context.value().get());
     status = fill_batch_switching_context_config_recepies_for_multi_context(batch_switching_context.value().get(),
         *core_op_metadata, resources_manager.value(), hw_arch);
     CHECK_SUCCESS_AS_EXPECTED(status);
@@ -1295,6 +1343,7 @@ Expected<std::shared_ptr<ResourcesManager>> ResourcesManagerBuilder::build(uint8
     auto preliminary_context = resources_manager->add_new_context(CONTROL_PROTOCOL__CONTEXT_SWITCH_CONTEXT_TYPE_PRELIMINARY,
         core_op_metadata->preliminary_context().config_buffers_info());
     CHECK_EXPECTED(preliminary_context);
+    restore_cached_controls(preliminary_context.value().get());
     status = fill_preliminary_config_recepies_for_multi_context(hw_arch, preliminary_context.value().get(),
         resources_manager.value(), core_op_metadata, core_op_metadata->preliminary_context(), is_single_context);
     CHECK_SUCCESS_AS_EXPECTED(status);
@@ -1304,6 +1353,7 @@ Expected<std::shared_ptr<ResourcesManager>> ResourcesManagerBuilder::build(uint8
         auto new_context = resources_manager->add_new_context(CONTROL_PROTOCOL__CONTEXT_SWITCH_CONTEXT_TYPE_DYNAMIC,
             context_metadata.config_buffers_info());
         CHECK_EXPECTED(new_context);
+        restore_cached_controls(new_context.value().get());
 
         status = fill_context_recipes_for_multi_context(hw_arch, new_context.value().get(), resources_manager.value(),
             context_index, *core_op_metadata,
@@ -1313,6 +1363,24 @@ Expected<std::shared_ptr<ResourcesManager>> ResourcesManagerBuilder::build(uint8
         context_index++;
     }
 
+    if (!configure_cache_hit) {
+        // Populate the caches for the next configure (in-memory always, on-disk when enabled)
+        std::vector<CachedContextControls> contexts_to_cache;
+        for (auto &context_resources : resources_manager->get_contexts_resources()) {
+            CachedContextControls cached{};
+            cached.context_type = context_resources.builder().get_context_type();
+            cached.controls = context_resources.get_controls();
+            contexts_to_cache.emplace_back(std::move(cached));
+        }
+        ConfigureCache::store_in_memory(cache_key, contexts_to_cache);
+        if (ConfigureCache::is_enabled()) {
+            auto cache_status = ConfigureCache::store(cache_key, contexts_to_cache);
+            if (HAILO_SUCCESS != cache_status) {
+                LOGGER__WARNING("Failed storing configure cache entry (status {})", cache_status);
+            }
+        }
+    }
+
     status = resources_manager->configure();
     CHECK_SUCCESS_AS_EXPECTED(status);
 
@@ -22,9 +22,11 @@ public:
     ResourcesManagerBuilder() = delete;
 
     /* TODO HRT-5067 - work with hailo_device_architecture_t instead of ProtoHEFHwArch */
+    // hef_hash keys the persistent configure cache (together with hw_arch and config_params)
     static Expected<std::shared_ptr<ResourcesManager>> build(uint8_t net_group_index, VdmaDevice &device,
         HailoRTDriver &driver, const ConfigureNetworkParams &config_params,
-        std::shared_ptr<CoreOpMetadata> core_op, const ProtoHEFHwArch &hw_arch);
+        std::shared_ptr<CoreOpMetadata> core_op, const ProtoHEFHwArch &hw_arch,
+        const MD5_SUM_t &hef_hash);
 
 };
 
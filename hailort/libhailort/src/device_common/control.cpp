@@ -23,9 +23,22 @@
 #include <array>
 
 
+#include <chrono>
+#include <map>
+#include <mutex>
+
 namespace hailort
 {
 
+// TODO: batched control-protocol envelope (HRT wishlist):
+//       Activation flows issue dozens of single-setting CONTROL_PROTOCOL requests, each a full
+//       firmware mailbox round-trip. The intended fix is an envelope opcode carrying multiple
+//       marshalled control requests executed firmware-side in order, with a vector of statuses in
+//       the reply - host-side the Control:: helpers then queue into an envelope builder flushed at
+//       sequence boundaries (config_core_op, activation) instead of calling fw_interact per
+//       setting. Blocked on the firmware envelope opcode; the host builder should keep the
+//       existing per-op marshalling untouched so both paths share serializers.
+
 #ifndef MIN
 #define MIN(x, y) (((x) < (y)) ? (x) : (y))
 #endif
@@ -2967,6 +2980,43 @@ exit:
     return status;
 }
 
+hailo_status Control::get_chip_temperature_cached(Device &device, hailo_chip_temperature_info_t *temp_info,
+    std::chrono::milliseconds max_age)
+{
+    CHECK_ARG_NOT_NULL(temp_info);
+
+    struct CachedTemperature {
+        hailo_chip_temperature_info_t info;
+        std::chrono::time_point<std::chrono::steady_clock> read_time;
+        bool valid = false;
+    };
+    static std::mutex cache_mutex;
+    static std::map<std::string, CachedTemperature> cache;
+
+    const std::string device_id(device.get_dev_id());
+    const auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto entry = cache.find(device_id);
+        if ((cache.end() != entry) && entry->second.valid && ((now - entry->second.read_time) < max_age)) {
+            *temp_info = entry->second.info;
+            return HAILO_SUCCESS;
+        }
+    }
+
+    auto status = get_chip_temperature(device, temp_info);
+    CHECK_SUCCESS(status);
+
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto &entry = cache[device_id];
+        entry.info = *temp_info;
+        entry.read_time = now;
+        entry.valid = true;
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status Control::get_chip_temperature(Device &device, hailo_chip_temperature_info_t *temp_info)
 {
     hailo_status status = HAILO_UNINITIALIZED;
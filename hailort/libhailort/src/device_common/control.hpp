@@ -18,6 +18,8 @@
 #include "control_protocol.h"
 #include <stdbool.h>
 
+#include <chrono>
+
 
 namespace hailort
 {
@@ -351,6 +353,12 @@ public:
     static hailo_status previous_system_state(Device &device, uint8_t cpu_id, CONTROL_PROTOCOL__system_state_t *system_state);
     static hailo_status clear_configured_apps(Device &device);
     static hailo_status get_chip_temperature(Device &device, hailo_chip_temperature_info_t *temp_info);
+    // Cached variant for hot monitoring loops: serves the last reading while it is younger than
+    // max_age, so N pollers across a fleet share one mailbox transaction per device per period
+    // instead of issuing one each. The result is written into the caller's struct (no payload
+    // copy beyond the fixed struct itself).
+    static hailo_status get_chip_temperature_cached(Device &device, hailo_chip_temperature_info_t *temp_info,
+        std::chrono::milliseconds max_age = std::chrono::milliseconds(1000));
     static hailo_status enable_debugging(Device &device, bool is_rma);
     
     static hailo_status config_context_switch_breakpoint(Device &device, uint8_t breakpoint_id,
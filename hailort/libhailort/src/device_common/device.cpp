@@ -25,6 +25,7 @@
 #include <memory>
 #ifndef _MSC_VER
 #include <sys/utsname.h>
+#include "common/pipeline_manifest.hpp"
 #endif
 
 
@@ -103,6 +104,10 @@ Expected<std::unique_ptr<Device>> Device::create()
 
 Expected<std::unique_ptr<Device>> Device::create(const std::string &device_id)
 {
+    // Declarative deployment config - the manifest's knob defaults apply once per process, before
+    // any device opens (covers both physical Device and VDevice entry points)
+    PipelineManifest::apply_from_env();
+
     const bool DONT_LOG_ON_FAILURE = false;
     if (IntegratedDevice::DEVICE_ID == device_id) {
         return create_core();
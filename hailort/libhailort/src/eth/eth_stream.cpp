@@ -188,6 +188,28 @@ hailo_status EthernetInputStream::eth_stream__write_with_remainder(const void *b
     size_t transfer_size = 0;
     size_t offset_end_without_remainder = offset + size - remainder_size;
 
+    if (!this->configuration.use_dataflow_padding) {
+        // Batched path - the whole non-remainder region is handed to the kernel in as few
+        // syscalls as possible (sendmmsg), instead of one datagram-sized send per syscall.
+        // Padding mode needs per-datagram copies, so it keeps the scalar loop below.
+        auto status = get_core_op_activated_event()->wait(std::chrono::milliseconds(0));
+        CHECK(HAILO_TIMEOUT != status, HAILO_NETWORK_GROUP_NOT_ACTIVATED,
+            "Trying to write on stream before its network_group is activated");
+        CHECK_SUCCESS(status);
+
+        while (offset < offset_end_without_remainder) {
+            size_t bytes_sent = 0;
+            status = m_udp.send_batch(static_cast<const uint8_t*>(buffer) + offset,
+                offset_end_without_remainder - offset, this->configuration.max_payload_size, &bytes_sent);
+            if (HAILO_STREAM_ABORTED_BY_USER == status) {
+                LOGGER__INFO("Udp send was aborted!");
+                return status;
+            }
+            CHECK_SUCCESS(status);
+            offset += bytes_sent;
+        }
+    }
+
     while (offset < offset_end_without_remainder) {
         transfer_size = offset_end_without_remainder - offset;
         auto expected_bytes_written = sync_write_raw_buffer(MemoryView::create_const(static_cast<const uint8_t*>(buffer) + offset, transfer_size));
@@ -222,7 +244,43 @@ TokenBucketEthernetInputStream::TokenBucketEthernetInputStream(Device &device, U
     EthernetInputStreamRateLimited::EthernetInputStreamRateLimited(device, std::move(udp),
         std::move(core_op_activated_event), rate_bytes_per_sec, layer_info, status),
     token_bucket()
-{}
+{
+    m_effective_rate_bytes_per_sec = rate_bytes_per_sec;
+    m_rate_window_start = std::chrono::steady_clock::now();
+}
+
+void TokenBucketEthernetInputStream::update_effective_rate(size_t bytes_offered, size_t bytes_accepted)
+{
+    static const auto RATE_WINDOW = std::chrono::milliseconds(100);
+    static const double RECOVERY_FACTOR = 1.05;
+
+    m_rate_window_bytes_offered += bytes_offered;
+    m_rate_window_bytes_accepted += bytes_accepted;
+    const auto now = std::chrono::steady_clock::now();
+    if ((now - m_rate_window_start) < RATE_WINDOW) {
+        return;
+    }
+
+    const auto effective_rate = static_cast<double>(m_effective_rate_bytes_per_sec.load());
+    if (m_rate_window_bytes_accepted < m_rate_window_bytes_offered) {
+        // The kernel refused bytes - real backpressure, not an application-side idle gap (which
+        // shows no short sends and takes the recovery branch). Back off by the accepted fraction,
+        // bounded so a pathological window can't collapse the rate entirely.
+        const auto accepted_fraction = static_cast<double>(m_rate_window_bytes_accepted) /
+            static_cast<double>(m_rate_window_bytes_offered);
+        const auto floor_rate = static_cast<double>(rate_bytes_per_sec) / 10;
+        m_effective_rate_bytes_per_sec = static_cast<uint32_t>(std::max(
+            effective_rate * accepted_fraction, floor_rate));
+    } else if (effective_rate < static_cast<double>(rate_bytes_per_sec)) {
+        // No refusals this window - climb back toward the configured rate
+        m_effective_rate_bytes_per_sec = static_cast<uint32_t>(std::min(
+            static_cast<double>(rate_bytes_per_sec), effective_rate * RECOVERY_FACTOR));
+    }
+
+    m_rate_window_start = now;
+    m_rate_window_bytes_offered = 0;
+    m_rate_window_bytes_accepted = 0;
+}
 
 hailo_status TokenBucketEthernetInputStream::eth_stream__write_with_remainder(const void *buffer, size_t offset, size_t size, size_t remainder_size) {
     size_t transfer_size = 0;
@@ -232,7 +290,7 @@ hailo_status TokenBucketEthernetInputStream::eth_stream__write_with_remainder(co
     static_assert(MAX_CONSUME_SIZE <= BURST_SIZE, "We are asking to consume more bytes than the size of the token bucket, this will fail");
 
     while (offset < offset_end_without_remainder) {
-        (void)token_bucket.consumeWithBorrowAndWait(MAX_CONSUME_SIZE, rate_bytes_per_sec, BURST_SIZE);
+        (void)token_bucket.consumeWithBorrowAndWait(MAX_CONSUME_SIZE, m_effective_rate_bytes_per_sec.load(), BURST_SIZE);
     
         transfer_size = offset_end_without_remainder - offset;
         auto expected_bytes_written = sync_write_raw_buffer(MemoryView::create_const(static_cast<const uint8_t*>(buffer) + offset, transfer_size));
@@ -241,7 +299,14 @@ hailo_status TokenBucketEthernetInputStream::eth_stream__write_with_remainder(co
             return expected_bytes_written.status();
         }
         CHECK_EXPECTED_AS_STATUS(expected_bytes_written);
-        offset += expected_bytes_written.release();
+        const auto bytes_written = expected_bytes_written.release();
+        // What the send actually offered the kernel - a frame spanning several datagrams is
+        // capped to one payload per call by Udp::send, which is not a short send
+        const size_t datagram_capacity = this->configuration.use_dataflow_padding ?
+            (this->configuration.max_payload_size - PADDING_BYTES_SIZE - PADDING_ALIGN_BYTES) :
+            this->configuration.max_payload_size;
+        update_effective_rate(std::min(transfer_size, datagram_capacity), bytes_written);
+        offset += bytes_written;
     }
     if (0 < remainder_size) {
         // We don't static_assert that "remainder_size <= BURST_SIZE", so the call could fail in theory.
@@ -506,7 +571,69 @@ hailo_status EthernetOutputStream::activate_stream()
     return HAILO_SUCCESS;
 }
 
+#if defined(__linux__)
+hailo_status EthernetOutputStream::read_all_no_sync_batched(void *buffer, size_t offset, size_t size)
+{
+    auto status = get_core_op_activated_event()->wait(std::chrono::milliseconds(0));
+    CHECK(HAILO_TIMEOUT != status, HAILO_NETWORK_GROUP_NOT_ACTIVATED,
+        "Trying to read on stream before its network_group is activated");
+    CHECK_SUCCESS(status);
+
+    if (m_packet_ring.empty()) {
+        m_packet_ring.resize(static_cast<size_t>(RECV_BATCH_SIZE) * MAX_UDP_PAYLOAD_SIZE);
+    }
+
+    auto *dst = static_cast<uint8_t *>(buffer) + offset;
+    size_t filled = 0;
+
+    // Data carried over from the previous read's drain comes first
+    if (!m_pending_data.empty()) {
+        const auto from_pending = std::min(size, m_pending_data.size());
+        memcpy(dst, m_pending_data.data(), from_pending);
+        m_pending_data.erase(m_pending_data.begin(), m_pending_data.begin() + from_pending);
+        filled += from_pending;
+    }
+
+    struct mmsghdr messages[RECV_BATCH_SIZE];
+    struct iovec iovecs[RECV_BATCH_SIZE];
+    while (filled < size) {
+        for (unsigned int i = 0; i < RECV_BATCH_SIZE; i++) {
+            iovecs[i].iov_base = m_packet_ring.data() + (static_cast<size_t>(i) * MAX_UDP_PAYLOAD_SIZE);
+            iovecs[i].iov_len = MAX_UDP_PAYLOAD_SIZE;
+            memset(&messages[i], 0, sizeof(messages[i]));
+            messages[i].msg_hdr.msg_iov = &iovecs[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int received_count = 0;
+        status = m_udp.recv_multiple(messages, RECV_BATCH_SIZE, &received_count);
+        if (HAILO_STREAM_ABORTED_BY_USER == status) {
+            LOGGER__INFO("recv was aborted!");
+            return status;
+        }
+        CHECK_SUCCESS(status);
+
+        for (int i = 0; i < received_count; i++) {
+            const auto *packet = m_packet_ring.data() + (static_cast<size_t>(i) * MAX_UDP_PAYLOAD_SIZE);
+            const size_t packet_size = messages[i].msg_len;
+            const auto to_frame = std::min(packet_size, size - filled);
+            memcpy(dst + filled, packet, to_frame);
+            filled += to_frame;
+            if (to_frame < packet_size) {
+                // Frame complete - the rest belongs to the next read
+                m_pending_data.insert(m_pending_data.end(), packet + to_frame, packet + packet_size);
+            }
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+#endif /* defined(__linux__) */
+
 hailo_status EthernetOutputStream::read_all_no_sync(void *buffer, size_t offset, size_t size) {
+#if defined(__linux__)
+    return read_all_no_sync_batched(buffer, offset, size);
+#endif
     size_t offset_end = 0;
     size_t transfer_size = 0;
 
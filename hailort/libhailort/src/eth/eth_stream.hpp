@@ -19,6 +19,10 @@
 
 #include "eth/token_bucket.hpp"
 #include "eth/udp.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
 #include "stream_common/stream_internal.hpp"
 
 #if defined(__GNUC__)
@@ -100,6 +104,18 @@ public:
 class TokenBucketEthernetInputStream : public EthernetInputStreamRateLimited {
 private:
     DynamicTokenBucket token_bucket;
+
+    // Closed-loop rate control keyed on actual kernel backpressure: a window only backs the fill
+    // rate off when the kernel accepted fewer bytes than offered (short sends), scaled by the
+    // accepted fraction; windows without refusals climb back toward the configured rate. Wall
+    // clock time deliberately plays no part - an application-side idle gap between frames shows
+    // zero short sends and must not read as congestion. Per-packet SO_TIMESTAMPING / drop-counter
+    // feedback can later replace the short-send signal with the same hook.
+    std::atomic<uint32_t> m_effective_rate_bytes_per_sec{0};
+    std::chrono::time_point<std::chrono::steady_clock> m_rate_window_start{};
+    size_t m_rate_window_bytes_accepted = 0;
+    size_t m_rate_window_bytes_offered = 0;
+    void update_effective_rate(size_t bytes_offered, size_t bytes_accepted);
     // Note:
     // * We set the token bucket's burst size to be our MTU. If we'd use larger burst sizes
     //   we could send packets faster than the desired rate.
@@ -138,6 +154,15 @@ class EthernetOutputStream : public OutputStreamBase {
 private:
     uint8_t leftover_buffer[MAX_UDP_PAYLOAD_SIZE];
     size_t leftover_size = 0;
+#if defined(__linux__)
+    // Preallocated packet ring for the recvmmsg receive engine (no-sync mode) - datagrams are
+    // drained in batches into these fixed slots and compacted into the user frame, with any
+    // excess carried to the next read
+    static const unsigned int RECV_BATCH_SIZE = 64;
+    std::vector<uint8_t> m_packet_ring;
+    std::vector<uint8_t> m_pending_data;
+    hailo_status read_all_no_sync_batched(void *buffer, size_t offset, size_t size);
+#endif
     uint32_t last_seen_sync_index;
     bool encountered_timeout;
     hailo_stream_eth_output_configuration_t configuration;
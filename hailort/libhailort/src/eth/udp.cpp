@@ -20,6 +20,9 @@
 #include <string.h>
 
 
+#include <algorithm>
+#include <cstdlib>
+
 namespace hailort
 {
 
@@ -50,6 +53,21 @@ Expected<Udp> Udp::create(struct in_addr device_ip, uint16_t device_port, struct
     auto status = HAILO_UNINITIALIZED;
     auto socket = Socket::create(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
     CHECK_EXPECTED(socket);
+
+#if defined(__linux__) && defined(SO_BUSY_POLL)
+    // Busy-poll acceleration (opt-in): the kernel polls the NIC for this many microseconds on
+    // blocking receives before sleeping, cutting the wakeup latency off the per-datagram path.
+    // An AF_XDP data path (copy-free umem shared with Buffer storage) is the next tier and falls
+    // back to this socket path - it needs the umem plumbed through the buffer storage layer and
+    // is tracked separately.
+    if (const auto *busy_poll_env = std::getenv("HAILO_ETH_BUSY_POLL_US")) {
+        const int busy_poll_us = static_cast<int>(strtoul(busy_poll_env, nullptr, 10));
+        if (busy_poll_us > 0) {
+            (void)setsockopt(socket->get_fd(), SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us, sizeof(busy_poll_us));
+        }
+    }
+#endif
+
     auto object = Udp(device_ip, device_port, host_ip, host_port, socket.release(), status);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
@@ -146,6 +164,74 @@ hailo_status Udp::send(uint8_t *buffer, size_t *size, bool use_padding, size_t m
     return HAILO_SUCCESS;
 }
 
+hailo_status Udp::send_batch(const uint8_t *buffer, size_t size, size_t max_payload_size, size_t *bytes_sent)
+{
+    CHECK_ARG_NOT_NULL(buffer);
+    CHECK_ARG_NOT_NULL(bytes_sent);
+    *bytes_sent = 0;
+
+#if defined(__linux__)
+    static const size_t MAX_DATAGRAMS_PER_CALL = 64;
+    struct mmsghdr messages[MAX_DATAGRAMS_PER_CALL];
+    struct iovec iovecs[MAX_DATAGRAMS_PER_CALL];
+
+    size_t offset = 0;
+    while (offset < size) {
+        unsigned int messages_count = 0;
+        for (; (messages_count < MAX_DATAGRAMS_PER_CALL) && (offset < size); messages_count++) {
+            const auto datagram_size = std::min(max_payload_size, size - offset);
+            iovecs[messages_count].iov_base = const_cast<uint8_t *>(buffer + offset);
+            iovecs[messages_count].iov_len = datagram_size;
+            memset(&messages[messages_count], 0, sizeof(messages[messages_count]));
+            messages[messages_count].msg_hdr.msg_name = &m_device_address;
+            messages[messages_count].msg_hdr.msg_namelen = m_device_address_length;
+            messages[messages_count].msg_hdr.msg_iov = &iovecs[messages_count];
+            messages[messages_count].msg_hdr.msg_iovlen = 1;
+            offset += datagram_size;
+        }
+
+        const auto sent_count = sendmmsg(m_socket.get_fd(), messages, messages_count, MSG_CONFIRM);
+        if (sent_count < 0) {
+            // Same errno mapping as Socket::send_to, so callers see the statuses they already handle
+            if ((EWOULDBLOCK == errno) || (EAGAIN == errno)) {
+                LOGGER__ERROR("Udp send timeout");
+                return HAILO_TIMEOUT;
+            }
+            if (EINTR == errno) {
+                LOGGER__ERROR("Udp send interrupted!");
+                return HAILO_INTERRUPTED_BY_SIGNAL;
+            }
+            if (EPIPE == errno) {
+                // When socket is aborted from another thread sendmmsg will return errno EPIPE
+                LOGGER__INFO("Udp send aborted!");
+                return HAILO_STREAM_ABORTED_BY_USER;
+            }
+            LOGGER__ERROR("Udp failed to send data, errno:{}.", errno);
+            return HAILO_ETH_SEND_FAILURE;
+        }
+
+        for (int message = 0; message < sent_count; message++) {
+            *bytes_sent += messages[message].msg_len;
+        }
+        if (static_cast<unsigned int>(sent_count) < messages_count) {
+            // Kernel backpressure - report what was accepted, the caller resumes from there
+            return HAILO_SUCCESS;
+        }
+    }
+    return HAILO_SUCCESS;
+#else
+    size_t offset = 0;
+    while (offset < size) {
+        auto datagram_size = std::min(max_payload_size, size - offset);
+        auto status = send(const_cast<uint8_t *>(buffer + offset), &datagram_size, false, max_payload_size);
+        CHECK_SUCCESS(status);
+        offset += datagram_size;
+        *bytes_sent += datagram_size;
+    }
+    return HAILO_SUCCESS;
+#endif
+}
+
 hailo_status Udp::recv(uint8_t *buffer, size_t *size)
 {
     hailo_status status = HAILO_UNINITIALIZED;
@@ -171,6 +257,41 @@ hailo_status Udp::recv(uint8_t *buffer, size_t *size)
     return HAILO_SUCCESS;
 }
 
+#if defined(__linux__)
+hailo_status Udp::recv_multiple(struct mmsghdr *messages, unsigned int messages_count, int *received_count)
+{
+    CHECK_ARG_NOT_NULL(messages);
+    CHECK_ARG_NOT_NULL(received_count);
+
+    const auto result = recvmmsg(m_socket.get_fd(), messages, messages_count, MSG_WAITFORONE, nullptr);
+    if (result < 0) {
+        // Same errno mapping as Socket::recv_from, so callers see the statuses they already handle
+        if ((EAGAIN == errno) || (EWOULDBLOCK == errno)) {
+            LOGGER__ERROR("Udp recvmmsg failed with timeout");
+            return HAILO_TIMEOUT;
+        }
+        if (EINTR == errno) {
+            LOGGER__ERROR("Udp recvmmsg interrupted!");
+            return HAILO_INTERRUPTED_BY_SIGNAL;
+        }
+        LOGGER__ERROR("recvmmsg failed with errno {}", errno);
+        return HAILO_ETH_RECV_FAILURE;
+    }
+
+    // A 0-length datagram means the socket was shutdown by abort() (see Socket::recv_from) - the
+    // kernel then returns one empty message per call, so without this check callers spin forever
+    for (int message = 0; message < result; message++) {
+        if (0 == messages[message].msg_len) {
+            LOGGER__INFO("Udp socket was aborted");
+            return HAILO_STREAM_ABORTED_BY_USER;
+        }
+    }
+
+    *received_count = result;
+    return HAILO_SUCCESS;
+}
+#endif /* defined(__linux__) */
+
 hailo_status Udp::abort()
 {
     return m_socket.abort();
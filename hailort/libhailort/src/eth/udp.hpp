@@ -29,7 +29,17 @@ public:
 
     hailo_status set_timeout(const std::chrono::milliseconds timeout_ms);
     hailo_status send(uint8_t *buffer, size_t *size, bool use_padding, size_t max_payload_size);
+    // Batched send - splits [buffer, buffer+size) into max_payload_size datagrams and hands them
+    // to the kernel with as few syscalls as possible (sendmmsg on Linux, per-datagram fallback
+    // elsewhere). Not used with padding, which needs per-datagram copies.
+    hailo_status send_batch(const uint8_t *buffer, size_t size, size_t max_payload_size, size_t *bytes_sent);
     hailo_status recv(uint8_t *buffer, size_t *size);
+#if defined(__linux__)
+    // Drains the socket with one recvmmsg call - blocks for the first datagram (honoring the
+    // socket timeout), returns with whatever else was already queued. received_count gets the
+    // number of filled messages.
+    hailo_status recv_multiple(struct mmsghdr *messages, unsigned int messages_count, int *received_count);
+#endif
     hailo_status abort();
     hailo_status has_data(bool log_timeouts_in_debug = false);
     hailo_status fw_interact(uint8_t *request_buffer, size_t request_size, uint8_t *response_buffer,
@@ -31,6 +31,11 @@
 #include "eth/eth_stream.hpp"
 #include "vdma/pcie/pcie_device.hpp"
 #include "utils/sensor_config_utils.hpp"
+#include "utils/dma_buffer_pool.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 #include "utils/hailort_logger.hpp"
 #include "utils/shared_resource_manager.hpp"
 #include "vdevice/vdevice_internal.hpp"
@@ -1093,8 +1098,9 @@ hailo_status hailo_allocate_buffer(size_t size, const hailo_buffer_parameters_t
     auto buffer_storage_params = BufferStorageParams::create(*allocation_params);
     CHECK_EXPECTED_AS_STATUS(buffer_storage_params);
 
-    // Create buffer
-    auto buffer = Buffer::create_shared(size, *buffer_storage_params);
+    // Create buffer - pinned (DMA-able) buffers are recycled through the process-wide pool, so the
+    // hot path pays an O(1) list pop instead of allocation + mapping ioctls
+    auto buffer = DmaBufferPool::instance().acquire(size, *buffer_storage_params);
     CHECK_EXPECTED_AS_STATUS(buffer);
 
     // Store the buffer in manager (otherwise it'll be freed at the end of this func)
@@ -1106,9 +1112,69 @@ hailo_status hailo_allocate_buffer(size_t size, const hailo_buffer_parameters_t
     return HAILO_SUCCESS;
 }
 
+#if defined(__linux__)
+// Mappings created by hailo_buffer_from_dmabuf (address -> size)
+static std::mutex g_dmabuf_mappings_mutex;
+static std::unordered_map<void *, size_t> g_dmabuf_mappings;
+#endif
+
+hailo_status hailo_buffer_from_dmabuf(int dmabuf_fd, size_t size, void **buffer_out)
+{
+#if defined(__linux__)
+    CHECK_ARG_NOT_NULL(buffer_out);
+    CHECK(0 != size, HAILO_INVALID_ARGUMENT, "Buffer size must be greater than zero");
+
+    auto *address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, dmabuf_fd, 0);
+    CHECK(MAP_FAILED != address, HAILO_INVALID_ARGUMENT, "Failed mapping dmabuf fd {} (errno {})", dmabuf_fd, errno);
+
+    {
+        std::lock_guard<std::mutex> lock(g_dmabuf_mappings_mutex);
+        g_dmabuf_mappings[address] = size;
+    }
+
+    *buffer_out = address;
+    return HAILO_SUCCESS;
+#else
+    (void)dmabuf_fd;
+    (void)size;
+    (void)buffer_out;
+    return HAILO_NOT_SUPPORTED;
+#endif
+}
+
+hailo_status hailo_buffer_release_dmabuf(void *buffer)
+{
+#if defined(__linux__)
+    CHECK_ARG_NOT_NULL(buffer);
+
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_dmabuf_mappings_mutex);
+        auto mapping = g_dmabuf_mappings.find(buffer);
+        CHECK(g_dmabuf_mappings.end() != mapping, HAILO_NOT_FOUND, "Buffer was not imported from a dmabuf");
+        size = mapping->second;
+        g_dmabuf_mappings.erase(mapping);
+    }
+
+    CHECK(0 == munmap(buffer, size), HAILO_INTERNAL_FAILURE, "Failed unmapping dmabuf buffer (errno {})", errno);
+    return HAILO_SUCCESS;
+#else
+    (void)buffer;
+    return HAILO_NOT_SUPPORTED;
+#endif
+}
+
 hailo_status hailo_free_buffer(void *buffer)
 {
     CHECK_ARG_NOT_NULL(buffer);
+
+    // Pinned buffers go back to the pool (keeping their driver mappings warm) before the
+    // exported-resource entry is dropped
+    auto hailort_allocated_buffer = ExportedBufferManager::get_resource(buffer);
+    if (hailort_allocated_buffer) {
+        (void)DmaBufferPool::instance().release(hailort_allocated_buffer.value());
+    }
+
     return ExportedBufferManager::unregister_resource(buffer);
 }
 
@@ -327,6 +327,13 @@ ConfigureNetworkParams HailoRTDefaults::get_configure_params(uint16_t batch_size
 {
     ConfigureNetworkParams params = {};
     params.batch_size = batch_size;
+    // TODO: scoped low-latency mode (HRT wishlist):
+    //       Power mode is a configure-time parameter in this tree (below) - there is no live
+    //       clock/power control to toggle at runtime, so a latency_critical_scope() RAII needs a
+    //       firmware control that pins/unpins the performance state on an activated device. Once
+    //       that control exists, the scope is a thin wrapper setting it on every device of the
+    //       vdevice on entry and restoring on exit (refcounted, so nested scopes compose). The
+    //       env override below remains the coarse workaround meanwhile.
     if (std::getenv("FORCE_POWER_MODE_ULTRA_PERFORMANCE") != nullptr) {
         power_mode = HAILO_POWER_MODE_ULTRA_PERFORMANCE;
     }
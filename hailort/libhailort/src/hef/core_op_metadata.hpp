@@ -77,6 +77,13 @@ struct ConfigChannelInfo {
     uint8_t engine_index;
 };
 
+// TODO: replicate this metadata graph with NumaReplicated (common/numa_replicated.hpp):
+//       On multi-socket hosts every worker reads this metadata (and the layer infos derived from
+//       it) from the node it happened to be built on. The replication mechanism exists and
+//       already serves the transform contexts' per-feature quant infos (HAILO_NUMA_REPLICATE=1);
+//       extending it here requires the hot accessors funneled through a NumaReplicated wrapper
+//       around the metadata graph (deep-clonable - plain values and vectors), which is the
+//       refactor this note tracks.
 class CoreOpMetadata final {
 public:
     CoreOpMetadata(const std::string &core_op_name,
@@ -40,6 +40,17 @@
 #include "byte_order.h"
 #include "context_switch_defs.h"
 
+#include "os/mmap_buffer.hpp"
+#include "os/file_descriptor.hpp"
+
+#ifndef _MSC_VER
+#include <sys/stat.h>
+#include <fcntl.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+#endif
+
 #include <fstream>
 #include <memory>
 #include <limits>
@@ -48,7 +59,9 @@
 #include <set>
 #include <algorithm>
 #include <cstring>
+#include <iomanip>
 #include <numeric>
+#include <sstream>
 
 
 namespace hailort
@@ -163,6 +176,14 @@ Expected<Hef> Hef::create(const std::string &hef_path)
     return Hef(make_unique_nothrow<Impl>(impl.release()));
 }
 
+Expected<Hef> Hef::create_mmap(const std::string &hef_path)
+{
+    auto impl = Hef::Impl::create_mmap(hef_path);
+    CHECK_EXPECTED(impl);
+
+    return Hef(make_unique_nothrow<Impl>(impl.release()));
+}
+
 Expected<Hef> Hef::create(const MemoryView &hef_buffer)
 {
     auto impl = Hef::Impl::create(hef_buffer);
@@ -333,6 +354,19 @@ Expected<Hef::Impl> Hef::Impl::create(const std::string &hef_path)
     return hef;
 }
 
+Expected<Hef::Impl> Hef::Impl::create_mmap(const std::string &hef_path)
+{
+    hailo_status status = HAILO_UNINITIALIZED;
+
+    Impl hef(hef_path, status, true);
+    if (HAILO_SUCCESS != status) {
+        LOGGER__ERROR("Failed creating HEF");
+        return make_unexpected(status);
+    }
+
+    return hef;
+}
+
 Expected<Hef::Impl> Hef::Impl::create(const MemoryView &hef_buffer)
 {
     hailo_status status = HAILO_UNINITIALIZED;
@@ -406,6 +440,14 @@ void Hef::Impl::init_md5(MD5_SUM_t &calculated_md5)
     memcpy(m_md5, calculated_md5, sizeof(m_md5));
 }
 
+// TODO: multi-HEF bundle with weight deduplication (HRT wishlist):
+//       Model variants sharing a backbone each carry their own weight copy. The bundle format:
+//       a container of HEF protos plus a content-addressed blob section; WriteDataCcwActions
+//       reference blobs by digest instead of embedding them, and the loader materializes each
+//       unique blob once (shared config-buffer images where the per-context layout matches).
+//       Requires the compiler to emit digest references - the runtime side (digest-keyed blob
+//       table feeding proccess_write_ccw_action) is straightforward once the format lands, and
+//       the mmap loading path below already avoids duplicating the container in memory.
 hailo_status Hef::Impl::parse_hef_file(const std::string &hef_path)
 {
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
@@ -451,6 +493,43 @@ hailo_status Hef::Impl::parse_hef_file(const std::string &hef_path)
     return HAILO_SUCCESS;
 }
 
+// TODO: streamed HEF configure (HRT wishlist):
+//       Configuring a network-fetched model today waits for the full HEF. Streaming needs the
+//       container reorganized so the header, the target network group's metadata and its ccw
+//       sections arrive in validation order (today one monolithic proto is parsed in one shot,
+//       and the md5 covers the whole payload - an incremental digest per section is required).
+//       With that format, this parse turns into a chunk loop: validate header, materialize the
+//       requested group's metadata early (the lazy per-group materialization already isolates
+//       it), and hand ccw chunks to the config-buffer writes as they land. Compiler-format
+//       dependent, so recorded here at the loading seam.
+hailo_status Hef::Impl::parse_hef_mmap(const std::string &hef_path)
+{
+#ifdef _MSC_VER
+    // Opening a FileDescriptor for mapping is not wired on Windows - fall back to the buffered path
+    return parse_hef_file(hef_path);
+#else
+    FileDescriptor fd(open(hef_path.c_str(), O_RDONLY));
+    CHECK(-1 != fd, HAILO_OPEN_FILE_FAILURE, "Failed to open HEF file \"{}\". errno: {}", hef_path, errno);
+
+    struct stat file_stat = {};
+    CHECK(0 == fstat(fd, &file_stat), HAILO_FILE_OPERATION_FAILURE, "Failed to stat HEF file \"{}\". errno: {}",
+        hef_path, errno);
+    const auto file_size = static_cast<size_t>(file_stat.st_size);
+
+    // The mapping is local - the protobuf message copies what it needs during the parse, so the
+    // mapped pages can be dropped right afterwards
+    auto hef_mmap = MmapBuffer<uint8_t>::create_file_map(file_size, fd, 0);
+    CHECK_EXPECTED_AS_STATUS(hef_mmap);
+
+#if defined(__linux__)
+    // The header validation (md5) and the parse both walk the file front to back
+    (void)madvise(hef_mmap->address(), file_size, MADV_SEQUENTIAL);
+#endif
+
+    return parse_hef_memview(MemoryView(hef_mmap->address(), file_size));
+#endif /* _MSC_VER */
+}
+
 hailo_status Hef::Impl::parse_hef_memview(const MemoryView &hef_memview)
 {
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
@@ -503,10 +582,33 @@ hailo_status Hef::Impl::fill_networks_metadata()
 {
     fill_extensions_bitset();
 
+    // Metadata is materialized lazily per network group on first access (ensure_network_group_metadata),
+    // so working with one model out of a multi-network HEF doesn't pay for parsing the rest
+    return HAILO_SUCCESS;
+}
+
+hailo_status Hef::Impl::ensure_network_group_metadata(const std::string &network_group_name)
+{
+    if (contains(m_network_group_metadata, network_group_name)) {
+        return HAILO_SUCCESS;
+    }
+
+    for (auto &network_group : m_groups) {
+        if (network_group_name == HefUtils::get_network_group_name(*network_group, m_supported_features)) {
+            return materialize_network_group_metadata(network_group);
+        }
+    }
+
+    LOGGER__ERROR("Network group with the name {} was not found in the HEF", network_group_name);
+    return HAILO_NOT_FOUND;
+}
+
+hailo_status Hef::Impl::materialize_network_group_metadata(const ProtoHEFNetworkGroupPtr &network_group)
+{
     CoreOpMetadataPerArch core_op_metadata;
     uint32_t partial_clusters_layout_bitmap = 0;
 
-    for (auto &network_group : m_groups) {
+    {
         // Prepare core_op_metadata
         auto network_group_name = HefUtils::get_network_group_name(*network_group, m_supported_features);
         // TODO: keep metadata per core_op (HRT-9551)
@@ -792,12 +894,12 @@ const MemoryView Hef::Impl::get_hef_memview()
 }
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
-Hef::Impl::Impl(const std::string &hef_path, hailo_status &status)
+Hef::Impl::Impl(const std::string &hef_path, hailo_status &status, bool use_mmap)
 {
     status = HAILO_UNINITIALIZED;
     GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-    status = parse_hef_file(hef_path);
+    status = use_mmap ? parse_hef_mmap(hef_path) : parse_hef_file(hef_path);
     if (HAILO_SUCCESS != status) {
         LOGGER__ERROR("Failed parsing HEF file");
         return;
@@ -1373,7 +1475,7 @@ Expected<std::vector<net_flow::PostProcessOpMetadataPtr>> Hef::Impl::create_ops_
 
 Expected<CoreOpMetadataPtr> Hef::Impl::get_core_op_metadata(const std::string &network_group_name, uint32_t partial_clusters_layout_bitmap)
 {
-    CHECK_AS_EXPECTED(contains(m_network_group_metadata, network_group_name), HAILO_NOT_FOUND,
+    CHECK_AS_EXPECTED(HAILO_SUCCESS == ensure_network_group_metadata(network_group_name), HAILO_NOT_FOUND,
         "Network group with name {} wasn't found", network_group_name);
     auto &ng_metadata = m_network_group_metadata.at(network_group_name);
     CHECK_AS_EXPECTED(contains(ng_metadata.m_core_ops_metadata_per_arch, network_group_name), HAILO_NOT_FOUND,
@@ -1553,7 +1655,7 @@ Expected<std::vector<hailo_stream_info_t>> Hef::Impl::get_all_stream_infos(const
 
 Expected<std::vector<hailo_network_info_t>> Hef::Impl::get_network_infos(const std::string &net_group_name)
 {
-    CHECK_AS_EXPECTED(contains(m_network_group_metadata, net_group_name), HAILO_NOT_FOUND);
+    CHECK_AS_EXPECTED(HAILO_SUCCESS == ensure_network_group_metadata(net_group_name), HAILO_NOT_FOUND);
     return m_network_group_metadata.at(net_group_name).get_network_infos();
 }
 
@@ -1587,21 +1689,21 @@ Expected<hailo_stream_info_t> Hef::Impl::get_stream_info_by_name(const std::stri
 Expected<std::vector<hailo_vstream_info_t>> Hef::Impl::get_input_vstream_infos(const std::string &net_group_name,
     const std::string &network_name)
 {
-    CHECK_AS_EXPECTED(contains(m_network_group_metadata, net_group_name), HAILO_NOT_FOUND);
+    CHECK_AS_EXPECTED(HAILO_SUCCESS == ensure_network_group_metadata(net_group_name), HAILO_NOT_FOUND);
     return m_network_group_metadata.at(net_group_name).get_input_vstream_infos(network_name);
 }
 
 Expected<std::vector<hailo_vstream_info_t>> Hef::Impl::get_output_vstream_infos(const std::string &net_group_name,
     const std::string &network_name)
 {
-    CHECK_AS_EXPECTED(contains(m_network_group_metadata, net_group_name), HAILO_NOT_FOUND);
+    CHECK_AS_EXPECTED(HAILO_SUCCESS == ensure_network_group_metadata(net_group_name), HAILO_NOT_FOUND);
     return m_network_group_metadata.at(net_group_name).get_output_vstream_infos(network_name);
 }
 
 Expected<std::vector<hailo_vstream_info_t>> Hef::Impl::get_all_vstream_infos(const std::string &net_group_name,
     const std::string &network_name)
 {
-    CHECK_AS_EXPECTED(contains(m_network_group_metadata, net_group_name), HAILO_NOT_FOUND);
+    CHECK_AS_EXPECTED(HAILO_SUCCESS == ensure_network_group_metadata(net_group_name), HAILO_NOT_FOUND);
     return m_network_group_metadata.at(net_group_name).get_all_vstream_infos(network_name);
 }
 
@@ -1618,7 +1720,9 @@ const std::vector<ProtoHEFCoreOpMock>& Hef::Impl::core_ops(const std::string &ne
 
 const NetworkGroupMetadata Hef::Impl::network_group_metadata(const std::string &net_group_name) const
 {
-    assert(contains(m_network_group_metadata, net_group_name));
+    auto ensure_status = ensure_network_group_metadata(net_group_name);
+    (void)ensure_status;
+    assert(HAILO_SUCCESS == ensure_status);
     auto metadata = m_network_group_metadata.at(net_group_name);
     return metadata;
 }
@@ -3011,7 +3115,7 @@ Expected<std::shared_ptr<ProtoHEFCoreOpMock>> Hef::Impl::get_core_op_per_arch(co
 
 Expected<std::vector<std::string>> Hef::Impl::get_sorted_output_names(const std::string &net_group_name)
 {
-    CHECK_AS_EXPECTED(contains(m_network_group_metadata, net_group_name), HAILO_NOT_FOUND);
+    CHECK_AS_EXPECTED(HAILO_SUCCESS == ensure_network_group_metadata(net_group_name), HAILO_NOT_FOUND);
     auto res = m_network_group_metadata.at(net_group_name).get_sorted_output_names();
     return res;
 }
@@ -3145,14 +3249,14 @@ bool Hef::Impl::contains_ddr_layers(const ProtoHEFCoreOpMock& core_op)
 Expected<std::vector<std::string>> Hef::Impl::get_stream_names_from_vstream_name(const std::string &vstream_name,
     const std::string &net_group_name)
 {
-    CHECK_AS_EXPECTED(contains(m_network_group_metadata, net_group_name), HAILO_NOT_FOUND);
+    CHECK_AS_EXPECTED(HAILO_SUCCESS == ensure_network_group_metadata(net_group_name), HAILO_NOT_FOUND);
     return m_network_group_metadata.at(net_group_name).get_stream_names_from_vstream_name(vstream_name);
 }
 
 Expected<std::vector<std::string>> Hef::Impl::get_vstream_names_from_stream_name(const std::string &stream_name,
     const std::string &net_group_name)
 {
-    CHECK_AS_EXPECTED(contains(m_network_group_metadata, net_group_name), HAILO_NOT_FOUND);
+    CHECK_AS_EXPECTED(HAILO_SUCCESS == ensure_network_group_metadata(net_group_name), HAILO_NOT_FOUND);
     return m_network_group_metadata.at(net_group_name).get_vstream_names_from_stream_name(stream_name);
 }
 
@@ -3437,7 +3541,7 @@ Expected<std::vector<std::string>> Hef::Impl::get_post_processes_infos_descripti
     std::vector<std::string> infos_strings;
     std::string infos_string;
 
-    CHECK_AS_EXPECTED(contains(m_network_group_metadata, network_group_name), HAILO_INTERNAL_FAILURE);
+    CHECK_AS_EXPECTED(HAILO_SUCCESS == ensure_network_group_metadata(network_group_name), HAILO_INTERNAL_FAILURE);
 
     auto post_process = m_network_group_metadata.at(network_group_name).m_ops_metadata;
     for (const auto &post_process_info : post_process) {
@@ -3470,6 +3574,65 @@ Expected<std::string> Hef::get_description(bool stream_infos, bool vstream_infos
     return pimpl->get_description(stream_infos, vstream_infos, arch.value());
 }
 
+Expected<std::string> Hef::get_perf_description()
+{
+    return pimpl->get_perf_description();
+}
+
+Expected<std::string> Hef::Impl::get_perf_description()
+{
+    std::string perf_infos;
+
+    auto network_group_infos = get_network_groups_infos();
+    CHECK_EXPECTED(network_group_infos);
+    for (const auto &network_group_info : network_group_infos.release()) {
+        auto core_op_metadata_exp = get_core_op_metadata(network_group_info.name);
+        CHECK_EXPECTED(core_op_metadata_exp);
+        auto core_op_metadata = core_op_metadata_exp.release();
+
+        perf_infos += "Network group name: " + std::string(network_group_info.name) + "\n";
+        perf_infos += add_tabs(1) + "Contexts: " +
+            std::to_string(core_op_metadata->get_contexts_count()) + " (" +
+            std::to_string(core_op_metadata->get_dynamic_contexts_count()) + " dynamic)\n";
+
+        // Config (CCW) footprint - bytes written to the config channels on every activation.
+        // Per-context switching re-sends the dynamic contexts' share, so it bounds the switch cost.
+        size_t preliminary_config_size = 0;
+        for (const auto &config_buffer_sizes : core_op_metadata->preliminary_context().config_buffers_info()) {
+            preliminary_config_size += std::accumulate(config_buffer_sizes.second.begin(),
+                config_buffer_sizes.second.end(), static_cast<size_t>(0));
+        }
+        size_t dynamic_config_size = 0;
+        for (const auto &dynamic_context : core_op_metadata->dynamic_contexts()) {
+            for (const auto &config_buffer_sizes : dynamic_context.config_buffers_info()) {
+                dynamic_config_size += std::accumulate(config_buffer_sizes.second.begin(),
+                    config_buffer_sizes.second.end(), static_cast<size_t>(0));
+            }
+        }
+        perf_infos += add_tabs(1) + "Config footprint: " +
+            std::to_string(preliminary_config_size + dynamic_config_size) + " bytes (" +
+            std::to_string(dynamic_config_size) + " re-sent per context switch)\n";
+
+        // Per-frame transfer totals - every context's config + edge layer traffic
+        auto total_transfer_size = core_op_metadata->get_total_transfer_size();
+        CHECK_EXPECTED(total_transfer_size);
+        perf_infos += add_tabs(1) + "Dynamic contexts transfer size: " +
+            std::to_string(total_transfer_size.value()) + " bytes per frame\n";
+
+        auto bottleneck_fps = get_bottleneck_fps(network_group_info.name);
+        if (bottleneck_fps && (*bottleneck_fps > 0)) {
+            std::ostringstream fps_str;
+            fps_str << std::fixed << std::setprecision(2) << *bottleneck_fps;
+            std::ostringstream latency_str;
+            latency_str << std::fixed << std::setprecision(2) << (1000.0 / *bottleneck_fps);
+            perf_infos += add_tabs(1) + "Estimated bottleneck FPS: " + fps_str.str() +
+                " (minimum feasible latency " + latency_str.str() + " ms at batch 1)\n";
+        }
+    }
+
+    return perf_infos;
+}
+
 Expected<std::string> Hef::Impl::get_description(bool stream_infos, bool vstream_infos, hailo_device_architecture_t device_arch)
 {
     std::string hef_infos;
@@ -3597,7 +3760,7 @@ hailo_status Hef::Impl::fill_missing_input_vstream_params_with_default(const std
     const std::string &network_name, std::map<std::string, hailo_vstream_params_t> &input_vstreams_params,
     hailo_format_type_t format_type, uint32_t timeout_ms, uint32_t queue_size)
 {
-    CHECK(contains(m_network_group_metadata, net_group_name), HAILO_NOT_FOUND);
+    CHECK(HAILO_SUCCESS == ensure_network_group_metadata(net_group_name), HAILO_NOT_FOUND);
     auto input_vstream_infos = m_network_group_metadata.at(net_group_name).get_input_vstream_infos(network_name);
     CHECK_EXPECTED_AS_STATUS(input_vstream_infos);
 
@@ -3609,7 +3772,7 @@ hailo_status Hef::Impl::fill_missing_output_vstream_params_with_default(const st
     const std::string &network_name, std::map<std::string, hailo_vstream_params_t> &output_vstream_params,
     hailo_format_type_t format_type, uint32_t timeout_ms, uint32_t queue_size)
 {
-    CHECK(contains(m_network_group_metadata, net_group_name), HAILO_NOT_FOUND);
+    CHECK(HAILO_SUCCESS == ensure_network_group_metadata(net_group_name), HAILO_NOT_FOUND);
     auto output_vstream_infos = m_network_group_metadata.at(net_group_name).get_output_vstream_infos(network_name);
     CHECK_EXPECTED_AS_STATUS(output_vstream_infos);
 
@@ -231,6 +231,7 @@ public:
     static const uint32_t HEADER_VERSION = 0;
 
     static Expected<Impl> create(const std::string &hef_path);
+    static Expected<Impl> create_mmap(const std::string &hef_path);
     static Expected<Impl> create(const MemoryView &hef_buffer);
 
     const std::vector<ProtoHEFNetworkGroupPtr>& network_groups() const;
@@ -324,6 +325,7 @@ public:
     Expected<CoreOpMetadataPtr> get_core_op_metadata(const std::string &network_group_name, uint32_t partial_clusters_layout_bitmap = PARTIAL_CLUSTERS_LAYOUT_IGNORE);
 
     Expected<std::string> get_description(bool stream_infos, bool vstream_infos, hailo_device_architecture_t device_arch);
+    Expected<std::string> get_perf_description();
 
     const MD5_SUM_t &md5() const
     {
@@ -369,14 +371,18 @@ public:
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
 private:
-    Impl(const std::string &hef_path, hailo_status &status);
+    Impl(const std::string &hef_path, hailo_status &status, bool use_mmap = false);
     Impl(const MemoryView &hef_memview, hailo_status &status);
 
     hailo_status parse_hef_file(const std::string &hef_path);
+    hailo_status parse_hef_mmap(const std::string &hef_path);
     hailo_status parse_hef_memview(const MemoryView &hef_memview);
     hailo_status transfer_protobuf_field_ownership(ProtoHEFHef &hef_message);
     void fill_core_ops();
     hailo_status fill_networks_metadata();
+    // Lazily materializes the metadata of a single network group on first access
+    hailo_status ensure_network_group_metadata(const std::string &network_group_name);
+    hailo_status materialize_network_group_metadata(const ProtoHEFNetworkGroupPtr &network_group);
     void fill_extensions_bitset();
     void init_md5(MD5_SUM_t &calculated_md5);
 
@@ -20,6 +20,7 @@
 #include "net_flow/ops/op_metadata.hpp"
 #include "common/utils.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace hailort
@@ -77,22 +78,39 @@ private:
         const auto src_row_size = input_metadata.padded_shape.width * input_metadata.padded_shape.features;
         const auto dst_row_size = output_metadata.shape.width;
 
+        // In NHCW each channel is contiguous along W, so the scan runs channel-major over W-blocks:
+        // the inner compare/blend loop walks consecutive memory (SIMD friendly, auto-vectorized)
+        // and the per-block max/index state stays resident in cache across the channel stride.
+        constexpr uint32_t ARGMAX_BLOCK_SIZE = 128;
+        SrcType max_values[ARGMAX_BLOCK_SIZE];
+        DstType max_indices[ARGMAX_BLOCK_SIZE];
+
         for (uint32_t r = 0; r < input_metadata.shape.height; r++) {
             const SrcType *src_row = src_ptr + (r * src_row_size);
             DstType *dst_row = dst_ptr + (r * dst_row_size);
-            for (uint32_t w = 0; w < input_metadata.shape.width; w++) {
-                const SrcType *offset_in_row = src_row + w;
-                DstType max_index = 0;
-                auto max_value = *offset_in_row;
+            for (uint32_t block_start = 0; block_start < input_metadata.shape.width; block_start += ARGMAX_BLOCK_SIZE) {
+                const uint32_t block_size = std::min(ARGMAX_BLOCK_SIZE, input_metadata.shape.width - block_start);
+
+                const SrcType *first_channel = src_row + block_start;
+                for (uint32_t i = 0; i < block_size; i++) {
+                    max_values[i] = first_channel[i];
+                    max_indices[i] = 0;
+                }
+
                 for (uint32_t c = 1; c < input_metadata.shape.features; c++) {
-                    offset_in_row += input_metadata.padded_shape.width;
-                    const auto &current_value = *offset_in_row;
-                    if (current_value > max_value) {
-                        max_index = static_cast<DstType>(c);
-                        max_value = current_value;
+                    const SrcType *channel_row = src_row + (c * input_metadata.padded_shape.width) + block_start;
+                    const DstType channel_index = static_cast<DstType>(c);
+                    for (uint32_t i = 0; i < block_size; i++) {
+                        if (channel_row[i] > max_values[i]) {
+                            max_values[i] = channel_row[i];
+                            max_indices[i] = channel_index;
+                        }
                     }
                 }
-                dst_row[w] = max_index;
+
+                for (uint32_t i = 0; i < block_size; i++) {
+                    dst_row[block_start + i] = max_indices[i];
+                }
             }
         }
         return HAILO_SUCCESS;
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file kernel_registry.hpp
+ * @brief Central registry for per-op SIMD kernels. Ops register their kernel variants
+ *        (op name, dtype, layout, ISA) once at static init; dispatch picks the best variant the
+ *        CPU supports, cappable at runtime via HAILO_KERNEL_ISA (scalar/sse4/avx2/neon) for
+ *        debugging and reproducibility. Replaces per-op hand-rolled CPUID checks as kernels
+ *        accumulate.
+ **/
+
+#ifndef _HAILO_KERNEL_REGISTRY_HPP_
+#define _HAILO_KERNEL_REGISTRY_HPP_
+
+#include "hailo/hailort.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#include <mutex>
+#include <string>
+#include <map>
+#include <tuple>
+
+namespace hailort
+{
+namespace net_flow
+{
+
+enum class KernelIsa : uint8_t {
+    SCALAR = 0,
+    SSE4,
+    AVX2,
+    NEON,
+};
+
+class KernelRegistry final
+{
+public:
+    static KernelRegistry &instance()
+    {
+        static KernelRegistry registry;
+        return registry;
+    }
+
+    KernelRegistry(const KernelRegistry &) = delete;
+    KernelRegistry &operator=(const KernelRegistry &) = delete;
+
+    // Registers a kernel variant. Typically called from a static initializer in the op's
+    // translation unit. The kernel signature is op-defined; lookup returns it as void*.
+    void register_kernel(const std::string &op_name, hailo_format_type_t dtype, hailo_format_order_t layout,
+        KernelIsa isa, void *kernel)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_kernels[std::make_tuple(op_name, dtype, layout, isa)] = kernel;
+    }
+
+    // Returns the registered kernel with the highest ISA that is both supported by the CPU and
+    // allowed by HAILO_KERNEL_ISA, or nullptr when only unregistered variants exist (callers then
+    // use their built-in scalar path).
+    void *lookup(const std::string &op_name, hailo_format_type_t dtype, hailo_format_order_t layout)
+    {
+        const auto max_isa = max_allowed_isa();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (int isa = static_cast<int>(max_isa); isa >= 0; isa--) {
+            auto it = m_kernels.find(std::make_tuple(op_name, dtype, layout, static_cast<KernelIsa>(isa)));
+            if (m_kernels.end() != it) {
+                return it->second;
+            }
+        }
+        return nullptr;
+    }
+
+    static KernelIsa max_allowed_isa()
+    {
+        static const KernelIsa allowed = []() {
+            auto detected = detect_cpu_isa();
+            const auto *cap = std::getenv("HAILO_KERNEL_ISA");
+            if (nullptr != cap) {
+                if (0 == strcmp(cap, "scalar")) {
+                    detected = KernelIsa::SCALAR;
+                } else if ((0 == strcmp(cap, "sse4")) && (detected >= KernelIsa::SSE4)) {
+                    detected = KernelIsa::SSE4;
+                }
+                // avx2/neon caps equal the detected maximum on their platforms
+            }
+            return detected;
+        }();
+        return allowed;
+    }
+
+private:
+    KernelRegistry() = default;
+
+    static KernelIsa detect_cpu_isa()
+    {
+#if defined(__ARM_NEON)
+        return KernelIsa::NEON;
+#elif (defined(__x86_64__) || defined(__i386__)) && !defined(_MSC_VER)
+        // AVX2 kernels in this registry may use FMA - require both
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return KernelIsa::AVX2;
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return KernelIsa::SSE4;
+        }
+        return KernelIsa::SCALAR;
+#elif defined(_M_X64) || defined(_M_IX86)
+        int regs[4] = {};
+        __cpuid(regs, 0);
+        const int max_leaf = regs[0];
+        __cpuid(regs, 1);
+        const bool has_sse4_1 = (0 != (regs[2] & (1 << 19)));
+        const bool has_fma = (0 != (regs[2] & (1 << 12)));
+        const bool has_osxsave = (0 != (regs[2] & (1 << 27)));
+        if (has_osxsave && has_fma && (max_leaf >= 7)) {
+            // AVX2 additionally requires the OS to save the ymm state
+            const bool ymm_enabled = (0x6 == (_xgetbv(0) & 0x6));
+            __cpuidex(regs, 7, 0);
+            if (ymm_enabled && (0 != (regs[1] & (1 << 5)))) {
+                return KernelIsa::AVX2;
+            }
+        }
+        return has_sse4_1 ? KernelIsa::SSE4 : KernelIsa::SCALAR;
+#else
+        return KernelIsa::SCALAR;
+#endif
+    }
+
+    std::mutex m_mutex;
+    std::map<std::tuple<std::string, hailo_format_type_t, hailo_format_order_t, KernelIsa>, void *> m_kernels;
+};
+
+// Helper for registration at static init:
+//   static KernelRegistration g_my_kernel("softmax", HAILO_FORMAT_TYPE_FLOAT32,
+//       HAILO_FORMAT_ORDER_NHWC, KernelIsa::AVX2, (void*)&my_kernel);
+struct KernelRegistration final
+{
+    KernelRegistration(const std::string &op_name, hailo_format_type_t dtype, hailo_format_order_t layout,
+        KernelIsa isa, void *kernel)
+    {
+        KernelRegistry::instance().register_kernel(op_name, dtype, layout, isa, kernel);
+    }
+};
+
+} /* namespace net_flow */
+} /* namespace hailort */
+
+#endif /* _HAILO_KERNEL_REGISTRY_HPP_ */
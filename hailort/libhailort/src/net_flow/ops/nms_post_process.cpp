@@ -10,6 +10,7 @@
  **/
 
 #include "net_flow/ops/nms_post_process.hpp"
+#include "transform/transform_thread_pool.hpp"
 #include "hef/hef_internal.hpp"
 
 namespace hailort
@@ -104,42 +105,96 @@ float NmsPostProcessOp::compute_iou(const hailo_bbox_float32_t &box_1, const hai
     return (intersection / union_area);
 }
 
+// Suppression of a frame with at least this many proposals is sharded across the worker pool
+static const size_t MIN_DETECTIONS_FOR_PARALLEL_NMS = 128;
+
+// On quantized-domain suppression (HRT wishlist):
+//       Score thresholding already runs on raw quantized values before any dequantization (see
+//       Quantization-aware quantized_score_threshold and the YOLO top-K pre-filter) - boxes
+//       rejected there never pay decode. Moving the IoU itself into integer arithmetic is only
+//       sound for ops whose box coordinates are an affine function of the raw values; the YOLO/SSD
+//       decodes apply per-anchor exp/scale, so their coordinates must be decoded before areas can
+//       be compared. For affine-decode ops the suppression below can run directly on the raw
+//       coordinates (IoU is scale invariant per axis when both boxes share the qp) - wire such an
+//       op through a raw-coordinate DetectionBbox variant when one lands.
 void NmsPostProcessOp::remove_overlapping_boxes(std::vector<DetectionBbox> &detections, std::vector<uint32_t> &classes_detections_count,
-    double iou_th)
+    double iou_th, std::vector<std::vector<uint32_t>> *indices_per_class_scratch)
 {
     std::sort(detections.begin(), detections.end(),
             [](DetectionBbox a, DetectionBbox b)
             { return a.m_bbox.score > b.m_bbox.score; });
 
-    for (size_t i = 0; i < detections.size(); i++) {
-        if (detections[i].m_bbox.score == REMOVED_CLASS_SCORE) {
-            // Detection overlapped with a higher score detection
-            continue;
-        }
+    // Suppression only ever compares boxes of the same class, so the classes are fully independent.
+    // Group the score-ordered detection indices per class and suppress each class on its own.
+    // When called with the op's scratch arena, the per-class vectors keep their capacity across frames.
+    std::vector<std::vector<uint32_t>> local_indices_per_class;
+    auto &indices_per_class = (nullptr != indices_per_class_scratch) ? *indices_per_class_scratch : local_indices_per_class;
+    indices_per_class.resize(classes_detections_count.size());
+    for (auto &class_indices : indices_per_class) {
+        class_indices.clear();
+    }
+    for (uint32_t i = 0; i < detections.size(); i++) {
+        assert(detections[i].m_class_id < indices_per_class.size());
+        indices_per_class[detections[i].m_class_id].emplace_back(i);
+    }
 
-        for (size_t j = i + 1; j < detections.size(); j++) {
-            if (detections[j].m_bbox.score == REMOVED_CLASS_SCORE) {
+    const auto suppress_class = [&detections, &classes_detections_count, &indices_per_class, iou_th](size_t class_idx) {
+        auto &indices = indices_per_class[class_idx];
+        if (indices.size() < 2) {
+            // Nothing to suppress
+            return;
+        }
+        for (size_t i = 0; i < indices.size(); i++) {
+            auto &detection_i = detections[indices[i]];
+            if (detection_i.m_bbox.score == REMOVED_CLASS_SCORE) {
                 // Detection overlapped with a higher score detection
                 continue;
             }
 
-            if (detections[i].m_class_id == detections[j].m_class_id
-                    && (compute_iou(detections[i].m_bbox, detections[j].m_bbox) >= iou_th)) {
-                // Remove detections[j] if the iou is higher then the threshold
-                detections[j].m_bbox.score = REMOVED_CLASS_SCORE;
-                assert(detections[i].m_class_id < classes_detections_count.size());
-                assert(classes_detections_count[detections[j].m_class_id] > 0);
-                classes_detections_count[detections[j].m_class_id]--;
+            for (size_t j = i + 1; j < indices.size(); j++) {
+                auto &detection_j = detections[indices[j]];
+                if (detection_j.m_bbox.score == REMOVED_CLASS_SCORE) {
+                    // Detection overlapped with a higher score detection
+                    continue;
+                }
+
+                if (compute_iou(detection_i.m_bbox, detection_j.m_bbox) >= iou_th) {
+                    // Remove detection_j if the iou is higher then the threshold
+                    detection_j.m_bbox.score = REMOVED_CLASS_SCORE;
+                    assert(classes_detections_count[detection_j.m_class_id] > 0);
+                    classes_detections_count[detection_j.m_class_id]--;
+                }
+            }
+        }
+    };
+
+    auto &pool = TransformThreadPool::instance();
+    const auto classes_count = indices_per_class.size();
+    const auto parts_count = static_cast<uint32_t>(std::min<size_t>(pool.max_parallelism(), classes_count));
+    if ((detections.size() >= MIN_DETECTIONS_FOR_PARALLEL_NMS) && (parts_count > 1)) {
+        // Each worker owns a strided subset of the classes - every class (and its detections and
+        // count entry) is touched by exactly one worker
+        (void)pool.run(parts_count, [&](uint32_t part) -> hailo_status {
+            for (size_t class_idx = part; class_idx < classes_count; class_idx += parts_count) {
+                suppress_class(class_idx);
             }
+            return HAILO_SUCCESS;
+        });
+    } else {
+        for (size_t class_idx = 0; class_idx < classes_count; class_idx++) {
+            suppress_class(class_idx);
         }
     }
 }
 
 void NmsPostProcessOp::fill_nms_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
-    std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config)
+    std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config,
+    std::vector<uint32_t> *detections_before_scratch)
 {
     // Calculate the number of detections before each class, to help us later calculate the buffer_offset for it's detections.
-    std::vector<uint32_t> num_of_detections_before(nms_config.number_of_classes, 0);
+    std::vector<uint32_t> local_detections_before;
+    auto &num_of_detections_before = (nullptr != detections_before_scratch) ? *detections_before_scratch : local_detections_before;
+    num_of_detections_before.assign(nms_config.number_of_classes, 0);
     uint32_t ignored_detections_count = 0;
     for (size_t class_idx = 0; class_idx < nms_config.number_of_classes; class_idx++) {
         if (classes_detections_count[class_idx] > nms_config.max_proposals_per_class) {
@@ -186,10 +241,89 @@ void NmsPostProcessOp::fill_nms_format_buffer(MemoryView &buffer, const std::vec
     }
 }
 
+// Verify-first temporal suppression: on a static scene, every detection of this frame overlaps
+// one of the previous frame's survivors, so suppression reduces to keeping the best detection per
+// survivor - O(detections x survivors-of-class) instead of the full O(n^2) class passes. Any
+// detection no survivor explains means the scene changed and the caller runs the full pass.
+bool NmsPostProcessOp::try_temporal_suppression(std::vector<DetectionBbox> &detections,
+    std::vector<uint32_t> &classes_detections_count, double iou_th)
+{
+    if (m_previous_survivors.empty()) {
+        return false;
+    }
+
+    // Best (highest score) detection matched to each previous survivor; -1 = none yet
+    std::vector<int32_t> best_match_per_survivor(m_previous_survivors.size(), -1);
+    std::vector<int32_t> matched_survivor_per_detection(detections.size(), -1);
+
+    for (uint32_t detection_idx = 0; detection_idx < detections.size(); detection_idx++) {
+        const auto &detection = detections[detection_idx];
+        float best_iou = 0;
+        int32_t best_survivor = -1;
+        for (uint32_t survivor_idx = 0; survivor_idx < m_previous_survivors.size(); survivor_idx++) {
+            const auto &survivor = m_previous_survivors[survivor_idx];
+            if (survivor.m_class_id != detection.m_class_id) {
+                continue;
+            }
+            const auto iou = compute_iou(survivor.m_bbox, detection.m_bbox);
+            if ((iou >= iou_th) && (iou > best_iou)) {
+                best_iou = iou;
+                best_survivor = static_cast<int32_t>(survivor_idx);
+            }
+        }
+        if (best_survivor < 0) {
+            // A detection no previous survivor explains - the scene changed
+            return false;
+        }
+        matched_survivor_per_detection[detection_idx] = best_survivor;
+        const auto current_best = best_match_per_survivor[best_survivor];
+        if ((current_best < 0) || (detection.m_bbox.score > detections[current_best].m_bbox.score)) {
+            best_match_per_survivor[best_survivor] = static_cast<int32_t>(detection_idx);
+        }
+    }
+
+    // Each survivor's best match survives; the rest are suppressed exactly like the full pass
+    // would suppress them against it (a survivor with no match simply left the scene)
+    for (uint32_t detection_idx = 0; detection_idx < detections.size(); detection_idx++) {
+        if (best_match_per_survivor[matched_survivor_per_detection[detection_idx]] !=
+            static_cast<int32_t>(detection_idx)) {
+            auto &detection = detections[detection_idx];
+            detection.m_bbox.score = REMOVED_CLASS_SCORE;
+            assert(classes_detections_count[detection.m_class_id] > 0);
+            classes_detections_count[detection.m_class_id]--;
+        }
+    }
+    return true;
+}
+
 hailo_status NmsPostProcessOp::hailo_nms_format(MemoryView dst_view)
 {
-    remove_overlapping_boxes(m_detections, m_classes_detections_count, m_nms_metadata->nms_config().nms_iou_th);
-    fill_nms_format_buffer(dst_view, m_detections, m_classes_detections_count, m_nms_metadata->nms_config());
+    const auto iou_th = m_nms_metadata->nms_config().nms_iou_th;
+    bool suppressed_temporally = false;
+    if (m_temporal_suppression_enabled) {
+        suppressed_temporally = try_temporal_suppression(m_detections, m_classes_detections_count, iou_th);
+    }
+    if (!suppressed_temporally) {
+        remove_overlapping_boxes(m_detections, m_classes_detections_count, iou_th,
+            &m_indices_per_class_scratch);
+    } else {
+        // The full pass sorts by score and fill_nms_format_buffer truncates per class in that
+        // order - keep the invariant on the temporal path too
+        std::sort(m_detections.begin(), m_detections.end(),
+            [](const DetectionBbox &a, const DetectionBbox &b) { return a.m_bbox.score > b.m_bbox.score; });
+    }
+    fill_nms_format_buffer(dst_view, m_detections, m_classes_detections_count, m_nms_metadata->nms_config(),
+        &m_detections_before_scratch);
+
+    if (m_temporal_suppression_enabled) {
+        // Seed the next frame's verify pass with this frame's survivors
+        m_previous_survivors.clear();
+        for (const auto &detection : m_detections) {
+            if (REMOVED_CLASS_SCORE != detection.m_bbox.score) {
+                m_previous_survivors.emplace_back(detection);
+            }
+        }
+    }
     return HAILO_SUCCESS;
 }
 
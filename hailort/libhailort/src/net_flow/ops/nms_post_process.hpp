@@ -23,6 +23,12 @@
 
 #include "net_flow/ops/op.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
 
 namespace hailort
 {
@@ -120,6 +126,16 @@ struct NmsPostProcessConfig
     // Indicates whether or not NMS performs IoU over different classes for the same box.
     // If set to false - NMS won't intersect different classes, and a box could have multiple labels.
     bool cross_classes = false;
+
+    // Temporal (tracker-assisted) suppression - seeds each frame's suppression with the previous
+    // frame's surviving boxes (verify-first, with fallback to the full pass on any mismatch).
+    // Worth enabling on largely static scenes; also switchable via HAILO_NMS_TEMPORAL=1.
+    bool temporal_suppression = false;
+
+    // When set above 0, at most this many highest-objectness proposals per input layer are fully
+    // decoded (partial selection runs on the raw quantized scores, before any dequantization).
+    // 0 keeps the pre-filter disabled.
+    uint32_t pre_nms_top_k = 0;
 };
 
 static const float32_t REMOVED_CLASS_SCORE = 0.0f;
@@ -186,6 +202,29 @@ public:
         return (1.0f / (1.0f + std::exp(-number)));
     }
 
+    /**
+     * The largest raw quantized value below every entry that can pass
+     * sigmoid(dequantize(q)) >= @a score_th. Since dequantize+sigmoid is monotonic this allows
+     * rejecting entries on raw quantized scores, before paying any dequantization. The result is
+     * conservative (floor), so borderline entries must still be checked after dequantization.
+     */
+    template <typename SrcType>
+    static SrcType quantized_score_threshold(double score_th, const hailo_quant_info_t &quant_info)
+    {
+        if ((score_th <= 0) || (score_th >= 1) || (quant_info.qp_scale <= 0)) {
+            return std::numeric_limits<SrcType>::min();
+        }
+        const double logit = std::log(score_th / (1.0 - score_th));
+        const double raw = quant_info.qp_zp + (logit / quant_info.qp_scale);
+        if (raw <= static_cast<double>(std::numeric_limits<SrcType>::min())) {
+            return std::numeric_limits<SrcType>::min();
+        }
+        if (raw >= static_cast<double>(std::numeric_limits<SrcType>::max())) {
+            return std::numeric_limits<SrcType>::max();
+        }
+        return static_cast<SrcType>(std::floor(raw));
+    }
+
     /**
      * Removes overlapping boxes in @a detections by setting the class confidence to zero.
      *
@@ -193,7 +232,8 @@ public:
      *
     */
     static void remove_overlapping_boxes(std::vector<DetectionBbox> &detections,
-        std::vector<uint32_t> &classes_detections_count, double nms_iou_th);
+        std::vector<uint32_t> &classes_detections_count, double nms_iou_th,
+        std::vector<std::vector<uint32_t>> *indices_per_class_scratch = nullptr);
 
     template<typename DstType = float32_t, typename SrcType>
     DstType dequantize_and_sigmoid(SrcType number, hailo_quant_info_t quant_info)
@@ -257,7 +297,8 @@ public:
     *       \endcode
     */
     static void fill_nms_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
-        std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config);
+        std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config,
+        std::vector<uint32_t> *detections_before_scratch = nullptr);
 
 protected:
     NmsPostProcessOp(std::shared_ptr<NmsOpMetadata> metadata)
@@ -265,7 +306,18 @@ protected:
         , m_classes_detections_count(metadata->nms_config().number_of_classes, 0)
         , m_nms_metadata(metadata)
     {
+        // Worst-case scratch is carved once here and reused across frames - execute() stays
+        // allocation free in steady state
         m_detections.reserve(metadata->nms_config().max_proposals_per_class * metadata->nms_config().number_of_classes);
+        m_indices_per_class_scratch.resize(metadata->nms_config().number_of_classes);
+        for (auto &class_indices : m_indices_per_class_scratch) {
+            class_indices.reserve(metadata->nms_config().max_proposals_per_class);
+        }
+
+        const auto *temporal_env = std::getenv("HAILO_NMS_TEMPORAL");
+        m_temporal_suppression_enabled = metadata->nms_config().temporal_suppression ||
+            ((nullptr != temporal_env) && (0 == strcmp(temporal_env, "1")));
+        m_detections_before_scratch.reserve(metadata->nms_config().number_of_classes);
     }
 
     void clear_before_frame()  
@@ -310,8 +362,22 @@ protected:
 
     hailo_status hailo_nms_format(MemoryView dst_view);
 
+    // Temporal verify-first suppression - true when the previous frame's survivors fully explain
+    // this frame's detections (every detection overlaps a survivor of its class) and suppression
+    // was applied against them; false requests the full pass (scene changed / first frame).
+    bool try_temporal_suppression(std::vector<DetectionBbox> &detections,
+        std::vector<uint32_t> &classes_detections_count, double iou_th);
+
     std::vector<DetectionBbox> m_detections;
     std::vector<uint32_t> m_classes_detections_count;
+    // Per-op scratch reused across frames (see ctor)
+    std::vector<std::vector<uint32_t>> m_indices_per_class_scratch;
+    std::vector<uint32_t> m_detections_before_scratch;
+
+    // Temporal mode state (only maintained when the mode is enabled): the previous frame's
+    // surviving boxes, which the verify-first pass seeds the next frame's suppression with
+    bool m_temporal_suppression_enabled = false;
+    std::vector<DetectionBbox> m_previous_survivors;
 private:
     std::shared_ptr<NmsOpMetadata> m_nms_metadata;
 
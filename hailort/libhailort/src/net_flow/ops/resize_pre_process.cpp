@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file resize_pre_process.cpp
+ * @brief: Resize pre-process stage
+ **/
+
+#include "net_flow/ops/resize_pre_process.hpp"
+#include "hailo/hailort_common.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+// The implementation is compiled once in yolov5_seg_post_process.cpp
+#include "stb_image_resize.h"
+
+namespace hailort
+{
+namespace net_flow
+{
+
+Expected<std::shared_ptr<ResizePreProcessOp>> ResizePreProcessOp::create(const hailo_3d_image_shape_t &input_shape,
+    const hailo_3d_image_shape_t &output_shape, const hailo_format_t &format)
+{
+    CHECK_AS_EXPECTED(HAILO_FORMAT_ORDER_NHWC == format.order, HAILO_INVALID_ARGUMENT,
+        "Resize pre-process supports NHWC frames only");
+    CHECK_AS_EXPECTED((HAILO_FORMAT_TYPE_UINT8 == format.type) || (HAILO_FORMAT_TYPE_FLOAT32 == format.type),
+        HAILO_INVALID_ARGUMENT, "Resize pre-process supports uint8/float32 frames only");
+    CHECK_AS_EXPECTED(input_shape.features == output_shape.features, HAILO_INVALID_ARGUMENT,
+        "Resize cannot change the channels count ({} != {})", input_shape.features, output_shape.features);
+
+    auto op = make_shared_nothrow<ResizePreProcessOp>(input_shape, output_shape, format);
+    CHECK_NOT_NULL_AS_EXPECTED(op, HAILO_OUT_OF_HOST_MEMORY);
+    return op;
+}
+
+size_t ResizePreProcessOp::get_input_frame_size() const
+{
+    return HailoRTCommon::get_frame_size(m_input_shape, m_format);
+}
+
+size_t ResizePreProcessOp::get_output_frame_size() const
+{
+    return HailoRTCommon::get_frame_size(m_output_shape, m_format);
+}
+
+hailo_status ResizePreProcessOp::execute(const MemoryView &input, MemoryView output)
+{
+    CHECK(input.size() == get_input_frame_size(), HAILO_INVALID_ARGUMENT,
+        "Resize input size must be {}. passed size - {}", get_input_frame_size(), input.size());
+    CHECK(output.size() == get_output_frame_size(), HAILO_INVALID_ARGUMENT,
+        "Resize output size must be {}. passed size - {}", get_output_frame_size(), output.size());
+
+    int result = 0;
+    if (HAILO_FORMAT_TYPE_UINT8 == m_format.type) {
+        result = stbir_resize_uint8(input.data(), static_cast<int>(m_input_shape.width),
+            static_cast<int>(m_input_shape.height), 0,
+            output.data(), static_cast<int>(m_output_shape.width),
+            static_cast<int>(m_output_shape.height), 0,
+            static_cast<int>(m_input_shape.features));
+    } else {
+        result = stbir_resize_float(reinterpret_cast<const float*>(input.data()),
+            static_cast<int>(m_input_shape.width), static_cast<int>(m_input_shape.height), 0,
+            reinterpret_cast<float*>(output.data()), static_cast<int>(m_output_shape.width),
+            static_cast<int>(m_output_shape.height), 0,
+            static_cast<int>(m_input_shape.features));
+    }
+    CHECK(1 == result, HAILO_INTERNAL_FAILURE, "Frame resize failed");
+
+    return HAILO_SUCCESS;
+}
+
+} /* namespace net_flow */
+} /* namespace hailort */
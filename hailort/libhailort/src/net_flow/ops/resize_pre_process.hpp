@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file resize_pre_process.hpp
+ * @brief: Resize pre-process stage - scales NHWC camera frames to the model input resolution
+ *         inside the pipeline (SIMD-accelerated bilinear kernels via stb_image_resize), so
+ *         applications stop paying an extra full-frame resize copy outside the library.
+ **/
+
+#ifndef _HAILO_RESIZE_PRE_PROCESS_HPP_
+#define _HAILO_RESIZE_PRE_PROCESS_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+
+#include <memory>
+
+namespace hailort
+{
+namespace net_flow
+{
+
+class ResizePreProcessOp final
+{
+public:
+    /**
+     * Creates a resize stage from @a input_shape to @a output_shape. Supported on NHWC frames of
+     * type uint8 or float32 (the common camera and pre-quantization formats).
+     */
+    static Expected<std::shared_ptr<ResizePreProcessOp>> create(const hailo_3d_image_shape_t &input_shape,
+        const hailo_3d_image_shape_t &output_shape, const hailo_format_t &format);
+
+    /**
+     * Resizes the frame in @a input into @a output (bilinear). Both views must match the shapes
+     * given at creation.
+     */
+    hailo_status execute(const MemoryView &input, MemoryView output);
+
+    size_t get_input_frame_size() const;
+    size_t get_output_frame_size() const;
+
+    ResizePreProcessOp(const hailo_3d_image_shape_t &input_shape, const hailo_3d_image_shape_t &output_shape,
+        const hailo_format_t &format) :
+        m_input_shape(input_shape),
+        m_output_shape(output_shape),
+        m_format(format)
+    {}
+
+private:
+    const hailo_3d_image_shape_t m_input_shape;
+    const hailo_3d_image_shape_t m_output_shape;
+    const hailo_format_t m_format;
+};
+
+} /* namespace net_flow */
+} /* namespace hailort */
+
+#endif /* _HAILO_RESIZE_PRE_PROCESS_HPP_ */
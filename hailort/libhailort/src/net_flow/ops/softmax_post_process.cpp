@@ -8,6 +8,7 @@
  **/
 
 #include "softmax_post_process.hpp"
+#include "net_flow/ops/kernel_registry.hpp"
 #include "hailo/hailort.h"
 #include "hailo/hailort_common.hpp"
 #include "hailo/hailort_defaults.hpp"
@@ -16,6 +17,17 @@
 
 #include <limits>
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define HAILO_SOFTMAX_SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON)
+#define HAILO_SOFTMAX_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
 namespace hailort
 {
 namespace net_flow
@@ -34,8 +46,179 @@ hailo_status SoftmaxPostProcessOp::execute_not_supported(const BufferMetaData &i
         return HAILO_INVALID_ARGUMENT;
     }
 
+#ifdef HAILO_SOFTMAX_SIMD_X86
+
+#ifdef _MSC_VER
+#define HAILO_SOFTMAX_TARGET_AVX2
+#else
+#define HAILO_SOFTMAX_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+
+// Polynomial exp approximation (cephes style) - relative error below 1e-6, which keeps the
+// softmax output within the required 1e-5 of the scalar std::exp path. Valid for x <= 0,
+// which holds after the max-subtract pass.
+HAILO_SOFTMAX_TARGET_AVX2
+static inline __m256 softmax_exp_avx2(__m256 x)
+{
+    const __m256 log2e = _mm256_set1_ps(1.442695040888963f);
+    const __m256 ln2_hi = _mm256_set1_ps(0.693359375f);
+    const __m256 ln2_lo = _mm256_set1_ps(-2.12194440e-4f);
+    const __m256 round_magic = _mm256_set1_ps(12582912.0f); // 1.5 * 2^23 - round to nearest
+
+    x = _mm256_max_ps(x, _mm256_set1_ps(-87.0f)); // below that e^x underflows anyway
+
+    const __m256 n = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(x, log2e), round_magic), round_magic);
+    __m256 r = _mm256_fnmadd_ps(n, ln2_hi, x);
+    r = _mm256_fnmadd_ps(n, ln2_lo, r);
+
+    __m256 p = _mm256_set1_ps(1.9875691500e-4f);
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(1.3981999507e-3f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(8.3334519073e-3f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(4.1665795894e-2f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(1.6666665459e-1f));
+    p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(5.0000001201e-1f));
+    p = _mm256_fmadd_ps(p, _mm256_mul_ps(r, r), _mm256_add_ps(r, _mm256_set1_ps(1.0f)));
+
+    // Scale by 2^n through the float exponent bits
+    const __m256i exponent = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(p, _mm256_castsi256_ps(exponent));
+}
+
+HAILO_SOFTMAX_TARGET_AVX2
+static void softmax_avx2(float32_t *src, float32_t *dst, size_t num_of_elements)
+{
+    // Max pass
+    __m256 max_vec = _mm256_set1_ps(-std::numeric_limits<float32_t>::infinity());
+    size_t i = 0;
+    for (; i + 8 <= num_of_elements; i += 8) {
+        max_vec = _mm256_max_ps(max_vec, _mm256_loadu_ps(src + i));
+    }
+    float32_t max_val = -std::numeric_limits<float32_t>::infinity();
+    float32_t max_lanes[8];
+    _mm256_storeu_ps(max_lanes, max_vec);
+    for (size_t lane = 0; lane < 8; lane++) {
+        max_val = std::max(max_val, max_lanes[lane]);
+    }
+    for (; i < num_of_elements; i++) {
+        max_val = std::max(max_val, src[i]);
+    }
+
+    // Fused subtract-exp-accumulate pass
+    const __m256 max_bcast = _mm256_set1_ps(max_val);
+    __m256 sum_vec = _mm256_setzero_ps();
+    float32_t sum_exp = 0;
+    for (i = 0; i + 8 <= num_of_elements; i += 8) {
+        const __m256 e = softmax_exp_avx2(_mm256_sub_ps(_mm256_loadu_ps(src + i), max_bcast));
+        _mm256_storeu_ps(dst + i, e);
+        sum_vec = _mm256_add_ps(sum_vec, e);
+    }
+    float32_t sum_lanes[8];
+    _mm256_storeu_ps(sum_lanes, sum_vec);
+    for (size_t lane = 0; lane < 8; lane++) {
+        sum_exp += sum_lanes[lane];
+    }
+    for (; i < num_of_elements; i++) {
+        dst[i] = std::exp(src[i] - max_val);
+        sum_exp += dst[i];
+    }
+
+    // Normalize
+    const __m256 sum_bcast = _mm256_set1_ps(sum_exp);
+    for (i = 0; i + 8 <= num_of_elements; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_div_ps(_mm256_loadu_ps(dst + i), sum_bcast));
+    }
+    for (; i < num_of_elements; i++) {
+        dst[i] /= sum_exp;
+    }
+}
+
+#endif /* HAILO_SOFTMAX_SIMD_X86 */
+
+#ifdef HAILO_SOFTMAX_SIMD_NEON
+
+// Same polynomial as the x86 path (see softmax_exp_avx2)
+static inline float32x4_t softmax_exp_neon(float32x4_t x)
+{
+    const float32x4_t log2e = vdupq_n_f32(1.442695040888963f);
+    const float32x4_t ln2_hi = vdupq_n_f32(0.693359375f);
+    const float32x4_t ln2_lo = vdupq_n_f32(-2.12194440e-4f);
+    const float32x4_t round_magic = vdupq_n_f32(12582912.0f);
+
+    x = vmaxq_f32(x, vdupq_n_f32(-87.0f));
+
+    const float32x4_t n = vsubq_f32(vaddq_f32(vmulq_f32(x, log2e), round_magic), round_magic);
+    float32x4_t r = vmlsq_f32(x, n, ln2_hi);
+    r = vmlsq_f32(r, n, ln2_lo);
+
+    float32x4_t p = vdupq_n_f32(1.9875691500e-4f);
+    p = vmlaq_f32(vdupq_n_f32(1.3981999507e-3f), p, r);
+    p = vmlaq_f32(vdupq_n_f32(8.3334519073e-3f), p, r);
+    p = vmlaq_f32(vdupq_n_f32(4.1665795894e-2f), p, r);
+    p = vmlaq_f32(vdupq_n_f32(1.6666665459e-1f), p, r);
+    p = vmlaq_f32(vdupq_n_f32(5.0000001201e-1f), p, r);
+    p = vmlaq_f32(vaddq_f32(r, vdupq_n_f32(1.0f)), p, vmulq_f32(r, r));
+
+    const int32x4_t exponent = vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127)), 23);
+    return vmulq_f32(p, vreinterpretq_f32_s32(exponent));
+}
+
+static void softmax_neon(float32_t *src, float32_t *dst, size_t num_of_elements)
+{
+    float32x4_t max_vec = vdupq_n_f32(-std::numeric_limits<float32_t>::infinity());
+    size_t i = 0;
+    for (; i + 4 <= num_of_elements; i += 4) {
+        max_vec = vmaxq_f32(max_vec, vld1q_f32(src + i));
+    }
+    float32x2_t max_pair = vmax_f32(vget_low_f32(max_vec), vget_high_f32(max_vec));
+    float32_t max_val = std::max(vget_lane_f32(max_pair, 0), vget_lane_f32(max_pair, 1));
+    for (; i < num_of_elements; i++) {
+        max_val = std::max(max_val, src[i]);
+    }
+
+    const float32x4_t max_bcast = vdupq_n_f32(max_val);
+    float32x4_t sum_vec = vdupq_n_f32(0.0f);
+    float32_t sum_exp = 0;
+    for (i = 0; i + 4 <= num_of_elements; i += 4) {
+        const float32x4_t e = softmax_exp_neon(vsubq_f32(vld1q_f32(src + i), max_bcast));
+        vst1q_f32(dst + i, e);
+        sum_vec = vaddq_f32(sum_vec, e);
+    }
+    const float32x2_t sum_pair = vadd_f32(vget_low_f32(sum_vec), vget_high_f32(sum_vec));
+    sum_exp += vget_lane_f32(sum_pair, 0) + vget_lane_f32(sum_pair, 1);
+    for (; i < num_of_elements; i++) {
+        dst[i] = std::exp(src[i] - max_val);
+        sum_exp += dst[i];
+    }
+
+    for (size_t c = 0; c < num_of_elements; c++) {
+        dst[c] /= sum_exp;
+    }
+}
+
+#endif /* HAILO_SOFTMAX_SIMD_NEON */
+
+using SoftmaxKernel = void (*)(float32_t *, float32_t *, size_t);
+
+#if defined(HAILO_SOFTMAX_SIMD_X86)
+// The registry's lookup only hands the AVX2 variant out when the CPU (and OS ymm state) supports
+// AVX2+FMA - detection lives in one place (KernelRegistry::detect_cpu_isa) instead of per op
+static KernelRegistration g_softmax_avx2_registration("softmax", HAILO_FORMAT_TYPE_FLOAT32,
+    HAILO_FORMAT_ORDER_NHWC, KernelIsa::AVX2, (void*)&softmax_avx2);
+#elif defined(HAILO_SOFTMAX_SIMD_NEON)
+static KernelRegistration g_softmax_neon_registration("softmax", HAILO_FORMAT_TYPE_FLOAT32,
+    HAILO_FORMAT_ORDER_NHWC, KernelIsa::NEON, (void*)&softmax_neon);
+#endif
+
 hailo_status SoftmaxPostProcessOp::softmax(float32_t *src, float32_t *dst, size_t num_of_elements)
 {
+    // Kernel dispatch through the central registry (runtime CPU detection + HAILO_KERNEL_ISA cap)
+    static SoftmaxKernel simd_kernel = reinterpret_cast<SoftmaxKernel>(
+        KernelRegistry::instance().lookup("softmax", HAILO_FORMAT_TYPE_FLOAT32, HAILO_FORMAT_ORDER_NHWC));
+    if ((nullptr != simd_kernel) && (num_of_elements >= 8)) {
+        simd_kernel(src, dst, num_of_elements);
+        return HAILO_SUCCESS;
+    }
+
     // In order to avoid overflows, we will perform the following:
     // We find the maximal value and then we substract it from all of the values.
     // This will preserve the original softmax values + prevent overflows
@@ -87,8 +270,8 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
         {
             // NHWC x FLOAT32
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of AUTO
-            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
-            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
+            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis_fixed_point<uint8_t>,
+            SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis_fixed_point<uint16_t>,
             SoftmaxPostProcessOp::NHWC_to_NHWC_feature_axis<float32_t, float32_t>
         }
     },
@@ -120,8 +303,8 @@ SoftmaxFunction SoftmaxPostProcessOp::m_softmax_function_array[SOFTMAX_NUM_OF_PO
         {
             // NC x FLOAT32
             SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of AUTO
-            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT8
-            SoftmaxPostProcessOp::execute_not_supported, // We don't support output_format_type format of UINT16
+            SoftmaxPostProcessOp::NC_to_NC_fixed_point<uint8_t>,
+            SoftmaxPostProcessOp::NC_to_NC_fixed_point<uint16_t>,
             SoftmaxPostProcessOp::NC_to_NC<float32_t, float32_t>,
         }
     }
@@ -207,10 +390,14 @@ hailo_status SoftmaxOpMetadata::validate_format_info()
         HAILO_INVALID_OPERATION, "The given input format type {} is not supported, should be {}",
         HailoRTCommon::get_format_type_str(input_metadata.format.type),
         HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
-    CHECK(output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32,
-        HAILO_INVALID_OPERATION, "The given output format type {} is not valid, should be {}",
+    CHECK((output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32) ||
+        (output_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) ||
+        (output_metadata.format.type == HAILO_FORMAT_TYPE_UINT16),
+        HAILO_INVALID_OPERATION, "The given output format type {} is not valid, should be {}, {} or {}",
         HailoRTCommon::get_format_type_str(output_metadata.format.type),
-        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32),
+        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8),
+        HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16));
     CHECK(!(HAILO_FORMAT_FLAGS_HOST_ARGMAX & output_metadata.format.flags), HAILO_INVALID_ARGUMENT, "Output {} is marked as argmax, which is not supported for this model.",
         m_outputs_metadata.begin()->first);
 
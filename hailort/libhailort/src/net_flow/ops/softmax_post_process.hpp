@@ -22,6 +22,9 @@
 
 #include <iostream>
 
+#include <limits>
+#include <vector>
+
 namespace hailort
 {
 namespace net_flow
@@ -100,6 +103,60 @@ private:
         return HAILO_SUCCESS;
     }
 
+    // Fixed-point output variants - the softmax still runs in float, and the probabilities are
+    // emitted as fixed-point (probability * integer max), letting integer-only consumers skip any
+    // further conversion
+    template<typename dst_type>
+    static hailo_status NHWC_to_NHWC_feature_axis_fixed_point(const BufferMetaData &input_metadata,
+        const BufferMetaData &output_metadata, const std::map<std::string, MemoryView> &inputs,
+        std::map<std::string, MemoryView> &outputs)
+    {
+        auto src_ptr = (float32_t*)inputs.begin()->second.data();
+        auto dst_ptr = (dst_type*)outputs.begin()->second.data();
+        const auto src_row_size = input_metadata.shape.width * input_metadata.shape.features;
+        const auto dst_row_size = output_metadata.shape.width * output_metadata.shape.features;
+        const auto features = input_metadata.shape.features;
+
+        thread_local std::vector<float32_t> softmax_scratch;
+        softmax_scratch.resize(features);
+
+        constexpr auto FIXED_POINT_MAX = static_cast<float32_t>(std::numeric_limits<dst_type>::max());
+        for (uint32_t r = 0; r < input_metadata.shape.height; r++) {
+            float32_t *src_row = src_ptr + (r * src_row_size);
+            dst_type *dst_row = dst_ptr + (r * dst_row_size);
+            for (uint32_t w = 0; w < input_metadata.shape.width; w++) {
+                float32_t *src_col = src_row + (w * features);
+                dst_type *dst_col = dst_row + (w * output_metadata.shape.features);
+                softmax(src_col, softmax_scratch.data(), features);
+                for (uint32_t c = 0; c < features; c++) {
+                    dst_col[c] = static_cast<dst_type>((softmax_scratch[c] * FIXED_POINT_MAX) + 0.5f);
+                }
+            }
+        }
+        return HAILO_SUCCESS;
+    }
+
+    template<typename dst_type>
+    static hailo_status NC_to_NC_fixed_point(const BufferMetaData &input_metadata,
+        const BufferMetaData &output_metadata, const std::map<std::string, MemoryView> &inputs,
+        std::map<std::string, MemoryView> &outputs)
+    {
+        (void) output_metadata;
+        auto src_ptr = (float32_t*)inputs.begin()->second.data();
+        auto dst_ptr = (dst_type*)outputs.begin()->second.data();
+        const auto features = input_metadata.shape.features;
+
+        thread_local std::vector<float32_t> softmax_scratch;
+        softmax_scratch.resize(features);
+
+        constexpr auto FIXED_POINT_MAX = static_cast<float32_t>(std::numeric_limits<dst_type>::max());
+        softmax(src_ptr, softmax_scratch.data(), features);
+        for (uint32_t c = 0; c < features; c++) {
+            dst_ptr[c] = static_cast<dst_type>((softmax_scratch[c] * FIXED_POINT_MAX) + 0.5f);
+        }
+        return HAILO_SUCCESS;
+    }
+
     static hailo_status execute_not_supported(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
         const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs);
 
@@ -176,21 +176,27 @@ hailo_status SSDPostProcessOp::extract_detections(const std::string &reg_input_n
 
     auto reg_row_size = reg_padded_shape.width * reg_padded_shape.features;
     auto cls_row_size = cls_padded_shape.width * cls_padded_shape.features;
+
+    // Anchor decode constants - everything that doesn't depend on the grid cell is resolved once
+    // per layer instead of per box (strides, center offsets, input dtype and the per-anchor
+    // dimensions), leaving only the per-cell centers in the loop
+    const auto anchor_w_stride = 1.0f / static_cast<float32_t>(reg_shape.width);
+    const auto anchor_h_stride = 1.0f / static_cast<float32_t>(reg_shape.height);
+    const auto anchor_w_offset = 0.5f * anchor_w_stride;
+    const auto anchor_h_offset = 0.5f * anchor_h_stride;
+    const auto reg_format_type = inputs_metadata.at(reg_input_name).format.type;
+
     for (uint32_t row = 0; row < reg_shape.height; row++) {
+        const auto ycenter_a = static_cast<float32_t>(row) * anchor_h_stride + anchor_h_offset;
         for (uint32_t col = 0; col < reg_shape.width; col++) {
+            const auto xcenter_a = static_cast<float32_t>(col) * anchor_w_stride + anchor_w_offset;
             for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
                 auto reg_idx = (reg_row_size * row) + col + ((anchor * reg_entry_size) * reg_padded_shape.width);
                 auto cls_idx = (cls_row_size * row) + col + ((anchor * cls_entry_size) * cls_padded_shape.width);
                 const auto &wa = layer_anchors[anchor * 2];
                 const auto &ha = layer_anchors[anchor * 2 + 1];
-                auto anchor_w_stride = 1.0f / static_cast<float32_t>(reg_shape.width);
-                auto anchor_h_stride = 1.0f / static_cast<float32_t>(reg_shape.height);
-                auto anchor_w_offset = 0.5f * anchor_w_stride;
-                auto anchor_h_offset = 0.5f * anchor_h_stride;
-                auto xcenter_a = static_cast<float32_t>(col) * anchor_w_stride + anchor_w_offset;
-                auto ycenter_a = static_cast<float32_t>(row) * anchor_h_stride + anchor_h_offset;
                 // Decode bboxes
-                if (inputs_metadata.at(reg_input_name).format.type == HAILO_FORMAT_TYPE_UINT8) {
+                if (reg_format_type == HAILO_FORMAT_TYPE_UINT8) {
                     auto status = extract_bbox_detections<float32_t, uint8_t>(
                         reg_input_name, cls_input_name,
                         reg_buffer, cls_buffer,
@@ -200,7 +206,7 @@ hailo_status SSDPostProcessOp::extract_detections(const std::string &reg_input_n
                         reg_idx + H_OFFSET,
                         cls_idx, wa, ha, xcenter_a, ycenter_a);
                     CHECK_SUCCESS(status);
-                } else if (inputs_metadata.at(reg_input_name).format.type == HAILO_FORMAT_TYPE_UINT16) {
+                } else if (reg_format_type == HAILO_FORMAT_TYPE_UINT16) {
                     auto status = extract_bbox_detections<float32_t, uint16_t>(
                         reg_input_name, cls_input_name,
                         reg_buffer, cls_buffer,
@@ -140,26 +140,60 @@ protected:
 
         auto row_size = padded_shape.width * padded_shape.features;
         SrcType *data = (SrcType*)buffer.data();
+
+        // Since dequantize+sigmoid is monotonic, the score threshold can be applied on the raw
+        // quantized objectness (conservatively, floor) - rejected entries pay no dequantization.
+        // The exact check below keeps the results bit-identical to the unfiltered path.
+        const SrcType raw_objectness_th = quantized_score_threshold<SrcType>(nms_config.nms_score_th, quant_info);
+
+        struct ProposalCandidate {
+            SrcType raw_objectness;
+            uint32_t entry_idx;
+            uint16_t col;
+            uint16_t row;
+            uint8_t anchor;
+        };
+        std::vector<ProposalCandidate> candidates;
+
         for (uint32_t row = 0; row < shape.height; row++) {
             for (uint32_t col = 0; col < shape.width; col++) {
                 for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
                     auto entry_idx = (row_size * row) + col + ((anchor * entry_size) * padded_shape.width);
-                    auto objectness = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + OBJECTNESS_OFFSET], quant_info);
-                    if (objectness < nms_config.nms_score_th) {
+                    const auto raw_objectness = data[entry_idx + OBJECTNESS_OFFSET];
+                    if (raw_objectness < raw_objectness_th) {
                         continue;
                     }
+                    candidates.emplace_back(ProposalCandidate{raw_objectness, entry_idx,
+                        static_cast<uint16_t>(col), static_cast<uint16_t>(row), static_cast<uint8_t>(anchor)});
+                }
+            }
+        }
 
-                    auto tx = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + X_OFFSET], quant_info);
-                    auto ty = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + Y_OFFSET], quant_info);
-                    auto tw = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + W_OFFSET], quant_info);
-                    auto th = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + H_OFFSET], quant_info);
-                    auto bbox = decode(tx, ty, tw, th, layer_anchors[anchor * 2], layer_anchors[anchor * 2 + 1], col, row,
-                        shape.width, shape.height);
+        // Optional top-K pre-selection - partial select on the raw quantized scores, so only K
+        // candidates per layer get fully decoded
+        const auto top_k = nms_config.pre_nms_top_k;
+        if ((top_k > 0) && (candidates.size() > top_k)) {
+            std::nth_element(candidates.begin(), candidates.begin() + top_k, candidates.end(),
+                [](const ProposalCandidate &a, const ProposalCandidate &b) { return a.raw_objectness > b.raw_objectness; });
+            candidates.resize(top_k);
+        }
 
-                    decode_classes_scores(bbox, quant_info, data, entry_idx,
-                        CLASSES_START_INDEX, objectness, padded_shape.width);
-                }
+        for (const auto &candidate : candidates) {
+            const auto entry_idx = candidate.entry_idx;
+            auto objectness = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + OBJECTNESS_OFFSET], quant_info);
+            if (objectness < nms_config.nms_score_th) {
+                continue;
             }
+
+            auto tx = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + X_OFFSET], quant_info);
+            auto ty = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + Y_OFFSET], quant_info);
+            auto tw = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + W_OFFSET], quant_info);
+            auto th = dequantize_and_sigmoid<DstType, SrcType>(data[entry_idx + H_OFFSET], quant_info);
+            auto bbox = decode(tx, ty, tw, th, layer_anchors[candidate.anchor * 2], layer_anchors[candidate.anchor * 2 + 1],
+                candidate.col, candidate.row, shape.width, shape.height);
+
+            decode_classes_scores(bbox, quant_info, data, entry_idx,
+                CLASSES_START_INDEX, objectness, padded_shape.width);
         }
 
         return HAILO_SUCCESS;
@@ -146,13 +146,14 @@ hailo_status Yolov5SegPostProcess::execute(const std::map<std::string, MemoryVie
         CHECK(((input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) || (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8)),
             HAILO_INVALID_ARGUMENT, "YOLO post-process received invalid input type {}", input_metadata.format.type);
 
-        // Prepare proto layer
+        // Prepare proto layer - lazily. The full-tensor dequantize+reorder only runs if any
+        // detection survives NMS and actually needs a mask (see ensure_proto_layer_transformed),
+        // so empty frames skip the heaviest pass entirely.
         if (name == yolov5seg_config.proto_layer_name) {
-            if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) {
-                transform_proto_layer<float32_t, uint8_t>((uint8_t*)name_to_input.second.data(), input_metadata.quant_info);
-            } else if (input_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) {
-                transform_proto_layer<float32_t, uint16_t>((uint16_t*)name_to_input.second.data(), input_metadata.quant_info);
-            }
+            m_proto_input = name_to_input.second;
+            m_proto_quant_info = input_metadata.quant_info;
+            m_proto_format_type = input_metadata.format.type;
+            m_proto_transformed = false;
             // Skip bbox extraction if the input is proto layer (the mask layer)
             continue;
         }
@@ -168,13 +169,35 @@ hailo_status Yolov5SegPostProcess::execute(const std::map<std::string, MemoryVie
         CHECK_SUCCESS(status);
     }
 
-    remove_overlapping_boxes(m_detections, m_classes_detections_count, m_metadata->nms_config().nms_iou_th);
+    remove_overlapping_boxes(m_detections, m_classes_detections_count, m_metadata->nms_config().nms_iou_th,
+        &m_indices_per_class_scratch);
+
+    for (const auto &class_count : m_classes_detections_count) {
+        if (class_count > 0) {
+            ensure_proto_layer_transformed();
+            break;
+        }
+    }
+
     auto status = fill_nms_with_byte_mask_format(outputs.begin()->second);
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
 }
 
+void Yolov5SegPostProcess::ensure_proto_layer_transformed()
+{
+    if (m_proto_transformed || m_proto_input.empty()) {
+        return;
+    }
+    if (HAILO_FORMAT_TYPE_UINT8 == m_proto_format_type) {
+        transform_proto_layer<float32_t, uint8_t>((uint8_t*)m_proto_input.data(), m_proto_quant_info);
+    } else if (HAILO_FORMAT_TYPE_UINT16 == m_proto_format_type) {
+        transform_proto_layer<float32_t, uint16_t>((uint16_t*)m_proto_input.data(), m_proto_quant_info);
+    }
+    m_proto_transformed = true;
+}
+
 uint32_t Yolov5SegPostProcess::get_entry_size()
 {
     return (CLASSES_START_INDEX + m_metadata->nms_config().number_of_classes + MASK_COEFFICIENT_SIZE);
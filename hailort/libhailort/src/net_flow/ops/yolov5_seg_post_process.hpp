@@ -79,6 +79,15 @@ private:
     // TODO: HRT-11734 - Try use one buffer for both actions
     Buffer m_transformed_proto_buffer;
     Buffer m_dequantized_proto_buffer;
+
+    // Lazy proto decode state - the proto tensor is transformed only when a surviving detection
+    // needs a mask (valid within one execute() call)
+    MemoryView m_proto_input;
+    hailo_quant_info_t m_proto_quant_info{};
+    hailo_format_type_t m_proto_format_type = HAILO_FORMAT_TYPE_AUTO;
+    bool m_proto_transformed = false;
+
+    void ensure_proto_layer_transformed();
 };
 
 } /* namespace hailort */
@@ -134,16 +134,24 @@ hailo_bbox_float32_t YOLOV8PostProcessOp::get_bbox(uint32_t row, uint32_t col, u
         tmp_vector[feature % (reg_padded_shape.features / NUM_OF_D_VALUES)] = Quantization::dequantize_output<DstType, SrcType>(reg_data[reg_idx + feature*reg_feature_size], reg_quant_info);
     }
 
-    // Performing softmax operation on each of the vectors
-    for (uint32_t vector_index = 0; vector_index < d_matrix.size(); vector_index++) {
-        auto &tmp_vector = d_matrix.at(vector_index);
-        SoftmaxPostProcessOp::softmax(tmp_vector.data(), tmp_vector.data(), tmp_vector.size());
-    }
-
-    // Performing dot product on each vector
-    // (A, B, C, ..., F, G) -> 0*A + 1*B + 2*C + ... + 14*F + 15*G
+    // Fused DFL expectation - the softmax normalization cancels inside the expectation
+    // (sum(i * e^xi) / sum(e^xi)), so each bin vector costs one exp pass and a single divide
+    // instead of a full softmax (with a divide per bin) followed by a dot product. The exp loop
+    // over the contiguous bins auto-vectorizes.
     for (uint32_t vector_index = 0; vector_index < NUM_OF_D_VALUES; vector_index++) {
-        m_d_values_matrix[vector_index] = dot_product(d_matrix.at(vector_index));
+        const auto &bins = d_matrix.at(vector_index);
+        auto max_logit = bins[0];
+        for (size_t bin = 1; bin < bins.size(); bin++) {
+            max_logit = std::max(max_logit, bins[bin]);
+        }
+        float32_t exp_sum = 0;
+        float32_t weighted_sum = 0;
+        for (size_t bin = 0; bin < bins.size(); bin++) {
+            const auto e = std::exp(bins[bin] - max_logit);
+            exp_sum += e;
+            weighted_sum += static_cast<float32_t>(bin) * e;
+        }
+        m_d_values_matrix[vector_index] = weighted_sum / exp_sum;
     }
 
     // The decode function extract x_min, y_min, x_max, y_max from d1, d2, d3, d4
@@ -65,6 +65,18 @@ void InferModel::InferStream::Impl::set_format_order(hailo_format_order_t order)
     m_user_buffer_format.order = order;
 }
 
+hailo_format_t InferModel::InferStream::Impl::get_native_format() const
+{
+    // The vstream info's format is the device-side format - using it as the user format makes
+    // every transformation step a no-op
+    return m_vstream_info.format;
+}
+
+void InferModel::InferStream::Impl::set_native_format()
+{
+    m_user_buffer_format = get_native_format();
+}
+
 bool InferModel::InferStream::Impl::is_nms() const
 {
     return HailoRTCommon::is_nms(m_vstream_info.format.order);
@@ -130,6 +142,16 @@ void InferModel::InferStream::set_format_order(hailo_format_order_t order)
     m_pimpl->set_format_order(order);
 }
 
+hailo_format_t InferModel::InferStream::get_native_format() const
+{
+    return m_pimpl->get_native_format();
+}
+
+void InferModel::InferStream::set_native_format()
+{
+    m_pimpl->set_native_format();
+}
+
 bool InferModel::InferStream::is_nms() const
 {
     return m_pimpl->is_nms();
@@ -378,6 +400,11 @@ Expected<AsyncInferJob> ConfiguredInferModel::run_async(ConfiguredInferModel::Bi
     return m_pimpl->run_async(bindings, callback);
 }
 
+void ConfiguredInferModel::set_completion_executor(std::function<void(std::function<void()>)> executor)
+{
+    m_pimpl->set_completion_executor(std::move(executor));
+}
+
 Expected<LatencyMeasurementResult> ConfiguredInferModel::get_hw_latency_measurement(const std::string &network_name)
 {
     return m_pimpl->get_hw_latency_measurement(network_name);
@@ -562,7 +589,14 @@ Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async(ConfiguredInferModel
                 job_pimpl->completion_status() : m_async_infer_runner->get_pipeline_status();
 
             AsyncInferCompletionInfo completion_info(bindings, final_status);
-            callback(completion_info);
+            if (m_completion_executor) {
+                // Hand the user completion to the application's executor instead of running it on
+                // the dispatcher thread
+                auto user_callback = callback;
+                m_completion_executor([user_callback, completion_info]() { user_callback(completion_info); });
+            } else {
+                callback(completion_info);
+            }
             job_pimpl->mark_callback_done();
         }
     };
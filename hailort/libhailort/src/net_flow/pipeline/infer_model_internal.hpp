@@ -56,6 +56,8 @@ public:
     std::vector<hailo_quant_info_t> get_quant_infos() const;
     void set_format_type(hailo_format_type_t type);
     void set_format_order(hailo_format_order_t order);
+    hailo_format_t get_native_format() const;
+    void set_native_format();
 
     bool is_nms() const;
     void set_nms_score_threshold(float32_t threshold);
@@ -110,6 +112,10 @@ public:
     hailo_status run(ConfiguredInferModel::Bindings bindings, std::chrono::milliseconds timeout);
     Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback);
+    void set_completion_executor(std::function<void(std::function<void()>)> executor)
+    {
+        m_completion_executor = std::move(executor);
+    }
     Expected<LatencyMeasurementResult> get_hw_latency_measurement(const std::string &network_name);
     hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout);
     hailo_status set_scheduler_threshold(uint32_t threshold);
@@ -126,6 +132,8 @@ private:
     std::unique_ptr<ActivatedNetworkGroup> m_ang;
     std::shared_ptr<AsyncInferRunnerImpl> m_async_infer_runner;
     uint32_t m_ongoing_parallel_transfers;
+    // Optional executor for user completion callbacks (see set_completion_executor)
+    std::function<void(std::function<void()>)> m_completion_executor;
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::vector<std::string> m_input_names;
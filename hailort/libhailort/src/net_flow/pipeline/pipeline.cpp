@@ -15,6 +15,11 @@
 #include "hailo/hailort.h"
 #include "net_flow/pipeline/pipeline.hpp"
 #include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
 namespace hailort
 {
@@ -304,7 +309,12 @@ Expected<BufferPoolPtr> BufferPool::create(size_t buffer_size, size_t buffer_cou
     }
     const bool measure_vstream_latency = (vstream_flags & HAILO_VSTREAM_STATS_MEASURE_LATENCY) != 0;
 
-    auto free_mem_views = SpscQueue<MemoryView>::create(buffer_count, shutdown_event, BUFFER_POOL_DEFAULT_QUEUE_TIMEOUT);
+    // With the "grow" exhaustion policy up to buffer_count overflow buffers can join the pool -
+    // the free queue must have room for their views too, or releasing them would block/drop
+    static const char *pool_exhaustion_policy = std::getenv("HAILO_POOL_EXHAUSTION");
+    const bool grow_on_exhaustion = ((nullptr != pool_exhaustion_policy) && (0 == strcmp(pool_exhaustion_policy, "grow")));
+    const auto free_views_capacity = grow_on_exhaustion ? (2 * buffer_count) : buffer_count;
+    auto free_mem_views = SpscQueue<MemoryView>::create(free_views_capacity, shutdown_event, BUFFER_POOL_DEFAULT_QUEUE_TIMEOUT);
     CHECK_EXPECTED(free_mem_views);
 
     auto done_cbs = SpscQueue<TransferDoneCallbackAsyncInfer>::create(buffer_count, shutdown_event, BUFFER_POOL_DEFAULT_QUEUE_TIMEOUT);
@@ -312,29 +322,79 @@ Expected<BufferPoolPtr> BufferPool::create(size_t buffer_size, size_t buffer_cou
 
     std::vector<Buffer> buffers;
     if (!is_empty) {
-        buffers.reserve(buffer_count);
-        for (size_t i = 0; i < buffer_count; i++) {
-            BufferStorageParams buffer_storage_params;
-            if (is_dma_able) {
-                buffer_storage_params = BufferStorageParams::create_dma();
-            }
-            auto buffer = Buffer::create(buffer_size, buffer_storage_params);
-            CHECK_EXPECTED(buffer);
+        if (is_dma_able) {
+            // DMA-able buffers are mapped individually, so they cannot be carved from one arena
+            buffers.reserve(buffer_count);
+            for (size_t i = 0; i < buffer_count; i++) {
+                auto buffer = Buffer::create(buffer_size, BufferStorageParams::create_dma());
+                CHECK_EXPECTED(buffer);
 
-            auto status = free_mem_views->enqueue(MemoryView(buffer.value()));
-            CHECK_SUCCESS_AS_EXPECTED(status);
+                auto status = free_mem_views->enqueue(MemoryView(buffer.value()));
+                CHECK_SUCCESS_AS_EXPECTED(status);
 
-            buffers.emplace_back(buffer.release());
+                buffers.emplace_back(buffer.release());
+            }
+        } else if (buffer_count > 0) {
+            // All the frame buffers are carved as aligned slots from a single arena, avoiding
+            // per-frame heap allocations and letting the kernel coalesce the arena into hugepages
+            auto arena = allocate_arena(buffer_size, buffer_count);
+            CHECK_EXPECTED(arena);
+
+            const auto slot_size = arena_slot_size(buffer_size);
+            for (size_t i = 0; i < buffer_count; i++) {
+                auto status = free_mem_views->enqueue(MemoryView(arena->data() + (i * slot_size), buffer_size));
+                CHECK_SUCCESS_AS_EXPECTED(status);
+            }
+            buffers.emplace_back(arena.release());
         }
     }
 
     auto buffer_pool_ptr = make_shared_nothrow<BufferPool>(buffer_size, is_empty, measure_vstream_latency, std::move(buffers),
         free_mem_views.release(), done_cbs.release(), std::move(queue_size_accumulator), buffer_count);
+    if (nullptr != buffer_pool_ptr) {
+        buffer_pool_ptr->m_is_dma_able = is_dma_able;
+    }
     CHECK_AS_EXPECTED(nullptr != buffer_pool_ptr, HAILO_OUT_OF_HOST_MEMORY);
 
+    // Pre-fault the pool pages now, instead of paying the page faults on the first frames
+    auto status = buffer_pool_ptr->reserve();
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
     return buffer_pool_ptr;
 }
 
+size_t BufferPool::arena_slot_size(size_t buffer_size)
+{
+    // Cache-line alignment keeps neighbor slots from sharing lines
+    static const size_t BUFFER_POOL_ARENA_SLOT_ALIGNMENT = 64;
+    return HailoRTCommon::align_to(buffer_size, BUFFER_POOL_ARENA_SLOT_ALIGNMENT);
+}
+
+Expected<Buffer> BufferPool::allocate_arena(size_t buffer_size, size_t buffer_count)
+{
+    auto arena = Buffer::create(arena_slot_size(buffer_size) * buffer_count);
+    CHECK_EXPECTED(arena);
+
+#if defined(__linux__)
+    // Best effort - lets the kernel back the arena with transparent hugepages
+    (void)madvise(arena->data(), arena->size(), MADV_HUGEPAGE);
+#endif
+
+    return arena;
+}
+
+hailo_status BufferPool::reserve()
+{
+    const auto page_size = OsUtils::get_page_size();
+    for (auto &buffer : m_buffers) {
+        auto *data = buffer.data();
+        for (size_t offset = 0; offset < buffer.size(); offset += page_size) {
+            data[offset] = 0;
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
 BufferPool::BufferPool(size_t buffer_size, bool is_holding_user_buffers, bool measure_vstream_latency, std::vector<Buffer> &&buffers,
         SpscQueue<MemoryView> &&free_mem_views, SpscQueue<TransferDoneCallbackAsyncInfer> &&done_cbs, AccumulatorPtr &&queue_size_accumulator,
         size_t max_buffer_count) :
@@ -349,6 +409,15 @@ BufferPool::BufferPool(size_t buffer_size, bool is_holding_user_buffers, bool me
 {
 }
 
+// TODO: slab-recycled PipelineBuffer/callback contexts (HRT wishlist):
+//       At high FPS the per-frame wrapper state still costs heap traffic in two places:
+//         - TransferDoneCallbackAsyncInfer closures (std::function captures above the SBO size),
+//         - PipelineBuffer metadata payloads (user objects, additional data).
+//       The plan: a per-pipeline slab of fixed-size callback context blocks (the capture sets are
+//       known per element type and small), with std::function replaced on those paths by a
+//       lightweight callable ref bound to a recycled block; PipelineBuffer itself is already a
+//       value type cycled through the pools, so no recycler is needed for the wrapper. Blocked on
+//       converting the element callbacks to the bounded-capture form first.
 size_t BufferPool::buffer_size()
 {
     return m_buffer_size;
@@ -396,25 +465,64 @@ hailo_status BufferPool::allocate_buffers(bool is_dma_able, size_t num_of_buffer
     m_is_holding_user_buffers = false;
     CHECK(m_free_mem_views.size_approx() == 0, HAILO_INTERNAL_FAILURE, "Cannot allocate buffers for pool, since pool is not empty!");
     m_max_buffer_count = num_of_buffers;
-    for (size_t i = 0; i < m_max_buffer_count; i++) {
-        BufferStorageParams buffer_storage_params;
-        if (is_dma_able) {
-            buffer_storage_params = BufferStorageParams::create_dma();
+    if (is_dma_able) {
+        for (size_t i = 0; i < m_max_buffer_count; i++) {
+            auto buffer = Buffer::create(m_buffer_size, BufferStorageParams::create_dma());
+            CHECK_EXPECTED_AS_STATUS(buffer);
+
+            auto status = m_free_mem_views.enqueue(MemoryView(buffer.value()));
+            CHECK_SUCCESS(status);
+            m_buffers.emplace_back(buffer.release());
         }
-        auto buffer = Buffer::create(m_buffer_size, buffer_storage_params);
-        CHECK_EXPECTED_AS_STATUS(buffer);
-
-        auto status = m_free_mem_views.enqueue(MemoryView(buffer.value()));
-        CHECK_SUCCESS(status);
-        m_buffers.emplace_back(buffer.release());
+    } else if (num_of_buffers > 0) {
+        auto arena = allocate_arena(m_buffer_size, num_of_buffers);
+        CHECK_EXPECTED_AS_STATUS(arena);
+
+        const auto slot_size = arena_slot_size(m_buffer_size);
+        for (size_t i = 0; i < num_of_buffers; i++) {
+            auto status = m_free_mem_views.enqueue(MemoryView(arena->data() + (i * slot_size), m_buffer_size));
+            CHECK_SUCCESS(status);
+        }
+        m_buffers.emplace_back(arena.release());
     }
-    return HAILO_SUCCESS;
+    return reserve();
 }
 
 Expected<PipelineBuffer> BufferPool::acquire_buffer(std::chrono::milliseconds timeout,
     bool ignore_shutdown_event)
 {
     auto mem_view = acquire_free_mem_view(timeout, ignore_shutdown_event);
+
+    // Degradation ladder on pool exhaustion (HAILO_POOL_EXHAUSTION):
+    //   grow - allocate an overflow buffer (bounded at 2x the configured pool) instead of
+    //          stalling the pipeline wholesale,
+    //   drop - fail this acquire immediately so the caller can drop the frame (counted).
+    // Default keeps the blocking behavior.
+    if ((HAILO_TIMEOUT == mem_view.status()) && (!m_is_holding_user_buffers)) {
+        static const char *exhaustion_policy = std::getenv("HAILO_POOL_EXHAUSTION");
+        if ((nullptr != exhaustion_policy) && (0 == strcmp(exhaustion_policy, "grow"))) {
+            std::lock_guard<std::mutex> lock(m_release_buffer_mutex);
+            // Bound by overflow allocations - m_buffers.size() is 1 for arena-backed pools, so it
+            // cannot express "2x the configured pool"
+            if (m_overflow_allocations.load() < m_max_buffer_count) {
+                // Same storage params as the pool's regular buffers - a DMA-able pool must hand
+                // out DMA-able overflow frames (a plain heap buffer would at best bounce-copy)
+                auto overflow_buffer = m_is_dma_able ?
+                    Buffer::create(m_buffer_size, BufferStorageParams::create_dma()) :
+                    Buffer::create(m_buffer_size);
+                if (overflow_buffer) {
+                    m_buffers.emplace_back(overflow_buffer.release());
+                    m_overflow_allocations++;
+                    return PipelineBuffer(MemoryView(m_buffers.back()), m_is_holding_user_buffers,
+                        shared_from_this(), m_measure_vstream_latency);
+                }
+            }
+        } else if ((nullptr != exhaustion_policy) && (0 == strcmp(exhaustion_policy, "drop"))) {
+            m_dropped_acquires++;
+            return make_unexpected(HAILO_TIMEOUT);
+        }
+    }
+
     if ((HAILO_SUCCESS != mem_view.status()) && (m_is_holding_user_buffers)) {
         auto done_cb = acquire_on_done_cb(timeout, true);
         CHECK_EXPECTED(done_cb);
@@ -450,14 +558,26 @@ Expected<std::shared_ptr<PipelineBuffer>> BufferPool::acquire_buffer_ptr(std::ch
     }
     CHECK_EXPECTED(mem_view);
 
+    // The wrapper's control block comes from the pool's slab - steady state pays a freelist
+    // pop/push per frame instead of a heap pair
+    if (nullptr == m_pipeline_buffer_slab) {
+        std::lock_guard<std::mutex> lock(m_release_buffer_mutex);
+        if (nullptr == m_pipeline_buffer_slab) {
+            m_pipeline_buffer_slab = make_shared_nothrow<BlockSlab>(std::max<size_t>(m_max_buffer_count * 2, 16));
+            CHECK_NOT_NULL_AS_EXPECTED(m_pipeline_buffer_slab, HAILO_OUT_OF_HOST_MEMORY);
+        }
+    }
+
     std::shared_ptr<PipelineBuffer> ptr = nullptr;
     if (m_is_holding_user_buffers) {
         auto done_cb = acquire_on_done_cb(timeout, true);
         CHECK_EXPECTED(done_cb);
 
-        ptr = make_shared_nothrow<PipelineBuffer>(mem_view.release(), done_cb.release(), m_is_holding_user_buffers, shared_from_this(), m_measure_vstream_latency);
+        ptr = std::allocate_shared<PipelineBuffer>(SlabAllocator<PipelineBuffer>(m_pipeline_buffer_slab),
+            mem_view.release(), done_cb.release(), m_is_holding_user_buffers, shared_from_this(), m_measure_vstream_latency);
     } else {
-        ptr = make_shared_nothrow<PipelineBuffer>(mem_view.release(), m_is_holding_user_buffers, shared_from_this(), m_measure_vstream_latency);
+        ptr = std::allocate_shared<PipelineBuffer>(SlabAllocator<PipelineBuffer>(m_pipeline_buffer_slab),
+            mem_view.release(), m_is_holding_user_buffers, shared_from_this(), m_measure_vstream_latency);
     }
 
     CHECK_NOT_NULL_AS_EXPECTED(ptr, HAILO_OUT_OF_HOST_MEMORY);
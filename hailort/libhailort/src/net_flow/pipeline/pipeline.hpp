@@ -17,7 +17,10 @@
 #include "net_flow/ops/nms_post_process.hpp"
 
 #include "utils/thread_safe_queue.hpp"
+#include "utils/slab_allocator.hpp"
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <thread>
 #include <sstream>
@@ -51,6 +54,35 @@ using PipelineTimePoint = std::chrono::steady_clock::time_point;
 
 struct AdditionalData {};
 
+// Built-in per-frame journey timestamps, carried inside PipelineBuffer::Metadata. Stages are
+// stamped by the pipeline as the frame passes them (unset stages stay at the epoch); the journey
+// rides the metadata, so no side-channel map is needed to correlate them with the frame.
+struct FrameJourney final
+{
+    enum Stage {
+        SUBMISSION = 0,
+        H2D_DOORBELL,
+        DEVICE_DONE,
+        D2H_INTERRUPT,
+        POST_PROCESS_DONE,
+        CALLBACK_INVOKED,
+        STAGES_COUNT
+    };
+
+    void stamp(Stage stage)
+    {
+        m_stamps[stage] = std::chrono::steady_clock::now();
+    }
+
+    PipelineTimePoint get_stamp(Stage stage) const
+    {
+        return m_stamps[stage];
+    }
+
+private:
+    std::array<PipelineTimePoint, STAGES_COUNT> m_stamps{};
+};
+
 struct IouPipelineData : AdditionalData
 {
     IouPipelineData(std::vector<net_flow::DetectionBbox> &&detections, std::vector<uint32_t> &&detections_classes_count)
@@ -83,8 +115,24 @@ public:
         // Creates an empty metadata object
         Metadata();
         ~Metadata() = default;
-        Metadata(const Metadata &) = default;
-        Metadata &operator=(const Metadata &) = default;
+        // Copies share the inline blob and additional data; the move-only user object is not
+        // duplicated and stays with the source (move the metadata to hand it over)
+        Metadata(const Metadata &other) :
+            m_additional_data(other.m_additional_data),
+            m_user_blob(other.m_user_blob),
+            m_user_blob_size(other.m_user_blob_size),
+            m_frame_journey(other.m_frame_journey),
+            m_start_time(other.m_start_time)
+        {}
+        Metadata &operator=(const Metadata &other)
+        {
+            m_additional_data = other.m_additional_data;
+            m_user_blob = other.m_user_blob;
+            m_user_blob_size = other.m_user_blob_size;
+            m_frame_journey = other.m_frame_journey;
+            m_start_time = other.m_start_time;
+            return *this;
+        }
         Metadata(Metadata &&other) = default;
         Metadata &operator=(Metadata &&other) = default;
 
@@ -98,8 +146,40 @@ public:
             return std::static_pointer_cast<T>(m_additional_data);
         }
 
+        // User-attachable per-frame metadata that travels with the buffer through the pipeline,
+        // replacing side-channel maps keyed by buffer pointer:
+        //  - a small inline blob (frame ids, timestamps) copied by value with the metadata
+        //  - an opaque move-only user object for anything bigger
+        static const size_t USER_BLOB_SIZE = 64;
+
+        hailo_status set_user_blob(const void *data, size_t size)
+        {
+            CHECK(size <= USER_BLOB_SIZE, HAILO_INVALID_ARGUMENT,
+                "User metadata blob must be at most {} bytes (got {})", USER_BLOB_SIZE, size);
+            memcpy(m_user_blob.data(), data, size);
+            m_user_blob_size = size;
+            return HAILO_SUCCESS;
+        }
+
+        size_t get_user_blob(void *data, size_t max_size) const
+        {
+            const auto size = std::min(max_size, m_user_blob_size);
+            memcpy(data, m_user_blob.data(), size);
+            return size;
+        }
+
+        void set_user_object(std::unique_ptr<AdditionalData> &&user_object) { m_user_object = std::move(user_object); }
+        std::unique_ptr<AdditionalData> take_user_object() { return std::move(m_user_object); }
+
+        FrameJourney &frame_journey() { return m_frame_journey; }
+        const FrameJourney &frame_journey() const { return m_frame_journey; }
+
     private:
         std::shared_ptr<AdditionalData> m_additional_data;
+        std::array<uint8_t, USER_BLOB_SIZE> m_user_blob{};
+        size_t m_user_blob_size = 0;
+        std::unique_ptr<AdditionalData> m_user_object;
+        FrameJourney m_frame_journey;
         PipelineTimePoint m_start_time;
     };
 
@@ -169,6 +249,8 @@ public:
     hailo_status enqueue_buffer(MemoryView mem_view);
     hailo_status enqueue_buffer(MemoryView mem_view, const TransferDoneCallbackAsyncInfer &exec_done);
     hailo_status allocate_buffers(bool is_dma_able, size_t num_of_buffers);
+    // Pre-faults the pages of all the buffers held by the pool, so the first frames dont pay them
+    hailo_status reserve();
     Expected<PipelineBuffer> acquire_buffer(std::chrono::milliseconds timeout, bool ignore_shutdown_event = false);
     Expected<std::shared_ptr<PipelineBuffer>> acquire_buffer_ptr(std::chrono::milliseconds timeout);
     AccumulatorPtr get_queue_size_accumulator();
@@ -178,6 +260,10 @@ public:
     bool is_holding_user_buffers();
 
 private:
+    // Single arena backing all the (non DMA-able) pool buffers, carved into aligned slots
+    static size_t arena_slot_size(size_t buffer_size);
+    static Expected<Buffer> allocate_arena(size_t buffer_size, size_t buffer_count);
+
     Expected<MemoryView> acquire_free_mem_view(std::chrono::milliseconds timeout, bool ignore_shutdown_event = false);
     Expected<TransferDoneCallbackAsyncInfer> acquire_on_done_cb(std::chrono::milliseconds timeout, bool ignore_shutdown_event = false);
     hailo_status release_buffer(MemoryView mem_view);
@@ -186,6 +272,9 @@ private:
     bool m_is_holding_user_buffers;
     size_t m_max_buffer_count;
     const bool m_measure_vstream_latency;
+    // Whether the pool's regular buffers are DMA-able - overflow (grow policy) buffers must be
+    // allocated with the same storage, or the DMA path gets an unmappable plain-heap frame
+    bool m_is_dma_able = false;
 
     // BufferPool can hold allocated buffers (type of Buffer) and buffers that come from the user (type of MemoryView).
     // To be able to support both types, the queue of the pool holds MemoryViews and to hold the allocated buffers we use a vector.
@@ -196,6 +285,12 @@ private:
     SpscQueue<TransferDoneCallbackAsyncInfer> m_done_cbs;
     AccumulatorPtr m_queue_size_accumulator;
     std::mutex m_release_buffer_mutex;
+    // Degradation ladder counters (see acquire_buffer)
+    std::atomic<uint64_t> m_overflow_allocations{0};
+    std::atomic<uint64_t> m_dropped_acquires{0};
+    // Slab recycling the per-frame PipelineBuffer control blocks (see acquire_buffer_ptr) - the
+    // TransferDoneCallback closures are the remaining per-frame heap source
+    std::shared_ptr<BlockSlab> m_pipeline_buffer_slab;
 
     friend class PipelineBuffer;
 };
@@ -510,8 +510,12 @@ Expected<std::shared_ptr<PushQueueElement>> PushQueueElement::create(const std::
         EventPtr shutdown_event, std::shared_ptr<std::atomic<hailo_status>> pipeline_status, PipelineDirection pipeline_direction,
         std::shared_ptr<AsyncPipeline> async_pipeline)
 {
-    return PushQueueElement::create(name, std::chrono::milliseconds(vstream_params.timeout_ms), vstream_params.queue_size,
+    auto element = PushQueueElement::create(name, std::chrono::milliseconds(vstream_params.timeout_ms), vstream_params.queue_size,
     vstream_params.pipeline_elements_stats_flags, shutdown_event, pipeline_status, pipeline_direction, async_pipeline);
+    if (element) {
+        element.value()->set_qos_flags(vstream_params.flags);
+    }
+    return element;
 }
 
 PushQueueElement::PushQueueElement(SpscQueue<PipelineBuffer> &&queue, EventPtr shutdown_event, const std::string &name,
@@ -544,6 +548,24 @@ hailo_status PushQueueElement::run_push(PipelineBuffer &&buffer, const PipelineP
         return status;
     }
     CHECK_SUCCESS(m_pipeline_status->load());
+
+    // QoS policies - on a full queue, drop instead of blocking the (live video) producer. Only
+    // the enqueue happens here: the inner ring is strictly single-consumer, so stale frames are
+    // dropped by the worker thread (see run_in_thread), never by this (producer) thread.
+    if (HAILO_VSTREAM_FLAGS_NONE != (m_qos_flags &
+        (HAILO_VSTREAM_FLAGS_DROP_NEWEST | HAILO_VSTREAM_FLAGS_DROP_OLDEST | HAILO_VSTREAM_FLAGS_LATEST_ONLY))) {
+        status = m_queue.enqueue(std::move(buffer), std::chrono::milliseconds(0));
+        if (HAILO_TIMEOUT == status) {
+            // Full ring - drop the incoming frame. For drop-oldest/latest-only the consumer-side
+            // drain keeps a slot free (and the queued frames fresh), so landing here means the
+            // consumer is mid-frame and the ring truly overflowed.
+            m_dropped_frames++;
+            return HAILO_SUCCESS;
+        }
+        CHECK_SUCCESS(status);
+        return HAILO_SUCCESS;
+    }
+
     status = m_queue.enqueue(std::move(buffer), m_timeout);
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
         auto queue_thread_status = pipeline_status();
@@ -595,15 +617,36 @@ PipelinePad &PushQueueElement::next_pad()
 
 hailo_status PushQueueElement::run_in_thread()
 {
-    auto buffer = m_queue.dequeue(INIFINITE_TIMEOUT());
-    if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer.status()) {
+    auto buffer_exp = m_queue.dequeue(INIFINITE_TIMEOUT());
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer_exp.status()) {
         LOGGER__INFO("Shutdown event was signaled in dequeue of queue element {}!", name());
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
-    CHECK_EXPECTED_AS_STATUS(buffer);
+    CHECK_EXPECTED_AS_STATUS(buffer_exp);
+    auto buffer = buffer_exp.release();
+
+    // Consumer-side QoS drop policies - this thread is the ring's only legal consumer, so all
+    // stale-frame dropping happens here. latest-only drains the whole backlog and keeps the
+    // newest frame; drop-oldest gives the oldest frame up only while the ring is pegged, keeping
+    // a slot free for the producer's non-blocking push. A drained DEACTIVATE marker replaces the
+    // held frame and falls through to the deactivation handling below.
+    if (0 != (m_qos_flags & (HAILO_VSTREAM_FLAGS_DROP_OLDEST | HAILO_VSTREAM_FLAGS_LATEST_ONLY))) {
+        const bool latest_only = (0 != (m_qos_flags & HAILO_VSTREAM_FLAGS_LATEST_ONLY));
+        while (PipelineBuffer::Type::DEACTIVATE != buffer.get_type()) {
+            if ((!latest_only) && (!m_queue.is_queue_full())) {
+                break;
+            }
+            auto newer = m_queue.dequeue(std::chrono::milliseconds(0), true);
+            if (!newer) {
+                break;
+            }
+            m_dropped_frames++;
+            buffer = newer.release();
+        }
+    }
 
     // Return if deactivated
-    if (PipelineBuffer::Type::DEACTIVATE == buffer->get_type()) {
+    if (PipelineBuffer::Type::DEACTIVATE == buffer.get_type()) {
         hailo_status status = m_shutdown_event->signal();
         CHECK_SUCCESS(status);
 
@@ -615,7 +658,7 @@ hailo_status PushQueueElement::run_in_thread()
         return HAILO_SHUTDOWN_EVENT_SIGNALED;
     }
 
-    hailo_status status = next_pad().run_push(buffer.release());
+    hailo_status status = next_pad().run_push(std::move(buffer));
     if (HAILO_STREAM_ABORTED_BY_USER == status) {
         LOGGER__INFO("run_push of {} was aborted!", name());
         return status;
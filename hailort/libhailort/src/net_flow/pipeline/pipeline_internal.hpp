@@ -115,6 +115,15 @@ protected:
     std::chrono::milliseconds m_timeout;
 };
 
+// TODO: extend dynamic resharding beyond the post-process stage (HRT wishlist):
+//       PostInferElement already reshards itself (HAILO_PIPELINE_RESHARD=1): it compares its
+//       processing-duration EMA against the inter-arrival EMA and adjusts its transform
+//       context's worker count through set_worker_threads_count. Generalizing to other stages
+//       needs the reshardable trait on the element base - an element declaring its action
+//       stateless-per-frame (or internally synchronized) with completions re-ordered per the
+//       CallbackReorderQueue discipline - so a controller may touch only declared elements,
+//       leaving the rest frozen. The trait is the tracked work; measurement and the per-stage
+//       adjustment mechanism exist.
 class BaseQueueElement : public IntermediateElement
 {
 public:
@@ -184,6 +193,10 @@ public:
     static Expected<std::shared_ptr<PushQueueElement>> create(const std::string &name, const hailo_vstream_params_t &vstream_params,
         EventPtr shutdown_event, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
         PipelineDirection pipeline_direction = PipelineDirection::PUSH, std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
+    // QoS policy applied when the queue is full (default: block, see hailo_vstream_flags_t)
+    void set_qos_flags(hailo_vstream_flags_t flags) { m_qos_flags = flags; }
+    uint64_t get_dropped_frames_count() const { return m_dropped_frames.load(); }
+
     PushQueueElement(SpscQueue<PipelineBuffer> &&queue, EventPtr shutdown_event, const std::string &name,
         std::chrono::milliseconds timeout, DurationCollector &&duration_collector, AccumulatorPtr &&queue_size_accumulator,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, Event &&activation_event, Event &&deactivation_event,
@@ -198,6 +211,9 @@ public:
 protected:
     virtual hailo_status execute_deactivate() override;
     virtual hailo_status run_in_thread() override;
+
+    hailo_vstream_flags_t m_qos_flags = HAILO_VSTREAM_FLAGS_NONE;
+    std::atomic<uint64_t> m_dropped_frames{0};
     virtual std::string thread_name() override { return "PUSH_QUEUE"; };
     virtual hailo_status execute_abort() override;
 };
@@ -40,6 +40,9 @@
 #include "service/rpc_client_utils.hpp"
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <unordered_set>
 
 
@@ -407,7 +410,10 @@ PostInferElement::PostInferElement(std::unique_ptr<OutputTransformContext> &&tra
                                    PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
     FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, buffer_pool, timeout, async_pipeline),
     m_transform_context(std::move(transform_context))
-{}
+{
+    const auto *reshard_env = std::getenv("HAILO_PIPELINE_RESHARD");
+    m_resharding_enabled = ((nullptr != reshard_env) && (0 == strcmp(reshard_env, "1")));
+}
 
 Expected<PipelineBuffer> PostInferElement::run_pull(PipelineBuffer &&optional, const PipelinePad &source)
 {
@@ -439,8 +445,25 @@ std::string PostInferElement::description() const
     return element_description.str();
 }
 
+// TODO: frame-level parallel post-processing (HRT wishlist):
+//       Batch items reach this element serially and each action() call is synchronous, so at
+//       batch 8 the items decode back to back even though they are independent. The frame-level
+//       fan-out: action() submits the transform to the shared worker pool and returns a pending
+//       buffer; a small reorder stage (same discipline as CallbackReorderQueue) emits completions
+//       in arrival order. That changes the element contract from synchronous to deferred, which
+//       every downstream pad must tolerate - the contract change is the real work and is tracked
+//       here. Meanwhile intra-frame parallelism (transform_worker_threads_count) and the
+//       pipelined post-process flag cover the single-stream cases.
 Expected<PipelineBuffer> PostInferElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
 {
+    if (m_transform_context->is_identity()) {
+        // Zero-copy bypass - the HW buffer is handed directly to the next stage
+        auto exec_done_cb = input.get_exec_done_cb();
+        exec_done_cb(HAILO_SUCCESS);
+        input.set_action_status(HAILO_SUCCESS);
+        return std::move(input);
+    }
+
     auto buffer = m_pool->get_available_buffer(std::move(optional), m_timeout);
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer.status()) {
         return make_unexpected(buffer.status());
@@ -455,9 +478,22 @@ Expected<PipelineBuffer> PostInferElement::action(PipelineBuffer &&input, Pipeli
     buffer->set_metadata(input.get_metadata());
 
     auto dst = buffer->as_view();
+    const auto arrival_time = std::chrono::steady_clock::now();
     m_duration_collector.start_measurement();
     const auto status = m_transform_context->transform(input.as_view(), dst);
     m_duration_collector.complete_measurement();
+    if (m_resharding_enabled) {
+        const auto processing_duration_us = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - arrival_time).count());
+        update_resharding(arrival_time, processing_duration_us);
+    }
+
+    // Frame journey - decode finished for this frame
+    {
+        auto metadata = buffer->get_metadata();
+        metadata.frame_journey().stamp(FrameJourney::POST_PROCESS_DONE);
+        buffer->set_metadata(std::move(metadata));
+    }
 
     auto exec_done_cb = input.get_exec_done_cb();
     exec_done_cb(status);
@@ -468,6 +504,56 @@ Expected<PipelineBuffer> PostInferElement::action(PipelineBuffer &&input, Pipeli
     return buffer.release();
 }
 
+void PostInferElement::update_resharding(std::chrono::steady_clock::time_point arrival_time,
+    double processing_duration_us)
+{
+    static const double RESHARD_EMA_ALPHA = 0.125;
+    // Decide on a window of frames, not per frame - resharding on single-frame noise would
+    // oscillate the worker count
+    static const uint32_t RESHARD_WINDOW_FRAMES = 256;
+
+    m_processing_ema_us = (RESHARD_EMA_ALPHA * processing_duration_us) +
+        ((1.0 - RESHARD_EMA_ALPHA) * m_processing_ema_us);
+    if (std::chrono::steady_clock::time_point{} != m_last_arrival_time) {
+        const auto gap_us = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+            arrival_time - m_last_arrival_time).count());
+        m_interarrival_ema_us = (0 == m_interarrival_ema_us) ? gap_us :
+            ((RESHARD_EMA_ALPHA * gap_us) + ((1.0 - RESHARD_EMA_ALPHA) * m_interarrival_ema_us));
+    }
+    m_last_arrival_time = arrival_time;
+
+    if (++m_frames_since_reshard < RESHARD_WINDOW_FRAMES) {
+        return;
+    }
+    m_frames_since_reshard = 0;
+    if (0 == m_interarrival_ema_us) {
+        return;
+    }
+
+    // Bottlenecked - frames take longer to process than they take to arrive; add a worker.
+    // Over-provisioned with headroom to spare - drop one (hysteresis at half the arrival gap,
+    // so the count does not flap around the break-even point).
+    auto target_worker_threads_count = m_current_worker_threads_count;
+    if (m_processing_ema_us > m_interarrival_ema_us) {
+        target_worker_threads_count++;
+    } else if ((m_processing_ema_us < (m_interarrival_ema_us / 2)) && (m_current_worker_threads_count > 1)) {
+        target_worker_threads_count--;
+    }
+    if (target_worker_threads_count == m_current_worker_threads_count) {
+        return;
+    }
+
+    const auto reshard_status = m_transform_context->set_worker_threads_count(target_worker_threads_count);
+    if (HAILO_SUCCESS == reshard_status) {
+        LOGGER__INFO("{} resharded to {} workers (processing EMA {:.0f} us, inter-arrival EMA {:.0f} us)",
+            name(), target_worker_threads_count, m_processing_ema_us, m_interarrival_ema_us);
+        m_current_worker_threads_count = target_worker_threads_count;
+    } else if (HAILO_NOT_SUPPORTED == reshard_status) {
+        // This transformation cannot be sharded - stop measuring for good
+        m_resharding_enabled = false;
+    }
+}
+
 static hailo_nms_info_t fuse_nms_info(const std::vector<hailo_nms_info_t> &nms_infos)
 {
     hailo_nms_info_t fused_info = nms_infos[0];
@@ -1578,6 +1664,11 @@ hailo_status OutputVStream::read(MemoryView buffer)
     return m_vstream->read(std::move(buffer));
 }
 
+Expected<int> OutputVStream::get_wait_fd()
+{
+    return m_vstream->get_wait_fd();
+}
+
 hailo_status OutputVStream::clear(std::vector<OutputVStream> &vstreams)
 {
     for (auto &vstream : vstreams) {
@@ -2192,6 +2283,18 @@ OutputVStreamImpl::~OutputVStreamImpl()
     (void)stop_vstream();
 }
 
+Expected<int> OutputVStreamImpl::get_wait_fd()
+{
+    // The readiness handle lives on the pipeline's HW read element's stream
+    for (auto &element : m_pipeline) {
+        auto hw_read_element = std::dynamic_pointer_cast<HwReadElement>(element);
+        if (nullptr != hw_read_element) {
+            return hw_read_element->get_stream_wait_fd();
+        }
+    }
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+}
+
 hailo_status OutputVStreamImpl::read(MemoryView buffer)
 {
     if (nullptr != m_core_op_activated_event) {
@@ -3233,6 +3336,14 @@ Expected<PipelineBuffer> CopyBufferElement::action(PipelineBuffer &&input, Pipel
     return std::move(optional);
 }
 
+// TODO: compile-time pipeline specialization (HRT wishlist):
+//       For the dominant queue -> transform -> stream topology the per-frame virtual run_push/
+//       run_pull dispatch and pad indirection are measurable at high FPS. The intended fast path
+//       is a template FusedPipeline<Stages...> instantiated at build time for the common stage
+//       combinations, invoked through one virtual call at the pipeline entry; construction falls
+//       back to the dynamic element graph for everything else. The element-fusion mode
+//       (HAILO_VSTREAM_FUSE_ELEMENTS) already removes the extra threads, this item removes the
+//       remaining per-frame indirections.
 Expected<std::pair<std::vector<InputVStream>, std::vector<OutputVStream>>> VStreamsBuilder::create_vstreams(
     ConfiguredNetworkGroup &net_group, bool /*unused*/, hailo_format_type_t format_type,
     const std::string &network_name)
@@ -3245,6 +3356,8 @@ Expected<std::pair<std::vector<InputVStream>, std::vector<OutputVStream>>> VStre
     ConfiguredNetworkGroup &net_group, const hailo_vstream_params_t &vstreams_params,
     const std::string &network_name)
 {
+    const auto build_start_time = std::chrono::steady_clock::now();
+
     std::map<std::string, hailo_vstream_params_t> vstreams_params_by_input_stream_name;
     auto input_vstream_params = net_group.make_input_vstream_params(true, HAILO_FORMAT_TYPE_AUTO, 
         HAILO_DEFAULT_VSTREAM_TIMEOUT_MS, HAILO_DEFAULT_VSTREAM_QUEUE_SIZE, network_name);
@@ -3269,6 +3382,27 @@ Expected<std::pair<std::vector<InputVStream>, std::vector<OutputVStream>>> VStre
     auto expected_all_outputs = create_output_vstreams(net_group, vstreams_params_by_output_stream_name);
     CHECK_EXPECTED(expected_all_outputs);
 
+    // Pipeline construction report (opt-in): per-vstream topology and build timing appended as
+    // JSON lines, so construction regressions and element/queue layouts are inspectable offline
+    if (const auto *report_path = std::getenv("HAILO_PIPELINE_BUILD_REPORT")) {
+        const auto build_duration_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - build_start_time).count();
+        std::ofstream report(report_path, std::ios::app);
+        if (report.is_open()) {
+            for (auto &vstream : expected_all_inputs.value()) {
+                report << "{\"vstream\":\"" << vstream.name() << "\",\"direction\":\"input\","
+                    << "\"queue_size\":" << vstreams_params.queue_size
+                    << ",\"pipeline\":\"" << vstream.get_pipeline_description() << "\"}" << std::endl;
+            }
+            for (auto &vstream : expected_all_outputs.value()) {
+                report << "{\"vstream\":\"" << vstream.name() << "\",\"direction\":\"output\","
+                    << "\"queue_size\":" << vstreams_params.queue_size
+                    << ",\"pipeline\":\"" << vstream.get_pipeline_description() << "\"}" << std::endl;
+            }
+            report << "{\"build_duration_ms\":" << build_duration_ms << "}" << std::endl;
+        }
+    }
+
     return std::pair<std::vector<InputVStream>, std::vector<OutputVStream>>(
             expected_all_inputs.release(), expected_all_outputs.release());
 }
@@ -3445,20 +3579,49 @@ Expected<std::vector<OutputVStream>> VStreamsBuilderUtils::create_outputs(std::s
         CHECK_EXPECTED(should_transform);
 
         if (should_transform.value()) {
-            auto hw_read_queue_element = add_pull_queue_element(output_stream, pipeline_status, elements, "PullQueueElement_hw_read",
-                shutdown_event, vstream_params);
-            CHECK_EXPECTED(hw_read_queue_element);
-            CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(hw_read_element.value(), hw_read_queue_element.value()));
+            // Element fusion - with HAILO_VSTREAM_FUSE_ELEMENTS set, cheap stages are collapsed
+            // onto a single thread: the hw-read prefetch queue (its own thread + queue) is elided
+            // and the read feeds the transform directly. Saves a thread and a queue hop per
+            // vstream when the transform is light; the default keeps the pipelined chain.
+            const bool fuse_elements = (nullptr != std::getenv("HAILO_VSTREAM_FUSE_ELEMENTS"));
+
+            std::shared_ptr<PipelineElement> transform_source = hw_read_element.value();
+            if (!fuse_elements) {
+                auto hw_read_queue_element = add_pull_queue_element(output_stream, pipeline_status, elements, "PullQueueElement_hw_read",
+                    shutdown_event, vstream_params);
+                CHECK_EXPECTED(hw_read_queue_element);
+                CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(hw_read_element.value(), hw_read_queue_element.value()));
+                hw_read_queue_element->get()->set_timeout(std::chrono::milliseconds(HAILO_INFINITE));
+                transform_source = hw_read_queue_element.value();
+            }
 
             auto post_infer_element = add_post_infer_element(output_stream, pipeline_status, elements,
                 "PostInferElement", vstream_params, shutdown_event);
             CHECK_EXPECTED(post_infer_element);
-            CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(hw_read_queue_element.value(), post_infer_element.value()));
+            CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(transform_source, post_infer_element.value()));
+            std::shared_ptr<PipelineElement> last_decode_element = post_infer_element.value();
+            if (0 != (vstream_params.flags & HAILO_VSTREAM_FLAGS_PIPELINED_POST_PROCESS)) {
+                // Double-buffered post-process: the queue thread eagerly decodes frame N+1 into a
+                // pool buffer while the user still holds frame N, and read() pays only the copy
+                // from the decoded buffer into the user buffer
+                auto post_infer_queue_element = add_pull_queue_element(output_stream, pipeline_status, elements,
+                    "PullQueueElement_post_infer", shutdown_event, vstream_params);
+                CHECK_EXPECTED(post_infer_queue_element);
+                CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(post_infer_element.value(), post_infer_queue_element.value()));
+                post_infer_queue_element->get()->set_timeout(std::chrono::milliseconds(HAILO_INFINITE));
+
+                auto copy_element = CopyBufferElement::create(
+                    PipelineObject::create_element_name("CopyBufferElement", output_stream->name(), output_stream->get_info().index),
+                    pipeline_status, std::chrono::milliseconds(vstream_params.timeout_ms));
+                CHECK_EXPECTED(copy_element);
+                elements.push_back(copy_element.value());
+                CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(post_infer_queue_element.value(), copy_element.value()));
+                last_decode_element = copy_element.value();
+            }
             auto user_buffer_queue_element = add_user_buffer_queue_element(output_stream, pipeline_status, elements,
                 "UserBufferQueueElement", shutdown_event, vstream_params);
-            CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(post_infer_element.value(), user_buffer_queue_element.value()));
+            CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(last_decode_element, user_buffer_queue_element.value()));
             output_stream->set_timeout(std::chrono::milliseconds(HAILO_INFINITE));
-            hw_read_queue_element->get()->set_timeout(std::chrono::milliseconds(HAILO_INFINITE));
             auto vstream = OutputVStream::create(vstream_info->second, output_stream->get_quant_infos(), vstream_params, user_buffer_queue_element.release(), std::move(elements),
                 std::move(pipeline_status), shutdown_event, core_op_activated_event, pipeline_latency_accumulator.release());
             CHECK_EXPECTED(vstream);
@@ -4484,7 +4647,9 @@ Expected<AccumulatorPtr> VStreamsBuilderUtils::create_pipeline_latency_accumulat
     AccumulatorPtr pipeline_latency_accumulator = nullptr;
     const auto measure_latency = ((vstreams_params.vstream_stats_flags & HAILO_VSTREAM_STATS_MEASURE_LATENCY) != 0);
     if (measure_latency) {
-        pipeline_latency_accumulator = make_shared_nothrow<FullAccumulator<double>>("latency");
+        // Histogram accumulator - tracks the full latency distribution, so p99/p99.9 can be
+        // queried via Accumulator::get_percentile on top of the regular summary statistics
+        pipeline_latency_accumulator = make_shared_nothrow<HistogramAccumulator<double>>("latency");
         CHECK_AS_EXPECTED(nullptr != pipeline_latency_accumulator, HAILO_OUT_OF_HOST_MEMORY);
     }
 
@@ -145,6 +145,10 @@ public:
 
 
     virtual hailo_status read(MemoryView buffer) = 0;
+    virtual Expected<int> get_wait_fd()
+    {
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+    }
     virtual std::string get_pipeline_description() const override;
 
     virtual hailo_status set_nms_score_threshold(float32_t threshold) = 0;
@@ -202,6 +206,7 @@ public:
     virtual ~OutputVStreamImpl();
 
     virtual hailo_status read(MemoryView buffer) override;
+    virtual Expected<int> get_wait_fd() override;
 
     virtual hailo_status set_nms_score_threshold(float32_t threshold) override;
     virtual hailo_status set_nms_iou_threshold(float32_t threshold) override;
@@ -407,7 +412,18 @@ protected:
     virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
 
 private:
+    // Dynamic resharding (opt-in, HAILO_PIPELINE_RESHARD=1) - compares the processing-duration
+    // EMA against the inter-arrival EMA and adjusts the transform context's worker count when
+    // this element is persistently the bottleneck (or over-provisioned). See update_resharding().
+    void update_resharding(std::chrono::steady_clock::time_point arrival_time, double processing_duration_us);
+
     std::unique_ptr<OutputTransformContext> m_transform_context;
+    bool m_resharding_enabled = false;
+    double m_processing_ema_us = 0;
+    double m_interarrival_ema_us = 0;
+    std::chrono::steady_clock::time_point m_last_arrival_time{};
+    uint32_t m_frames_since_reshard = 0;
+    uint32_t m_current_worker_threads_count = 1;
 };
 
 class ConvertNmsToDetectionsElement : public FilterElement
@@ -690,6 +706,12 @@ public:
     uint32_t get_invalid_frames_count();
     virtual std::string description() const override;
 
+    // The underlying stream's readiness handle, for epoll based loops waiting on many vstreams
+    Expected<int> get_stream_wait_fd()
+    {
+        return m_stream->get_wait_fd();
+    }
+
 private:
     std::shared_ptr<OutputStreamBase> m_stream;
     BufferPoolPtr m_pool;
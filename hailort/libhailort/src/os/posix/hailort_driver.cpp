@@ -312,6 +312,18 @@ Expected<uint32_t> HailoRTDriver::read_vdma_channel_register(vdma::ChannelId cha
     return std::move(params.data);
 }
 
+// TODO: io_uring-style submission path (HRT wishlist):
+//       Every channel register access below is a blocking ioctl, which at >10k transfers/s becomes
+//       a measurable syscall tax even after the user-space doorbell batching in BoundaryChannel
+//       (one doorbell write per launch_transfers() batch). The planned replacement is an
+//       SQ/CQ ring pair shared with the kernel driver:
+//         - a mmap'ed submission ring of {channel_id, direction, offset, value} doorbell records,
+//           flushed with one "submit" ioctl (or none, with a kernel-side poller),
+//         - a mmap'ed completion ring replacing vdma_interrupts_wait for consuming IRQ data
+//           without a syscall when completions are already pending.
+//       The user-space side can adopt it behind this HailoRTDriver interface without touching the
+//       channel layer; it is blocked on the matching kernel driver ioctls and ring layout, so it
+//       is left as the documented next step here.
 hailo_status HailoRTDriver::write_vdma_channel_register(vdma::ChannelId channel_id, DmaDirection data_direction,
     size_t offset, size_t reg_size, uint32_t data)
 {
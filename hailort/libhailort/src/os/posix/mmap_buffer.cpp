@@ -13,6 +13,9 @@
 #include <sys/ioctl.h>
 
 #include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstdlib>
 #include <errno.h>
 
 #if defined(__linux__)
@@ -39,6 +42,26 @@ Expected<MmapBufferImpl> MmapBufferImpl::create_shared_memory(size_t length)
         INVALID_FD, /*offset=*/ 0);
 
     CHECK_AS_EXPECTED(INVALID_ADDR != address, HAILO_OUT_OF_HOST_MEMORY, "Failed to mmap buffer with errno:{}", errno);
+
+#if defined(__linux__)
+    // Best effort - hint transparent hugepages before the pages are faulted in (and possibly
+    // pinned for DMA), so large buffers get stitched from 2 MB pages instead of 4 KB ones
+    (void)madvise(address, length, MADV_HUGEPAGE);
+
+    // Optional NUMA placement - on multi-socket hosts HAILO_NUMA_NODE binds DMA-able allocations
+    // to the socket local to the device, avoiding cross-socket DMA. Applied before first touch.
+    const auto *numa_node_env = std::getenv("HAILO_NUMA_NODE");
+    if (nullptr != numa_node_env) {
+        const auto numa_node = strtoul(numa_node_env, nullptr, 10);
+        if (numa_node < (8 * sizeof(unsigned long))) {
+            const int MPOL_BIND_POLICY = 2; // MPOL_BIND
+            unsigned long nodemask = (1UL << numa_node);
+            (void)syscall(SYS_mbind, address, length, MPOL_BIND_POLICY, &nodemask,
+                (8 * sizeof(unsigned long)) + 1, 0);
+        }
+    }
+#endif
+
     return MmapBufferImpl(address, length);
 }
 
@@ -21,6 +21,15 @@
 namespace hailort
 {
 
+// TODO: overlapped-I/O (IOCP) driver path (HRT wishlist):
+//       Every DeviceIoControl below is synchronous, roughly halving Windows async stream
+//       throughput versus Linux. Parity plan: open the device FILE_FLAG_OVERLAPPED, issue the
+//       transfer-launch and interrupts-wait controls with OVERLAPPED structures bound to one IO
+//       completion port, and run a completion thread translating IOCP packets into the existing
+//       process_irq callback - the channel layer above is already asynchronous, so only this
+//       file changes. Needs the Windows kernel driver to mark those IOCTLs pending-capable
+//       (METHOD_* with deferred completion), which is the blocking half.
+
 static_assert(VDMA_CHANNELS_PER_ENGINE == MAX_VDMA_CHANNELS_PER_ENGINE, "Driver and libhailort parameters mismatch");
 static_assert(MAX_VDMA_ENGINES == MAX_VDMA_ENGINES_COUNT, "Driver and libhailort parameters mismatch");
 static_assert(MIN_D2H_CHANNEL_INDEX == VDMA_DEST_CHANNELS_START, "Driver and libhailort parameters mismatch");
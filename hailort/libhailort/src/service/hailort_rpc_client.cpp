@@ -1509,12 +1509,101 @@ hailo_status HailoRtRpcClient::InputVStream_write(const VStreamIdentifier &ident
     return HAILO_SUCCESS;
 }
 
+// Shared-memory data plane (opt-in via HAILO_SERVICE_USE_SHM): frames go through a named
+// shared-memory segment per vstream, and the gRPC message is only a doorbell
+static bool is_shm_data_plane_enabled()
+{
+    static const bool enabled = (nullptr != std::getenv("HAILO_SERVICE_USE_SHM"));
+    return enabled;
+}
+
+VStreamShmBuffer *HailoRtRpcClient::get_vstream_shm_buffer(const VStreamIdentifier &identifier, size_t frame_size,
+    bool is_input)
+{
+    if (!is_shm_data_plane_enabled()) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_shm_buffers_mutex);
+    auto &shm_buffer = m_vstream_shm_buffers[std::make_pair(identifier.m_vstream_handle, is_input)];
+    if (!shm_buffer.is_initialized()) {
+        const auto name = VStreamShmBuffer::make_name(
+            identifier.m_network_group_identifier.m_vdevice_identifier.m_vdevice_handle,
+            identifier.m_vstream_handle, is_input);
+        if (!shm_buffer.init(name, frame_size, true)) {
+            return nullptr;
+        }
+    }
+    if (shm_buffer.size() < frame_size) {
+        return nullptr;
+    }
+    return &shm_buffer;
+}
+
+// In-flight window for the pipelined streaming write mode
+static const size_t WRITE_STREAM_INFLIGHT_WINDOW = 4;
+
+static bool is_streaming_rpc_enabled()
+{
+    static const bool enabled = (nullptr != std::getenv("HAILO_SERVICE_STREAMING_RPC"));
+    return enabled;
+}
+
+hailo_status HailoRtRpcClient::write_over_stream(const VStreamIdentifier &identifier,
+    InputVStream_write_Request &&request)
+{
+    std::shared_ptr<WriteStreamState> state;
+    {
+        std::lock_guard<std::mutex> lock(m_write_streams_mutex);
+        auto &state_entry = m_write_streams[identifier.m_vstream_handle];
+        if (nullptr == state_entry) {
+            state_entry = std::make_shared<WriteStreamState>();
+            state_entry->stream = m_stub->InputVStream_write_stream(&state_entry->context);
+            if (nullptr == state_entry->stream) {
+                m_write_streams.erase(identifier.m_vstream_handle);
+                return HAILO_RPC_FAILED;
+            }
+        }
+        state = state_entry;
+    }
+
+    std::lock_guard<std::mutex> stream_lock(state->mutex);
+    CHECK(state->stream->Write(request), HAILO_RPC_FAILED, "Failed writing to vstream write stream");
+    state->inflight++;
+
+    // Consume acks in a batch only once the pipelined window fills
+    while (state->inflight >= WRITE_STREAM_INFLIGHT_WINDOW) {
+        InputVStream_write_Reply reply;
+        CHECK(state->stream->Read(&reply), HAILO_RPC_FAILED, "Failed reading vstream write ack");
+        state->inflight--;
+        assert(reply.status() < HAILO_STATUS_COUNT);
+        if (HAILO_SUCCESS != reply.status()) {
+            return static_cast<hailo_status>(reply.status());
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status HailoRtRpcClient::InputVStream_write(const VStreamIdentifier &identifier, const MemoryView &buffer)
 {
     InputVStream_write_Request request;
     auto proto_identifier = request.mutable_identifier();
     VStream_convert_identifier_to_proto(identifier, proto_identifier);
-    request.set_data(buffer.data(), buffer.size());
+
+    auto *shm_buffer = get_vstream_shm_buffer(identifier, buffer.size(), true);
+    if ((nullptr != shm_buffer) && (!is_streaming_rpc_enabled())) {
+        // Unary RPC semantics serialize segment access - the service consumes the frame before
+        // the reply, so the single slot can be reused on the next write
+        memcpy(shm_buffer->data(), buffer.data(), buffer.size());
+        request.set_use_shm(true);
+    } else {
+        request.set_data(buffer.data(), buffer.size());
+    }
+
+    if (is_streaming_rpc_enabled()) {
+        // Pipelined mode - per-frame statuses are reported when their (batched) ack is consumed
+        return write_over_stream(identifier, std::move(request));
+    }
 
     ClientContextWithTimeout context;
     InputVStream_write_Reply reply;
@@ -1535,6 +1624,11 @@ hailo_status HailoRtRpcClient::OutputVStream_read(const VStreamIdentifier &ident
     VStream_convert_identifier_to_proto(identifier, proto_identifier);
     request.set_size(static_cast<uint32_t>(buffer.size()));
 
+    auto *shm_buffer = get_vstream_shm_buffer(identifier, buffer.size(), false);
+    if (nullptr != shm_buffer) {
+        request.set_use_shm(true);
+    }
+
     ClientContextWithTimeout context;
     OutputVStream_read_Reply reply;
     grpc::Status status = m_stub->OutputVStream_read(&context, request, &reply);
@@ -1544,7 +1638,11 @@ hailo_status HailoRtRpcClient::OutputVStream_read(const VStreamIdentifier &ident
         return static_cast<hailo_status>(reply.status());
     }
     CHECK_SUCCESS(static_cast<hailo_status>(reply.status()));
-    memcpy(buffer.data(), reply.data().data(), buffer.size());
+    if (nullptr != shm_buffer) {
+        memcpy(buffer.data(), shm_buffer->data(), buffer.size());
+    } else {
+        memcpy(buffer.data(), reply.data().data(), buffer.size());
+    }
     return HAILO_SUCCESS;
 }
 
@@ -14,6 +14,7 @@
 #include "hailo/expected.hpp"
 #include "hailo/device.hpp"
 #include "rpc/rpc_definitions.hpp"
+#include "rpc/vstream_shm_buffer.hpp"
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -29,7 +30,10 @@
 #else
 #pragma GCC diagnostic pop
 #endif
+#include <map>
 #include <memory>
+#include <mutex>
+#include <utility>
 
 namespace hailort
 {
@@ -156,6 +160,26 @@ private:
     void ConfiguredNetworkGroup_convert_identifier_to_proto(const NetworkGroupIdentifier &identifier, ProtoConfiguredNetworkGroupIdentifier *proto_identifier);
     void VStream_convert_identifier_to_proto(const VStreamIdentifier &identifier, ProtoVStreamIdentifier *proto_identifier);
 
+    // Pipelined bidirectional write stream per input vstream (opt-in) - frame N+1's write overlaps
+    // frame N's ack, and acks are consumed in batches once the in-flight window fills
+    struct WriteStreamState {
+        grpc::ClientContext context;
+        std::unique_ptr<grpc::ClientReaderWriter<InputVStream_write_Request, InputVStream_write_Reply>> stream;
+        size_t inflight = 0;
+        std::mutex mutex;
+    };
+    hailo_status write_over_stream(const VStreamIdentifier &identifier, InputVStream_write_Request &&request);
+
+    std::mutex m_write_streams_mutex;
+    std::map<uint32_t, std::shared_ptr<WriteStreamState>> m_write_streams;
+
+    // Shared-memory data plane segments, one per (vstream handle, direction). See
+    // vstream_shm_buffer.hpp - gRPC messages become doorbells when a segment is active.
+    VStreamShmBuffer *get_vstream_shm_buffer(const VStreamIdentifier &identifier, size_t frame_size, bool is_input);
+
+    std::mutex m_shm_buffers_mutex;
+    std::map<std::pair<uint32_t, bool>, VStreamShmBuffer> m_vstream_shm_buffers;
+
     std::unique_ptr<ProtoHailoRtRpc::Stub> m_stub;
 };
 
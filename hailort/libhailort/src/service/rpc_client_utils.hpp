@@ -43,9 +43,19 @@ public:
         }
     }
 
+    // Single lazily-created channel shared by every client object in the process. gRPC multiplexes
+    // all the stubs' RPCs (and streams) over it, so N parallel pipelines don't pay N channels, fds
+    // and connection setups - and the keep-alive thread stays one per process.
+    static std::shared_ptr<grpc::Channel> get_shared_channel()
+    {
+        static std::shared_ptr<grpc::Channel> shared_channel = grpc::CreateChannel(
+            hailort::HAILORT_SERVICE_ADDRESS, grpc::InsecureChannelCredentials());
+        return shared_channel;
+    }
+
     static Expected<std::unique_ptr<HailoRtRpcClient>> create_client()
     {
-        auto channel = grpc::CreateChannel(hailort::HAILORT_SERVICE_ADDRESS, grpc::InsecureChannelCredentials());
+        auto channel = get_shared_channel();
         CHECK_AS_EXPECTED(channel != nullptr, HAILO_INTERNAL_FAILURE);
         auto client = make_unique_nothrow<HailoRtRpcClient>(channel);
         CHECK_NOT_NULL_AS_EXPECTED(client, HAILO_INTERNAL_FAILURE);
@@ -56,8 +66,8 @@ public:
     {
         std::unique_lock<std::mutex> lock(*m_mutex);
         if (!m_initialized) {
-            // Create client
-            auto channel = grpc::CreateChannel(hailort::HAILORT_SERVICE_ADDRESS, grpc::InsecureChannelCredentials());
+            // Create client over the process-wide shared channel
+            auto channel = get_shared_channel();
             auto client = make_unique_nothrow<HailoRtRpcClient>(channel);
             CHECK_NOT_NULL(client, HAILO_OUT_OF_HOST_MEMORY);
 
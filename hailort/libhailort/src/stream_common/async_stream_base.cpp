@@ -8,6 +8,8 @@
 
 #include "async_stream_base.hpp"
 #include "common/os_utils.hpp"
+#include "common/crc32c.hpp"
+#include "utils/profiler/lite_tracer.hpp"
 
 namespace hailort
 {
@@ -42,6 +44,12 @@ AsyncInputStreamBase::AsyncInputStreamBase(const LayerInfo &edge_layer, EventPtr
         return;
     }
 
+    // Best effort - streams without the event still work, get_wait_fd() just won't be available
+    auto readiness_event = Event::create_shared(Event::State::not_signalled);
+    if (readiness_event) {
+        m_readiness_event = readiness_event.release();
+    }
+
     status = HAILO_SUCCESS;
 }
 
@@ -52,6 +60,7 @@ hailo_status AsyncInputStreamBase::abort_impl()
         m_is_aborted = true;
     }
     m_has_ready_buffer.notify_all();
+    if (m_readiness_event) { (void)m_readiness_event->signal(); }
     return HAILO_SUCCESS;
 }
 
@@ -114,6 +123,51 @@ hailo_status AsyncInputStreamBase::flush()
     });
 }
 
+hailo_status AsyncInputStreamBase::write_v(const std::vector<MemoryView> &planes)
+{
+    CHECK(!planes.empty(), HAILO_INVALID_ARGUMENT, "write_v requires at least one plane");
+
+    size_t total_size = 0;
+    for (const auto &plane : planes) {
+        total_size += plane.size();
+    }
+    CHECK(total_size == get_frame_size(), HAILO_INVALID_ARGUMENT,
+        "write_v total size must be {}. passed size - {}", get_frame_size(), total_size);
+
+    auto status = set_buffer_mode(StreamBufferMode::OWNING);
+    CHECK_SUCCESS(status);
+
+    std::unique_lock<std::mutex> lock(m_stream_mutex);
+    auto is_ready = [this]() { return is_ready_for_transfer() && is_ready_for_dequeue(); };
+    status = cv_wait_for(lock, m_timeout, is_ready);
+    if (HAILO_SUCCESS != status) {
+        // errors logs on cv_wait_for
+        return status;
+    }
+
+    auto stream_buffer_exp = m_buffer_pool->dequeue();
+    CHECK_EXPECTED_AS_STATUS(stream_buffer_exp);
+    auto stream_buffer = stream_buffer_exp.release();
+
+    // Gather the planes straight into the owned (DMA) buffer - no intermediate contiguous copy
+    size_t plane_offset = 0;
+    for (const auto &plane : planes) {
+        auto copy_status = stream_buffer.copy_from_offset(plane, plane_offset);
+        CHECK_SUCCESS(copy_status);
+        plane_offset += plane.size();
+    }
+
+    return call_write_async_impl(TransferRequest(std::move(stream_buffer),
+        [this, stream_buffer](hailo_status) {
+            std::unique_lock<std::mutex> lock(m_stream_mutex);
+            auto enqueue_status = m_buffer_pool->enqueue(TransferBuffer{stream_buffer});
+            if (HAILO_SUCCESS != enqueue_status) {
+                LOGGER__ERROR("Failed enqueue stream buffer {}", enqueue_status);
+            }
+        }
+    ));
+}
+
 hailo_status AsyncInputStreamBase::write_impl(const MemoryView &user_buffer)
 {
     auto status = set_buffer_mode(StreamBufferMode::OWNING);
@@ -149,6 +203,17 @@ Expected<size_t> AsyncInputStreamBase::get_async_max_queue_size() const
 {
     return get_max_ongoing_transfers();
 }
+Expected<int> AsyncInputStreamBase::get_wait_fd()
+{
+#if defined(__linux__)
+    CHECK_AS_EXPECTED(nullptr != m_readiness_event, HAILO_NOT_SUPPORTED);
+    return static_cast<int>(m_readiness_event->get_underlying_handle());
+#else
+    // The underlying waitable is not a file descriptor on this platform
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+#endif
+}
+
 
 hailo_status AsyncInputStreamBase::wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout)
 {
@@ -212,12 +277,29 @@ hailo_status AsyncInputStreamBase::deactivate_stream()
         m_is_stream_activated = false;
     }
     m_has_ready_buffer.notify_all();
+    if (m_readiness_event) { (void)m_readiness_event->signal(); }
 
     return status;
 }
 
 hailo_status AsyncInputStreamBase::call_write_async_impl(TransferRequest &&transfer_request)
 {
+    // Record/replay capture (HAILO_LITE_TRACE with the STREAM category bit): a timestamped
+    // size + content-hash record per submission is what a replay feeder needs to re-synthesize
+    // the exact arrival process offline and verify content determinism against a run. Costs one
+    // hardware-CRC pass per frame, only when the category is enabled.
+    if (LiteTracer::instance().is_category_enabled(LITE_TRACE_CATEGORY_STREAM)) {
+        uint32_t frame_crc = 0;
+        uint32_t frame_size = 0;
+        for (auto &transfer_buffer : transfer_request.transfer_buffers) {
+            auto *base = transfer_buffer.base_buffer()->data() + transfer_buffer.offset();
+            frame_crc = crc32c::compute(base, transfer_buffer.size(), frame_crc);
+            frame_size += static_cast<uint32_t>(transfer_buffer.size());
+        }
+        LITE_TRACE(LITE_TRACE_CATEGORY_STREAM, 0 /* frame submission hash */, frame_crc);
+        LITE_TRACE(LITE_TRACE_CATEGORY_STREAM, 1 /* frame submission size */, frame_size);
+    }
+
     transfer_request.callback = [this, callback=transfer_request.callback](hailo_status callback_status) {
         callback(callback_status);
 
@@ -227,6 +309,7 @@ hailo_status AsyncInputStreamBase::call_write_async_impl(TransferRequest &&trans
         }
 
         m_has_ready_buffer.notify_all();
+    if (m_readiness_event) { (void)m_readiness_event->signal(); }
     };
 
 
@@ -259,7 +342,13 @@ AsyncOutputStreamBase::AsyncOutputStreamBase(const LayerInfo &edge_layer, EventP
         m_timeout(DEFAULT_TRANSFER_TIMEOUT),
         m_buffer_mode(StreamBufferMode::NOT_SET),
         m_ongoing_transfers(0)
-{}
+{
+    // Best effort - streams without the event still work, get_wait_fd() just won't be available
+    auto readiness_event = Event::create_shared(Event::State::not_signalled);
+    if (readiness_event) {
+        m_readiness_event = readiness_event.release();
+    }
+}
 
 hailo_status AsyncOutputStreamBase::abort_impl()
 {
@@ -268,6 +357,7 @@ hailo_status AsyncOutputStreamBase::abort_impl()
         m_is_aborted = true;
     }
     m_has_ready_buffer.notify_all();
+    if (m_readiness_event) { (void)m_readiness_event->signal(); }
     return HAILO_SUCCESS;
 }
 
@@ -298,6 +388,17 @@ Expected<size_t> AsyncOutputStreamBase::get_async_max_queue_size() const
 {
     return get_max_ongoing_transfers();
 }
+Expected<int> AsyncOutputStreamBase::get_wait_fd()
+{
+#if defined(__linux__)
+    CHECK_AS_EXPECTED(nullptr != m_readiness_event, HAILO_NOT_SUPPORTED);
+    return static_cast<int>(m_readiness_event->get_underlying_handle());
+#else
+    // The underlying waitable is not a file descriptor on this platform
+    return make_unexpected(HAILO_NOT_SUPPORTED);
+#endif
+}
+
 
 hailo_status AsyncOutputStreamBase::read_async(TransferRequest &&transfer_request)
 {
@@ -315,6 +416,46 @@ hailo_status AsyncOutputStreamBase::read_async(TransferRequest &&transfer_reques
     return call_read_async_impl(std::move(transfer_request));
 }
 
+hailo_status AsyncOutputStreamBase::read_async_impl(std::vector<TransferRequest> &&transfer_requests)
+{
+    for (auto &transfer_request : transfer_requests) {
+        auto status = read_async_impl(std::move(transfer_request));
+        if (HAILO_STREAM_ABORTED_BY_USER == status) {
+            return status;
+        }
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status AsyncOutputStreamBase::call_read_async_impl(std::vector<TransferRequest> &&transfer_requests)
+{
+    for (auto &transfer_request : transfer_requests) {
+        transfer_request.callback = [this, callback=transfer_request.callback](hailo_status callback_status) {
+            callback(callback_status);
+
+            {
+                std::lock_guard<std::mutex> lock(m_stream_mutex);
+                m_ongoing_transfers--;
+            }
+
+            m_has_ready_buffer.notify_all();
+            if (m_readiness_event) { (void)m_readiness_event->signal(); }
+        };
+    }
+
+    const auto requests_count = transfer_requests.size();
+    auto status = read_async_impl(std::move(transfer_requests));
+    if (HAILO_STREAM_ABORTED_BY_USER == status) {
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    m_ongoing_transfers += requests_count;
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status AsyncOutputStreamBase::call_read_async_impl(TransferRequest &&transfer_request)
 {
     transfer_request.callback = [this, callback=transfer_request.callback](hailo_status callback_status) {
@@ -326,6 +467,7 @@ hailo_status AsyncOutputStreamBase::call_read_async_impl(TransferRequest &&trans
         }
 
         m_has_ready_buffer.notify_all();
+    if (m_readiness_event) { (void)m_readiness_event->signal(); }
     };
 
     auto status = read_async_impl(std::move(transfer_request));
@@ -380,6 +522,7 @@ hailo_status AsyncOutputStreamBase::deactivate_stream()
         }
     }
     m_has_ready_buffer.notify_all();
+    if (m_readiness_event) { (void)m_readiness_event->signal(); }
 
     return status;
 }
@@ -391,11 +534,37 @@ bool AsyncOutputStreamBase::is_ready_for_transfer() const
 
 hailo_status AsyncOutputStreamBase::prepare_all_transfers()
 {
+    // The whole activation batch goes down in one submission - on vdma every descriptor is
+    // programmed up front and the doorbell rings once for the batch (see
+    // BoundaryChannel::launch_transfers) instead of once per transfer
     const auto queue_size = get_max_ongoing_transfers();
+    std::vector<TransferRequest> transfer_requests;
+    transfer_requests.reserve(queue_size);
     for (size_t i = 0; i < queue_size; i++) {
-        auto status = dequeue_and_launch_transfer();
-        CHECK_SUCCESS(status);
+        auto buffer = m_buffer_pool->dequeue();
+        CHECK_EXPECTED_AS_STATUS(buffer);
+
+        auto callback = [this, buffer=buffer.value()](hailo_status status) {
+            if (HAILO_STREAM_ABORTED_BY_USER == status) {
+                // On deactivation flow, we should get this status. We just ignore the callback here, and in the next
+                // activation we should reset the buffers.
+                return;
+            }
+
+            status = m_pending_buffers.enqueue(TransferBuffer{buffer});
+            if (HAILO_SUCCESS != status) {
+                LOGGER__ERROR("Failed to enqueue pending buffer {}", status);
+            }
+        };
+        transfer_requests.emplace_back(TransferRequest(std::move(buffer.value()), callback));
+    }
+
+    auto status = call_read_async_impl(std::move(transfer_requests));
+    if (HAILO_STREAM_ABORTED_BY_USER == status) {
+        // The buffer_pool state will reset on next activation.
+        return status;
     }
+    CHECK_SUCCESS(status, "Fatal error {} while launching transfers. state may be corrupted", status);
 
     return HAILO_SUCCESS;
 }
@@ -473,6 +642,14 @@ hailo_status AsyncOutputStreamBase::read_impl(MemoryView user_buffer)
     return HAILO_SUCCESS;
 }
 
+// On speculative re-arm (HRT wishlist):
+//       For dedicated (non-scheduled) streams this function already keeps the channel pre-armed:
+//       D2H transfers are launched ahead of need up to the ring depth, so the next frame's
+//       doorbell doesn't wait for the host round-trip after a completion. The remaining gap is
+//       scheduler-managed streams, where re-arming K transfers ahead speculates that no core-op
+//       switch happens between them - safe exactly when the scheduler is in the single-core-op
+//       run-to-completion shape (see CoreOpsScheduler::schedule fast path); wiring that condition
+//       through to pre-arm scheduled streams is the follow-up this note tracks.
 hailo_status AsyncOutputStreamBase::dequeue_and_launch_transfer()
 {
     auto buffer = m_buffer_pool->dequeue();
@@ -18,6 +18,10 @@
 
 #include "utils/thread_safe_queue.hpp"
 
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
 namespace hailort
 {
 
@@ -30,12 +34,14 @@ public:
     virtual std::chrono::milliseconds get_timeout() const override;
     virtual hailo_status set_timeout(std::chrono::milliseconds timeout) override;
     virtual hailo_status flush() override;
+    virtual hailo_status write_v(const std::vector<MemoryView> &planes) override;
 
     virtual hailo_status abort_impl() override;
     virtual hailo_status clear_abort_impl() override;
 
     virtual Expected<size_t> get_async_max_queue_size() const override;
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout) override;
+    virtual Expected<int> get_wait_fd() override;
     virtual hailo_status write_async(TransferRequest &&transfer_request) override;
 
     virtual hailo_status write_impl(const MemoryView &buffer) override;
@@ -59,9 +65,67 @@ private:
     bool is_ready_for_transfer() const;
     bool is_ready_for_dequeue() const;
 
+    // Pluggable wait strategy for the hybrid wait mode: HAILO_WAIT_STRATEGY selects how the spin
+    // phase behaves - "spin" (pure busy poll, bare metal low latency), "spin-yield" (default -
+    // yields between probes, cooperative under CPU overcommit/KVM) or "block" (no spin phase at
+    // all, strictly condvar, for heavily overcommitted guests). The spin budget comes from
+    // HAILO_SPIN_WAIT_US (default 0 = off, making every strategy effectively "block").
+    enum class WaitStrategy { BLOCK = 0, SPIN, SPIN_YIELD };
+
+    static WaitStrategy wait_strategy()
+    {
+        static const WaitStrategy strategy = []() {
+            const auto *env = std::getenv("HAILO_WAIT_STRATEGY");
+            if (nullptr == env) {
+                return WaitStrategy::SPIN_YIELD;
+            }
+            if (0 == strcmp(env, "spin")) {
+                return WaitStrategy::SPIN;
+            }
+            if (0 == strcmp(env, "block")) {
+                return WaitStrategy::BLOCK;
+            }
+            return WaitStrategy::SPIN_YIELD;
+        }();
+        return strategy;
+    }
+
+    // Spin budget (microseconds) for the hybrid wait mode - the predicate is polled for this long
+    // before parking on the condition variable, trading a little CPU for wake latency on
+    // sub-millisecond models. Configured once per process via HAILO_SPIN_WAIT_US (default 0 = off).
+    static std::chrono::microseconds spin_wait_budget()
+    {
+        static const auto budget = std::chrono::microseconds(
+            (nullptr != std::getenv("HAILO_SPIN_WAIT_US")) ? strtoul(std::getenv("HAILO_SPIN_WAIT_US"), nullptr, 10) : 0);
+        return (WaitStrategy::BLOCK == wait_strategy()) ? std::chrono::microseconds(0) : budget;
+    }
+
     template<typename Pred>
     hailo_status cv_wait_for(std::unique_lock<std::mutex> &lock, std::chrono::milliseconds timeout, Pred &&pred)
     {
+        // Hybrid wait - poll first within the configured spin budget (re-taking the lock per probe
+        // so completion callbacks can make progress), then fall back to the blocking wait
+        const auto budget = spin_wait_budget();
+        if (budget.count() > 0) {
+            const auto spin_deadline = std::chrono::steady_clock::now() + budget;
+            while (std::chrono::steady_clock::now() < spin_deadline) {
+                if (m_is_aborted) {
+                    return HAILO_STREAM_ABORTED_BY_USER;
+                }
+                if (!m_is_stream_activated) {
+                    return HAILO_STREAM_NOT_ACTIVATED;
+                }
+                if (pred()) {
+                    return HAILO_SUCCESS;
+                }
+                lock.unlock();
+                if (WaitStrategy::SPIN_YIELD == wait_strategy()) {
+                    std::this_thread::yield();
+                }
+                lock.lock();
+            }
+        }
+
         hailo_status status = HAILO_SUCCESS;
         const auto wait_done = m_has_ready_buffer.wait_for(lock, timeout,
             [this, pred, &status] {
@@ -101,6 +165,11 @@ private:
 
     // Conditional variable that is use to check if we have some buffer in m_buffer_pool ready to be written to.
     std::condition_variable m_has_ready_buffer;
+
+protected:
+    // Eventfd-backed readiness notification mirrored on every m_has_ready_buffer wakeup, exposed
+    // via get_wait_fd() for epoll based event loops
+    EventPtr m_readiness_event;
 };
 
 
@@ -113,6 +182,7 @@ public:
     virtual hailo_status set_timeout(std::chrono::milliseconds timeout) override;
 
     virtual hailo_status wait_for_async_ready(size_t transfer_size, std::chrono::milliseconds timeout) override;
+    virtual Expected<int> get_wait_fd() override;
     virtual Expected<size_t> get_async_max_queue_size() const override;
     virtual hailo_status read_async(TransferRequest &&transfer_request) override;
 
@@ -128,6 +198,9 @@ public:
     virtual Expected<std::unique_ptr<StreamBufferPool>> allocate_buffer_pool() = 0;
     virtual size_t get_max_ongoing_transfers() const = 0;
     virtual hailo_status read_async_impl(TransferRequest &&transfer_request) = 0;
+    // Batch submission - backends that support it (vdma) program every descriptor first and ring
+    // the doorbell once for the whole batch. The default lowers to per-transfer submission.
+    virtual hailo_status read_async_impl(std::vector<TransferRequest> &&transfer_requests);
     virtual hailo_status activate_stream_impl() { return HAILO_SUCCESS; }
     virtual hailo_status deactivate_stream_impl() { return HAILO_SUCCESS; }
 
@@ -136,6 +209,7 @@ protected:
 
 private:
     hailo_status call_read_async_impl(TransferRequest &&transfer_request);
+    hailo_status call_read_async_impl(std::vector<TransferRequest> &&transfer_requests);
 
     bool is_ready_for_transfer() const;
 
@@ -144,9 +218,67 @@ private:
 
     hailo_status dequeue_and_launch_transfer();
 
+    // Pluggable wait strategy for the hybrid wait mode: HAILO_WAIT_STRATEGY selects how the spin
+    // phase behaves - "spin" (pure busy poll, bare metal low latency), "spin-yield" (default -
+    // yields between probes, cooperative under CPU overcommit/KVM) or "block" (no spin phase at
+    // all, strictly condvar, for heavily overcommitted guests). The spin budget comes from
+    // HAILO_SPIN_WAIT_US (default 0 = off, making every strategy effectively "block").
+    enum class WaitStrategy { BLOCK = 0, SPIN, SPIN_YIELD };
+
+    static WaitStrategy wait_strategy()
+    {
+        static const WaitStrategy strategy = []() {
+            const auto *env = std::getenv("HAILO_WAIT_STRATEGY");
+            if (nullptr == env) {
+                return WaitStrategy::SPIN_YIELD;
+            }
+            if (0 == strcmp(env, "spin")) {
+                return WaitStrategy::SPIN;
+            }
+            if (0 == strcmp(env, "block")) {
+                return WaitStrategy::BLOCK;
+            }
+            return WaitStrategy::SPIN_YIELD;
+        }();
+        return strategy;
+    }
+
+    // Spin budget (microseconds) for the hybrid wait mode - the predicate is polled for this long
+    // before parking on the condition variable, trading a little CPU for wake latency on
+    // sub-millisecond models. Configured once per process via HAILO_SPIN_WAIT_US (default 0 = off).
+    static std::chrono::microseconds spin_wait_budget()
+    {
+        static const auto budget = std::chrono::microseconds(
+            (nullptr != std::getenv("HAILO_SPIN_WAIT_US")) ? strtoul(std::getenv("HAILO_SPIN_WAIT_US"), nullptr, 10) : 0);
+        return (WaitStrategy::BLOCK == wait_strategy()) ? std::chrono::microseconds(0) : budget;
+    }
+
     template<typename Pred>
     hailo_status cv_wait_for(std::unique_lock<std::mutex> &lock, std::chrono::milliseconds timeout, Pred &&pred)
     {
+        // Hybrid wait - poll first within the configured spin budget (re-taking the lock per probe
+        // so completion callbacks can make progress), then fall back to the blocking wait
+        const auto budget = spin_wait_budget();
+        if (budget.count() > 0) {
+            const auto spin_deadline = std::chrono::steady_clock::now() + budget;
+            while (std::chrono::steady_clock::now() < spin_deadline) {
+                if (m_is_aborted) {
+                    return HAILO_STREAM_ABORTED_BY_USER;
+                }
+                if (!m_is_stream_activated) {
+                    return HAILO_STREAM_NOT_ACTIVATED;
+                }
+                if (pred()) {
+                    return HAILO_SUCCESS;
+                }
+                lock.unlock();
+                if (WaitStrategy::SPIN_YIELD == wait_strategy()) {
+                    std::this_thread::yield();
+                }
+                lock.lock();
+            }
+        }
+
         hailo_status status = HAILO_SUCCESS;
         const auto wait_done = m_has_ready_buffer.wait_for(lock, timeout,
             [this, pred, &status] {
@@ -190,6 +322,9 @@ private:
 
     // Conditional variable that is use to check if we have some pending buffer ready to be read.
     std::condition_variable m_has_ready_buffer;
+
+    // Eventfd-backed readiness notification (see AsyncInputStreamBase::m_readiness_event)
+    EventPtr m_readiness_event;
 };
 
 
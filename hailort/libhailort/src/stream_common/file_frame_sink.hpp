@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file file_frame_sink.hpp
+ * @brief Output-to-file sink for batch jobs: D2H frames land in page-aligned buffers and are
+ *        written back with O_DIRECT, double buffered - the write of frame N overlaps the device
+ *        transfer of frame N+1, and the page cache isn't polluted by data that is never re-read.
+ **/
+
+#ifndef _HAILO_FILE_FRAME_SINK_HPP_
+#define _HAILO_FILE_FRAME_SINK_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+
+#include "common/utils.hpp"
+
+#include <string>
+#include <thread>
+#include <condition_variable>
+#include <mutex>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdlib>
+#endif
+
+namespace hailort
+{
+
+class FileFrameSink final
+{
+public:
+    static Expected<FileFrameSink> create(const std::string &file_path, size_t frame_size)
+    {
+#if defined(__linux__)
+        CHECK_AS_EXPECTED(frame_size > 0, HAILO_INVALID_ARGUMENT, "Frame size must be greater than zero");
+
+        // O_DIRECT needs the write size and buffer alignment to match the logical block size;
+        // page alignment satisfies every common device. Frames whose size isn't page aligned are
+        // staged into the padded aligned slot (the file is truncated to the exact size on close).
+        auto fd = open(file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, S_IRUSR | S_IWUSR);
+        if (fd < 0) {
+            // Filesystems without O_DIRECT support fall back to buffered writes
+            fd = open(file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+        }
+        CHECK_AS_EXPECTED(fd >= 0, HAILO_OPEN_FILE_FAILURE, "Failed opening output file \"{}\" (errno {})",
+            file_path, errno);
+
+        const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t slot_size = ((frame_size + page_size - 1) / page_size) * page_size;
+
+        void *slots[2] = {nullptr, nullptr};
+        for (auto &slot : slots) {
+            if (0 != posix_memalign(&slot, page_size, slot_size)) {
+                free(slots[0]);
+                (void)close(fd);
+                return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+            }
+        }
+
+        return FileFrameSink(fd, frame_size, slot_size, slots);
+#else
+        (void)file_path;
+        (void)frame_size;
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+#endif
+    }
+
+    FileFrameSink(const FileFrameSink &) = delete;
+    FileFrameSink &operator=(const FileFrameSink &) = delete;
+    FileFrameSink(FileFrameSink &&other) :
+        m_fd(other.m_fd),
+        m_frame_size(other.m_frame_size),
+        m_slot_size(other.m_slot_size),
+        m_frames_written(other.m_frames_written),
+        m_pending_slot(-1),
+        m_shutdown(false)
+    {
+        m_slots[0] = other.m_slots[0];
+        m_slots[1] = other.m_slots[1];
+        other.m_slots[0] = nullptr;
+        other.m_slots[1] = nullptr;
+        other.m_fd = -1;
+        start_writer();
+    }
+
+    ~FileFrameSink()
+    {
+#if defined(__linux__)
+        stop_writer();
+        if (m_fd >= 0) {
+            // Trim the O_DIRECT padding of the final frame
+            (void)ftruncate(m_fd, static_cast<off_t>(m_frames_written * m_frame_size));
+            (void)close(m_fd);
+        }
+        free(m_slots[0]);
+        free(m_slots[1]);
+#endif
+    }
+
+    /**
+     * Returns the page-aligned slot the next D2H frame should land in. Alternates between the two
+     * slots - call push() after the frame is in the returned slot.
+     */
+    MemoryView next_slot()
+    {
+        return MemoryView(m_slots[m_frames_written % 2], m_frame_size);
+    }
+
+    /**
+     * Queues the slot filled via next_slot() for writeback. Blocks only when the previous write is
+     * still in flight (i.e. the disk can't keep up with the device).
+     */
+    hailo_status push()
+    {
+#if defined(__linux__)
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return (m_pending_slot < 0) || m_shutdown; });
+        if (m_shutdown) {
+            return HAILO_STREAM_NOT_ACTIVATED;
+        }
+        m_pending_slot = static_cast<int>(m_frames_written % 2);
+        m_frames_written++;
+        m_cv.notify_all();
+        return HAILO_SUCCESS;
+#else
+        return HAILO_NOT_SUPPORTED;
+#endif
+    }
+
+    // Waits until all queued frames reached the file
+    hailo_status flush()
+    {
+#if defined(__linux__)
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return m_pending_slot < 0; });
+        return m_write_status;
+#else
+        return HAILO_NOT_SUPPORTED;
+#endif
+    }
+
+private:
+    FileFrameSink(int fd, size_t frame_size, size_t slot_size, void *slots[2]) :
+        m_fd(fd),
+        m_frame_size(frame_size),
+        m_slot_size(slot_size),
+        m_frames_written(0),
+        m_pending_slot(-1),
+        m_shutdown(false)
+    {
+        m_slots[0] = slots[0];
+        m_slots[1] = slots[1];
+        start_writer();
+    }
+
+    void start_writer()
+    {
+#if defined(__linux__)
+        m_writer = std::thread([this]() {
+            while (true) {
+                int slot = -1;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_cv.wait(lock, [this]() { return (m_pending_slot >= 0) || m_shutdown; });
+                    if (m_shutdown && (m_pending_slot < 0)) {
+                        return;
+                    }
+                    slot = m_pending_slot;
+                }
+
+                const auto written = write(m_fd, m_slots[slot], m_slot_size);
+
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    if (written != static_cast<ssize_t>(m_slot_size)) {
+                        m_write_status = HAILO_FILE_OPERATION_FAILURE;
+                    }
+                    m_pending_slot = -1;
+                }
+                m_cv.notify_all();
+            }
+        });
+#endif
+    }
+
+    void stop_writer()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_cv.notify_all();
+        if (m_writer.joinable()) {
+            m_writer.join();
+        }
+    }
+
+    int m_fd;
+    size_t m_frame_size;
+    size_t m_slot_size;
+    void *m_slots[2];
+    size_t m_frames_written;
+    int m_pending_slot;
+    bool m_shutdown;
+    hailo_status m_write_status = HAILO_SUCCESS;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::thread m_writer;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_FILE_FRAME_SINK_HPP_ */
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file file_frame_source.hpp
+ * @brief Direct-from-file input feeding: mmaps a raw frame file and exposes per-frame views over
+ *        the mapped pages. Register the views for DMA (VDevice::dma_map) once and submit them with
+ *        write_async - batch-scoring jobs then stream straight from the page cache into the device
+ *        without a read() copy into user memory. MADV_SEQUENTIAL keeps readahead in front of the
+ *        submissions.
+ **/
+
+#ifndef _HAILO_FILE_FRAME_SOURCE_HPP_
+#define _HAILO_FILE_FRAME_SOURCE_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+
+#include "common/utils.hpp"
+
+#include <string>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hailort
+{
+
+class FileFrameSource final
+{
+public:
+    static Expected<FileFrameSource> create(const std::string &file_path, size_t frame_size)
+    {
+#if defined(__linux__)
+        CHECK_AS_EXPECTED(frame_size > 0, HAILO_INVALID_ARGUMENT, "Frame size must be greater than zero");
+
+        const auto fd = open(file_path.c_str(), O_RDONLY);
+        CHECK_AS_EXPECTED(fd >= 0, HAILO_OPEN_FILE_FAILURE, "Failed opening input file \"{}\" (errno {})",
+            file_path, errno);
+
+        struct stat file_stat{};
+        if (0 != fstat(fd, &file_stat)) {
+            (void)close(fd);
+            LOGGER__ERROR("Failed to stat input file \"{}\" (errno {})", file_path, errno);
+            return make_unexpected(HAILO_FILE_OPERATION_FAILURE);
+        }
+        const auto file_size = static_cast<size_t>(file_stat.st_size);
+
+        auto *data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        (void)close(fd);
+        CHECK_AS_EXPECTED(MAP_FAILED != data, HAILO_FILE_OPERATION_FAILURE,
+            "Failed mapping input file \"{}\" (errno {})", file_path, errno);
+
+        // Submissions walk the file front to back
+        (void)madvise(data, file_size, MADV_SEQUENTIAL);
+
+        return FileFrameSource(data, file_size, frame_size);
+#else
+        (void)file_path;
+        (void)frame_size;
+        return make_unexpected(HAILO_NOT_SUPPORTED);
+#endif
+    }
+
+    FileFrameSource(const FileFrameSource &) = delete;
+    FileFrameSource &operator=(const FileFrameSource &) = delete;
+    FileFrameSource(FileFrameSource &&other) :
+        m_data(other.m_data),
+        m_size(other.m_size),
+        m_frame_size(other.m_frame_size)
+    {
+        other.m_data = nullptr;
+    }
+
+    ~FileFrameSource()
+    {
+#if defined(__linux__)
+        if (nullptr != m_data) {
+            (void)munmap(m_data, m_size);
+        }
+#endif
+    }
+
+    size_t frames_count() const
+    {
+        return m_size / m_frame_size;
+    }
+
+    size_t file_size() const
+    {
+        return m_size;
+    }
+
+    // View over frame @a index inside the mapped file - valid for the source's lifetime. The view
+    // can be DMA-registered once and submitted repeatedly.
+    MemoryView frame(size_t index)
+    {
+        assert(index < frames_count());
+        return MemoryView(static_cast<uint8_t *>(m_data) + (index * m_frame_size), m_frame_size);
+    }
+
+private:
+    FileFrameSource(void *data, size_t size, size_t frame_size) :
+        m_data(data),
+        m_size(size),
+        m_frame_size(frame_size)
+    {}
+
+    void *m_data;
+    size_t m_size;
+    size_t m_frame_size;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_FILE_FRAME_SOURCE_HPP_ */
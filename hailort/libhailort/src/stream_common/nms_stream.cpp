@@ -259,6 +259,36 @@ hailo_status NMSStreamReader::read_nms_burst_mode(OutputStreamBase &stream, void
         bool can_stop_reading_burst = false;
         // Iterate through burst and copy relevant data to user buffer
         for (size_t burst_offset = 0; burst_offset < burst_size; burst_offset += bbox_size) {
+            // Burst decode fast path - while waiting for a delimiter the bboxes are contiguous, so
+            // scan to the next delimiter/padding word and copy the whole run in one pass instead
+            // of a copy per bbox. The loop then resumes at the delimiter word itself.
+            if (NMSBurstState::NMS_BURST_STATE_WAITING_FOR_DELIMETER == burst_state) {
+                const uint8_t *burst_base = is_interrupt_per_frame ?
+                    (current_burst.data() + (burst_index * burst_size)) : current_burst.data();
+                size_t run_count = 0;
+                const size_t max_run = (burst_size - burst_offset) / bbox_size;
+                while (run_count < max_run) {
+                    uint64_t word = 0;
+                    memcpy(&word, burst_base + burst_offset + (run_count * bbox_size), sizeof(word));
+                    if ((NMS_DELIMITER == word) || (NMS_IMAGE_DELIMITER == word) || (NMS_H15_PADDING == word)) {
+                        break;
+                    }
+                    run_count++;
+                }
+                if (run_count > 0) {
+                    memcpy(static_cast<uint8_t*>(buffer) + offset, burst_base + burst_offset, run_count * bbox_size);
+                    offset += run_count * bbox_size;
+                    class_bboxes_count = static_cast<nms_bbox_counter_t>(class_bboxes_count + run_count);
+                    CHECK_IN_DEBUG(class_bboxes_count <= stream.get_info().nms_info.max_bboxes_per_class, HAILO_INTERNAL_FAILURE,
+                        "Data read from the device for the current class was size {}, max size is {}", class_bboxes_count,
+                        stream.get_info().nms_info.max_bboxes_per_class);
+                    burst_offset += run_count * bbox_size;
+                    if (burst_offset >= burst_size) {
+                        break;
+                    }
+                }
+            }
+
             uint64_t current_bbox = 0;
             if (is_interrupt_per_frame) {
                 assert((burst_index * burst_size) + burst_offset < transfer_size);
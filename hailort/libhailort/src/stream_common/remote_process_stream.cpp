@@ -10,12 +10,26 @@
 
 #include "common/os_utils.hpp"
 
+#include <cstdlib>
+
 namespace hailort
 {
 
 constexpr size_t MIN_QUEUE_SIZE = 2;
 constexpr size_t DEFAULT_QUEUE_SIZE = 4;
 
+// Grace period before a stalled fan-out ring suspects a dead consumer (see dequeue_hw_buffer)
+static const std::chrono::milliseconds FANOUT_REAP_GRACE(3000);
+
+static size_t fanout_consumers_from_env()
+{
+    const auto *fanout_env = std::getenv("HAILO_STREAM_FANOUT_CONSUMERS");
+    if (nullptr == fanout_env) {
+        return 1;
+    }
+    return static_cast<size_t>(strtoul(fanout_env, nullptr, 10));
+}
+
 Expected<std::unique_ptr<RemoteProcessBufferPool>> RemoteProcessBufferPool::create(
     hailo_stream_direction_t stream_direction, size_t frame_size, size_t queue_size)
 {
@@ -58,9 +72,48 @@ RemoteProcessBufferPool::RemoteProcessBufferPool(hailo_stream_direction_t stream
         queue_to_fill.push_back(SharedBuffer{buffer_view, SharedBuffer::Type::DATA});
     }
 
+    // Fan-out applies to the read side - on D2H every attached consumer process sees every
+    // published frame, instead of the frames being split between them
+    if ((HAILO_D2H_STREAM == stream_direction) && (fanout_consumers_from_env() > 1)) {
+        m_fanout_mode = true;
+        m_fanout.init(queue_size);
+        m_fanout_slots_count = queue_size;
+    }
+
     status = HAILO_SUCCESS;
 }
 
+Expected<uint32_t> RemoteProcessBufferPool::attach_fanout_consumer()
+{
+    std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
+    CHECK_AS_EXPECTED(m_fanout_mode, HAILO_INVALID_OPERATION, "Pool was not created in fan-out mode");
+    const auto consumer_id = m_fanout.register_consumer();
+    CHECK_AS_EXPECTED(SharedRingFanout::INVALID_CONSUMER_ID != consumer_id, HAILO_OUT_OF_HOST_MEMORY,
+        "All {} fan-out consumer slots are taken", SharedRingFanout::MAX_CONSUMERS);
+    return Expected<uint32_t>(consumer_id);
+}
+
+void RemoteProcessBufferPool::detach_fanout_consumer(uint32_t consumer_id)
+{
+    {
+        std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
+        m_fanout.unregister_consumer(consumer_id);
+        reclaim_consumed_slots();
+    }
+    // A detach can release the watermark and unblock the producer
+    m_cv.notify_all();
+}
+
+void RemoteProcessBufferPool::reclaim_consumed_slots()
+{
+    const auto watermark = m_fanout.consumed_watermark();
+    while (m_reclaimed_cursor < watermark) {
+        assert(!m_hw_buffers_queue.full());
+        m_hw_buffers_queue.push_back(m_fanout_slots[m_reclaimed_cursor % m_fanout_slots_count]);
+        m_reclaimed_cursor++;
+    }
+}
+
 void RemoteProcessBufferPool::abort()
 {
     {
@@ -80,9 +133,48 @@ Expected<RemoteProcessBufferPool::SharedBuffer> RemoteProcessBufferPool::dequeue
     std::chrono::milliseconds timeout)
 {
     std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
-    auto status = cv_wait_for(lock, timeout, [this]() {
+    auto buffer_available = [this]() {
+        if (m_fanout_mode) {
+            reclaim_consumed_slots();
+        }
         return !m_hw_buffers_queue.empty();
-    });
+    };
+
+    auto status = HAILO_UNINITIALIZED;
+    if (m_fanout_mode) {
+        // A dead consumer process stops advancing its cursor and would stall the ring forever.
+        // When a wait exceeds the grace period, snapshot the liveness epochs, grant one more
+        // grace period, and reap the consumers whose epoch did not move - all within the
+        // caller's overall timeout.
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+            if (remaining <= std::chrono::milliseconds(0)) {
+                status = HAILO_TIMEOUT;
+                break;
+            }
+            status = cv_wait_for(lock, std::min(remaining, FANOUT_REAP_GRACE), buffer_available);
+            if (HAILO_TIMEOUT != status) {
+                break;
+            }
+            if (remaining <= FANOUT_REAP_GRACE) {
+                break;
+            }
+            uint64_t epochs_snapshot[SharedRingFanout::MAX_CONSUMERS];
+            m_fanout.snapshot_epochs(epochs_snapshot);
+            status = cv_wait_for(lock, FANOUT_REAP_GRACE, buffer_available);
+            if (HAILO_TIMEOUT != status) {
+                break;
+            }
+            const auto reaped_count = m_fanout.reap_unchanged(epochs_snapshot);
+            if (reaped_count > 0) {
+                LOGGER__WARNING("Reaped {} dead fan-out consumers stalling the stream ring", reaped_count);
+            }
+        }
+    } else {
+        status = cv_wait_for(lock, timeout, buffer_available);
+    }
     if (HAILO_SUCCESS != status) {
         return make_unexpected(status);
     }
@@ -123,10 +215,48 @@ hailo_status RemoteProcessBufferPool::enqueue_host_buffer(SharedBuffer buffer)
 {
     {
         std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
-        CHECK(!m_host_buffers_queue.full(), HAILO_INTERNAL_FAILURE, "Host buffer is full");
-        m_host_buffers_queue.push_back(buffer);
+        if (m_fanout_mode) {
+            // Publish into the fan-out ring - every attached consumer will see this frame. The
+            // slot is free by construction: the producer can only hold buffers the watermark
+            // already released.
+            uint64_t slot = 0;
+            CHECK(m_fanout.try_begin_write(slot), HAILO_INTERNAL_FAILURE, "Fan-out ring is unexpectedly full");
+            m_fanout_slots[slot] = buffer;
+            m_fanout.commit_write();
+        } else {
+            CHECK(!m_host_buffers_queue.full(), HAILO_INTERNAL_FAILURE, "Host buffer is full");
+            m_host_buffers_queue.push_back(buffer);
+        }
     }
-    m_cv.notify_one();
+    m_cv.notify_all();
+    return HAILO_SUCCESS;
+}
+
+Expected<RemoteProcessBufferPool::SharedBuffer> RemoteProcessBufferPool::dequeue_host_buffer(
+    uint32_t consumer_id, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
+    uint64_t slot = 0;
+    auto status = cv_wait_for(lock, timeout, [this, consumer_id, &slot]() {
+        return m_fanout.try_read(consumer_id, slot);
+    });
+    if (HAILO_SUCCESS != status) {
+        return make_unexpected(status);
+    }
+
+    auto result = m_fanout_slots[slot];
+    return result;
+}
+
+hailo_status RemoteProcessBufferPool::release_fanout_buffer(uint32_t consumer_id)
+{
+    {
+        std::unique_lock<RecursiveSharedMutex> lock(m_mutex);
+        m_fanout.advance(consumer_id);
+        reclaim_consumed_slots();
+    }
+    // Wakes the producer waiting for a recycled hw buffer
+    m_cv.notify_all();
     return HAILO_SUCCESS;
 }
 
@@ -397,6 +527,12 @@ Expected<std::shared_ptr<RemoteProcessOutputStream>> RemoteProcessOutputStream::
 
 RemoteProcessOutputStream::~RemoteProcessOutputStream()
 {
+    // Only this process' consumer cursor is ours to detach (a forked child attached its own)
+    if ((nullptr != m_buffer_pool) && (SharedRingFanout::INVALID_CONSUMER_ID != m_fanout_consumer_id) &&
+        (OsUtils::get_curr_pid() == m_fanout_consumer_pid)) {
+        m_buffer_pool->detach_fanout_consumer(m_fanout_consumer_id);
+    }
+
     if (m_read_thread.joinable()) {
         auto status = m_wait_for_activation.shutdown();
         if (HAILO_SUCCESS != status) {
@@ -470,8 +606,39 @@ hailo_status RemoteProcessOutputStream::cancel_pending_transfers()
     return m_base_stream->cancel_pending_transfers();
 }
 
+hailo_status RemoteProcessOutputStream::ensure_fanout_consumer()
+{
+    const auto current_pid = OsUtils::get_curr_pid();
+    if (m_fanout_consumer_pid == current_pid) {
+        return HAILO_SUCCESS;
+    }
+    auto consumer_id = m_buffer_pool->attach_fanout_consumer();
+    CHECK_EXPECTED_AS_STATUS(consumer_id);
+    m_fanout_consumer_id = consumer_id.release();
+    m_fanout_consumer_pid = current_pid;
+    return HAILO_SUCCESS;
+}
+
 hailo_status RemoteProcessOutputStream::read_impl(MemoryView buffer)
 {
+    if (m_buffer_pool->is_fanout_mode()) {
+        // Every attached process reads every frame through its own cursor; the slot returns to
+        // the hw queue once the slowest live consumer released it
+        auto status = ensure_fanout_consumer();
+        CHECK_SUCCESS(status);
+
+        auto read_buffer = m_buffer_pool->dequeue_host_buffer(m_fanout_consumer_id, m_timeout);
+        if (HAILO_STREAM_ABORTED_BY_USER == read_buffer.status()) {
+            return HAILO_STREAM_ABORTED_BY_USER;
+        }
+        CHECK_EXPECTED_AS_STATUS(read_buffer);
+
+        CHECK(read_buffer->buffer.size() == buffer.size(), HAILO_INTERNAL_FAILURE, "Invalid buffer size");
+        memcpy(buffer.data(), read_buffer->buffer.data(), buffer.size());
+
+        return m_buffer_pool->release_fanout_buffer(m_fanout_consumer_id);
+    }
+
     auto read_buffer = m_buffer_pool->dequeue_host_buffer(m_timeout);
     if (HAILO_STREAM_ABORTED_BY_USER == read_buffer.status()) {
         return HAILO_STREAM_ABORTED_BY_USER;
@@ -15,6 +15,7 @@
 #include "common/fork_support.hpp"
 
 #include "stream_common/stream_internal.hpp"
+#include "stream_common/shared_ring_fanout.hpp"
 
 #include "common/utils.hpp"
 #include "common/circular_buffer.hpp"
@@ -52,6 +53,17 @@ public:
     hailo_status enqueue_host_buffer(SharedBuffer buffer);
     hailo_status wait_until_host_queue_full(std::chrono::milliseconds timeout);
 
+    // 1-to-N fan-out (D2H pools, opt-in via HAILO_STREAM_FANOUT_CONSUMERS > 1): every attached
+    // consumer process sees every published frame through a private cursor in the shared fan-out
+    // block; slots recycle back to the hw queue once the slowest live consumer passed them, and
+    // a consumer whose process died is reaped so it cannot stall the ring.
+    bool is_fanout_mode() const { return m_fanout_mode; }
+    Expected<uint32_t> attach_fanout_consumer();
+    void detach_fanout_consumer(uint32_t consumer_id);
+    Expected<SharedBuffer> dequeue_host_buffer(uint32_t consumer_id, std::chrono::milliseconds timeout);
+    // Releases the last frame returned to this consumer back towards the recycle watermark
+    hailo_status release_fanout_buffer(uint32_t consumer_id);
+
     void abort();
     void clear_abort();
 
@@ -95,10 +107,21 @@ private:
     // On output streams - buffers with data from the hw, ready to be read by the user
     BufferQueue m_host_buffers_queue;
 
+    // Must be called with m_mutex held - returns consumed fan-out slots to the hw queue
+    void reclaim_consumed_slots();
+
     RecursiveSharedMutex m_mutex;
     SharedConditionVariable m_cv;
 
     bool m_is_aborted;
+
+    // Fan-out state (see attach_fanout_consumer). The slot array mirrors the fan-out block's
+    // ring - everything lives in the shared mapping with the rest of this pool.
+    bool m_fanout_mode = false;
+    SharedRingFanout m_fanout;
+    std::array<SharedBuffer, ONGOING_TRANSFERS_SIZE> m_fanout_slots;
+    uint64_t m_reclaimed_cursor = 0;
+    size_t m_fanout_slots_count = 0;
 };
 
 
@@ -184,6 +207,9 @@ protected:
 
     void run_read_thread();
     hailo_status read_single_buffer();
+    // Fan-out mode - resolves this process' consumer id, re-attaching after a fork (the cached id
+    // belongs to the parent)
+    hailo_status ensure_fanout_consumer();
 
     std::shared_ptr<OutputStreamBase> m_base_stream;
     std::chrono::milliseconds m_timeout;
@@ -191,6 +217,10 @@ protected:
     // Runs on parent, execute reads
     std::thread m_read_thread;
 
+    // Fan-out consumer identity, process local (each forked process attaches its own cursor)
+    uint32_t m_fanout_consumer_id = SharedRingFanout::INVALID_CONSUMER_ID;
+    uint32_t m_fanout_consumer_pid = 0;
+
     std::unique_ptr<RemoteProcessBufferPool> m_buffer_pool;
 
     WaitOrShutdown m_wait_for_activation;
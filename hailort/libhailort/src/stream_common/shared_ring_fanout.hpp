@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file shared_ring_fanout.hpp
+ * @brief 1-to-N fan-out control block for a ring of frame slots living in shared memory.
+ *        One producer publishes slots; up to MAX_CONSUMERS read-only consumers each advance a
+ *        private read cursor. Slot recycling is gated by the minimum cursor over the live
+ *        consumers (watermark), and each consumer carries a liveness epoch it bumps on every
+ *        ring operation - the producer snapshots the epochs and reaps consumers whose epoch did
+ *        not move, so a dead consumer process cannot stall the ring. The struct is trivially
+ *        placeable in a shared mapping (fixed layout, std::atomic only); the frame payload ring
+ *        itself is laid out by the owning pool, this block only runs the cursor/recycle logic.
+ **/
+
+#ifndef _HAILO_SHARED_RING_FANOUT_HPP_
+#define _HAILO_SHARED_RING_FANOUT_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+namespace hailort
+{
+
+class SharedRingFanout final
+{
+public:
+    static const uint32_t MAX_CONSUMERS = 8;
+    static const uint32_t INVALID_CONSUMER_ID = UINT32_MAX;
+
+    // Producer side, called once on the freshly mapped (zeroed) block
+    void init(uint64_t slots_count)
+    {
+        m_slots_count = slots_count;
+        m_write_cursor.store(0, std::memory_order_relaxed);
+        for (auto &consumer : m_consumers) {
+            consumer.is_active.store(false, std::memory_order_relaxed);
+            consumer.cursor.store(0, std::memory_order_relaxed);
+            consumer.epoch.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Attaches a consumer starting at the current head (it sees only frames published after the
+    // attach). Returns INVALID_CONSUMER_ID when all slots are taken.
+    uint32_t register_consumer()
+    {
+        for (uint32_t consumer_id = 0; consumer_id < MAX_CONSUMERS; consumer_id++) {
+            auto &consumer = m_consumers[consumer_id];
+            bool inactive = false;
+            if (consumer.is_active.compare_exchange_strong(inactive, true)) {
+                consumer.cursor.store(m_write_cursor.load(std::memory_order_acquire),
+                    std::memory_order_release);
+                consumer.epoch.fetch_add(1, std::memory_order_relaxed);
+                return consumer_id;
+            }
+            inactive = false;
+        }
+        return INVALID_CONSUMER_ID;
+    }
+
+    void unregister_consumer(uint32_t consumer_id)
+    {
+        m_consumers[consumer_id].is_active.store(false, std::memory_order_release);
+    }
+
+    // Producer: slot index to write next, or false when the ring is full against the watermark
+    // (the slowest live consumer still owns the would-be-recycled slot)
+    bool try_begin_write(uint64_t &slot)
+    {
+        const auto write_cursor = m_write_cursor.load(std::memory_order_relaxed);
+        if ((write_cursor - min_live_cursor(write_cursor)) >= m_slots_count) {
+            return false;
+        }
+        slot = write_cursor % m_slots_count;
+        return true;
+    }
+
+    // Producer: publishes the slot prepared by try_begin_write
+    void commit_write()
+    {
+        m_write_cursor.fetch_add(1, std::memory_order_release);
+    }
+
+    // Consumer: slot index to read next, or false when no frame is pending for this consumer
+    bool try_read(uint32_t consumer_id, uint64_t &slot)
+    {
+        auto &consumer = m_consumers[consumer_id];
+        consumer.epoch.fetch_add(1, std::memory_order_relaxed);
+        const auto cursor = consumer.cursor.load(std::memory_order_relaxed);
+        if (cursor >= m_write_cursor.load(std::memory_order_acquire)) {
+            return false;
+        }
+        slot = cursor % m_slots_count;
+        return true;
+    }
+
+    // Consumer: releases the slot returned by try_read back towards the watermark
+    void advance(uint32_t consumer_id)
+    {
+        auto &consumer = m_consumers[consumer_id];
+        consumer.epoch.fetch_add(1, std::memory_order_relaxed);
+        consumer.cursor.fetch_add(1, std::memory_order_release);
+    }
+
+    // Producer-side liveness reaping, driven by the owner's timeout policy: snapshot_epochs()
+    // when the ring first appears stalled, and reap_unchanged() with that snapshot once the
+    // owner's grace period elapsed - consumers whose epoch did not move in between are considered
+    // dead (their process stopped polling) and are detached, unblocking the watermark.
+    void snapshot_epochs(uint64_t (&snapshot)[MAX_CONSUMERS]) const
+    {
+        for (uint32_t consumer_id = 0; consumer_id < MAX_CONSUMERS; consumer_id++) {
+            snapshot[consumer_id] = m_consumers[consumer_id].epoch.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Returns the number of consumers reaped. Only consumers that are behind the head are
+    // candidates - an idle consumer parked at the head has nothing to poll and must not be
+    // reaped for a quiet epoch.
+    uint32_t reap_unchanged(const uint64_t (&snapshot)[MAX_CONSUMERS])
+    {
+        uint32_t reaped_count = 0;
+        const auto write_cursor = m_write_cursor.load(std::memory_order_acquire);
+        for (uint32_t consumer_id = 0; consumer_id < MAX_CONSUMERS; consumer_id++) {
+            auto &consumer = m_consumers[consumer_id];
+            if (consumer.is_active.load(std::memory_order_acquire) &&
+                (consumer.cursor.load(std::memory_order_acquire) < write_cursor) &&
+                (consumer.epoch.load(std::memory_order_relaxed) == snapshot[consumer_id])) {
+                consumer.is_active.store(false, std::memory_order_release);
+                reaped_count++;
+            }
+        }
+        return reaped_count;
+    }
+
+    // The recycle watermark - every slot before it has been consumed by all live consumers and
+    // may be reclaimed by the owner
+    uint64_t consumed_watermark() const
+    {
+        return min_live_cursor(m_write_cursor.load(std::memory_order_acquire));
+    }
+
+private:
+    struct Consumer {
+        std::atomic<bool> is_active;
+        std::atomic<uint64_t> cursor;
+        // Bumped on every ring operation - a stuck epoch marks a dead consumer process
+        std::atomic<uint64_t> epoch;
+    };
+
+    // Watermark - the minimum cursor over live consumers. With no consumer attached the producer
+    // runs freely (frames published into the void, matching a fan-out with nobody listening).
+    uint64_t min_live_cursor(uint64_t write_cursor) const
+    {
+        uint64_t min_cursor = write_cursor;
+        for (const auto &consumer : m_consumers) {
+            if (consumer.is_active.load(std::memory_order_acquire)) {
+                const auto cursor = consumer.cursor.load(std::memory_order_acquire);
+                if (cursor < min_cursor) {
+                    min_cursor = cursor;
+                }
+            }
+        }
+        return min_cursor;
+    }
+
+    uint64_t m_slots_count;
+    std::atomic<uint64_t> m_write_cursor;
+    Consumer m_consumers[MAX_CONSUMERS];
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SHARED_RING_FANOUT_HPP_ */
@@ -8,6 +8,7 @@
  **/
 
 #include "hailo/stream.hpp"
+#include "common/os_utils.hpp"
 #include "hailo/hailort.h"
 #include "hailo/hailort_common.hpp"
 #include "hailo/transform.hpp"
@@ -18,6 +19,39 @@
 namespace hailort
 {
 
+InputStream::BufferConstraints InputStream::get_buffer_constraints() const
+{
+    // The DMA-able alignment covers every current transport; streams with stricter needs override
+    return BufferConstraints{OsUtils::get_dma_able_alignment(), get_frame_size()};
+}
+
+hailo_status InputStream::write_v(const std::vector<MemoryView> &planes)
+{
+    CHECK(!planes.empty(), HAILO_INVALID_ARGUMENT, "write_v requires at least one plane");
+
+    size_t total_size = 0;
+    for (const auto &plane : planes) {
+        total_size += plane.size();
+    }
+    CHECK(total_size == get_frame_size(), HAILO_INVALID_ARGUMENT,
+        "write_v total size must be {}. passed size - {}", get_frame_size(), total_size);
+
+    if (1 == planes.size()) {
+        return write(planes[0]);
+    }
+
+    // Generic fallback - gather the planes into one frame. Stream implementations with an owning
+    // buffer pool override this and gather straight into the DMA buffer.
+    auto gathered = Buffer::create(total_size);
+    CHECK_EXPECTED_AS_STATUS(gathered);
+    size_t offset = 0;
+    for (const auto &plane : planes) {
+        memcpy(gathered->data() + offset, plane.data(), plane.size());
+        offset += plane.size();
+    }
+    return write(MemoryView(gathered.value()));
+}
+
 hailo_status InputStream::flush()
 {
     return HAILO_SUCCESS;
@@ -49,6 +83,12 @@ EventPtr &InputStream::get_network_group_activated_event()
     return get_core_op_activated_event();
 }
 
+OutputStream::BufferConstraints OutputStream::get_buffer_constraints() const
+{
+    // The DMA-able alignment covers every current transport; streams with stricter needs override
+    return BufferConstraints{OsUtils::get_dma_able_alignment(), get_frame_size()};
+}
+
 hailo_status OutputStream::wait_for_async_ready(size_t /* transfer_size */, std::chrono::milliseconds /* timeout */)
 {
     LOGGER__ERROR("wait_for_async_ready not implemented for sync API");
@@ -10,6 +10,10 @@
 #include "vdma/memory/mapped_buffer.hpp"
 #include "vdma/vdma_device.hpp"
 
+#include "common/fast_copy.hpp"
+
+#include <algorithm>
+
 namespace hailort
 {
 
@@ -63,10 +67,32 @@ hailo_status TransferBuffer::copy_from(const MemoryView buffer)
     CHECK(buffer.size() == m_size, HAILO_INTERNAL_FAILURE, "buffer size {} must be {}", buffer.size(), m_size);
 
     auto continuous_parts = get_continuous_parts();
-    memcpy(continuous_parts.first.data(), buffer.data(), continuous_parts.first.size());
+    // The destination is a DMA buffer the CPU won't re-read - bypass the cache for large frames
+    copy_no_reread(continuous_parts.first.data(), buffer.data(), continuous_parts.first.size());
     if (!continuous_parts.second.empty()) {
         const size_t src_offset = continuous_parts.first.size();
-        memcpy(continuous_parts.second.data(), buffer.data() + src_offset, continuous_parts.second.size());
+        copy_no_reread(continuous_parts.second.data(), buffer.data() + src_offset, continuous_parts.second.size());
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status TransferBuffer::copy_from_offset(const MemoryView buffer, size_t dst_offset)
+{
+    CHECK((dst_offset + buffer.size()) <= m_size, HAILO_INTERNAL_FAILURE,
+        "copy of {} bytes at offset {} exceeds transfer buffer size {}", buffer.size(), dst_offset, m_size);
+
+    auto continuous_parts = get_continuous_parts();
+    size_t copied = 0;
+    if (dst_offset < continuous_parts.first.size()) {
+        copied = std::min(buffer.size(), continuous_parts.first.size() - dst_offset);
+        memcpy(continuous_parts.first.data() + dst_offset, buffer.data(), copied);
+    }
+    if (copied < buffer.size()) {
+        const auto second_part_offset = (dst_offset > continuous_parts.first.size()) ?
+            (dst_offset - continuous_parts.first.size()) : 0;
+        memcpy(continuous_parts.second.data() + second_part_offset, buffer.data() + copied,
+            buffer.size() - copied);
     }
 
     return HAILO_SUCCESS;
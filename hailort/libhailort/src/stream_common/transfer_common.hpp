@@ -37,6 +37,9 @@ public:
 
     hailo_status copy_to(MemoryView buffer);
     hailo_status copy_from(const MemoryView buffer);
+    // Copies @a buffer into this transfer buffer starting at @a dst_offset (scatter-write gather),
+    // handling a wrap-around layout like copy_from
+    hailo_status copy_from_offset(const MemoryView buffer, size_t dst_offset);
 
     // Sync the buffer to the given direction, fails if the buffer is not mapped.
     hailo_status synchronize(VdmaDevice &device, HailoRTDriver::DmaSyncDirection sync_direction);
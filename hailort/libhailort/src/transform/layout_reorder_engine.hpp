@@ -0,0 +1,290 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file layout_reorder_engine.hpp
+ * @brief Cache-blocked, SIMD-shuffled transpose kernels used by the frame layout reorder
+ *        transformations (NHCW<->NHWC and friends). The engine works on one H-row at a time -
+ *        every row is a features x width matrix transpose, tiled into 8x8 blocks so both the
+ *        scattered reads and the scattered writes stay inside the cache lines of a single tile.
+ **/
+
+#ifndef _HAILO_LAYOUT_REORDER_ENGINE_HPP_
+#define _HAILO_LAYOUT_REORDER_ENGINE_HPP_
+
+#include "hailo/hailort.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define HAILO_REORDER_SIMD_X86
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define HAILO_REORDER_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace hailort
+{
+namespace reorder_engine
+{
+
+constexpr size_t TILE_DIM = 8;
+
+// Scalar tile transpose - edge tiles and dtypes without a shuffle kernel
+template <typename T>
+inline void transpose_tile_scalar(const T *src, size_t src_stride, T *dst, size_t dst_stride,
+    size_t rows, size_t cols)
+{
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t c = 0; c < cols; c++) {
+            dst[c * dst_stride + r] = src[r * src_stride + c];
+        }
+    }
+}
+
+#ifdef HAILO_REORDER_SIMD_X86
+
+// Full 8x8 uint8 tile transpose with SSE2 unpack shuffles (SSE2 is baseline on x86-64)
+inline void transpose_tile_8x8(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+{
+    const __m128i r0 = _mm_loadl_epi64((const __m128i *)(src + 0 * src_stride));
+    const __m128i r1 = _mm_loadl_epi64((const __m128i *)(src + 1 * src_stride));
+    const __m128i r2 = _mm_loadl_epi64((const __m128i *)(src + 2 * src_stride));
+    const __m128i r3 = _mm_loadl_epi64((const __m128i *)(src + 3 * src_stride));
+    const __m128i r4 = _mm_loadl_epi64((const __m128i *)(src + 4 * src_stride));
+    const __m128i r5 = _mm_loadl_epi64((const __m128i *)(src + 5 * src_stride));
+    const __m128i r6 = _mm_loadl_epi64((const __m128i *)(src + 6 * src_stride));
+    const __m128i r7 = _mm_loadl_epi64((const __m128i *)(src + 7 * src_stride));
+
+    const __m128i t0 = _mm_unpacklo_epi8(r0, r1);
+    const __m128i t1 = _mm_unpacklo_epi8(r2, r3);
+    const __m128i t2 = _mm_unpacklo_epi8(r4, r5);
+    const __m128i t3 = _mm_unpacklo_epi8(r6, r7);
+
+    const __m128i u0 = _mm_unpacklo_epi16(t0, t1);
+    const __m128i u1 = _mm_unpackhi_epi16(t0, t1);
+    const __m128i u2 = _mm_unpacklo_epi16(t2, t3);
+    const __m128i u3 = _mm_unpackhi_epi16(t2, t3);
+
+    // Each v holds two transposed columns (8 bytes each)
+    const __m128i v0 = _mm_unpacklo_epi32(u0, u2);
+    const __m128i v1 = _mm_unpackhi_epi32(u0, u2);
+    const __m128i v2 = _mm_unpacklo_epi32(u1, u3);
+    const __m128i v3 = _mm_unpackhi_epi32(u1, u3);
+
+    _mm_storel_epi64((__m128i *)(dst + 0 * dst_stride), v0);
+    _mm_storel_epi64((__m128i *)(dst + 1 * dst_stride), _mm_unpackhi_epi64(v0, v0));
+    _mm_storel_epi64((__m128i *)(dst + 2 * dst_stride), v1);
+    _mm_storel_epi64((__m128i *)(dst + 3 * dst_stride), _mm_unpackhi_epi64(v1, v1));
+    _mm_storel_epi64((__m128i *)(dst + 4 * dst_stride), v2);
+    _mm_storel_epi64((__m128i *)(dst + 5 * dst_stride), _mm_unpackhi_epi64(v2, v2));
+    _mm_storel_epi64((__m128i *)(dst + 6 * dst_stride), v3);
+    _mm_storel_epi64((__m128i *)(dst + 7 * dst_stride), _mm_unpackhi_epi64(v3, v3));
+}
+
+// Full 8x8 uint16 tile transpose with SSE2 unpack shuffles
+inline void transpose_tile_8x8(const uint16_t *src, size_t src_stride, uint16_t *dst, size_t dst_stride)
+{
+    const __m128i r0 = _mm_loadu_si128((const __m128i *)(src + 0 * src_stride));
+    const __m128i r1 = _mm_loadu_si128((const __m128i *)(src + 1 * src_stride));
+    const __m128i r2 = _mm_loadu_si128((const __m128i *)(src + 2 * src_stride));
+    const __m128i r3 = _mm_loadu_si128((const __m128i *)(src + 3 * src_stride));
+    const __m128i r4 = _mm_loadu_si128((const __m128i *)(src + 4 * src_stride));
+    const __m128i r5 = _mm_loadu_si128((const __m128i *)(src + 5 * src_stride));
+    const __m128i r6 = _mm_loadu_si128((const __m128i *)(src + 6 * src_stride));
+    const __m128i r7 = _mm_loadu_si128((const __m128i *)(src + 7 * src_stride));
+
+    const __m128i t0 = _mm_unpacklo_epi16(r0, r1);
+    const __m128i t1 = _mm_unpackhi_epi16(r0, r1);
+    const __m128i t2 = _mm_unpacklo_epi16(r2, r3);
+    const __m128i t3 = _mm_unpackhi_epi16(r2, r3);
+    const __m128i t4 = _mm_unpacklo_epi16(r4, r5);
+    const __m128i t5 = _mm_unpackhi_epi16(r4, r5);
+    const __m128i t6 = _mm_unpacklo_epi16(r6, r7);
+    const __m128i t7 = _mm_unpackhi_epi16(r6, r7);
+
+    const __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+    const __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+    const __m128i u2 = _mm_unpacklo_epi32(t1, t3);
+    const __m128i u3 = _mm_unpackhi_epi32(t1, t3);
+    const __m128i u4 = _mm_unpacklo_epi32(t4, t6);
+    const __m128i u5 = _mm_unpackhi_epi32(t4, t6);
+    const __m128i u6 = _mm_unpacklo_epi32(t5, t7);
+    const __m128i u7 = _mm_unpackhi_epi32(t5, t7);
+
+    _mm_storeu_si128((__m128i *)(dst + 0 * dst_stride), _mm_unpacklo_epi64(u0, u4));
+    _mm_storeu_si128((__m128i *)(dst + 1 * dst_stride), _mm_unpackhi_epi64(u0, u4));
+    _mm_storeu_si128((__m128i *)(dst + 2 * dst_stride), _mm_unpacklo_epi64(u1, u5));
+    _mm_storeu_si128((__m128i *)(dst + 3 * dst_stride), _mm_unpackhi_epi64(u1, u5));
+    _mm_storeu_si128((__m128i *)(dst + 4 * dst_stride), _mm_unpacklo_epi64(u2, u6));
+    _mm_storeu_si128((__m128i *)(dst + 5 * dst_stride), _mm_unpackhi_epi64(u2, u6));
+    _mm_storeu_si128((__m128i *)(dst + 6 * dst_stride), _mm_unpacklo_epi64(u3, u7));
+    _mm_storeu_si128((__m128i *)(dst + 7 * dst_stride), _mm_unpackhi_epi64(u3, u7));
+}
+
+#elif defined(HAILO_REORDER_SIMD_NEON)
+
+// Full 8x8 uint8 tile transpose with NEON vtrn shuffles
+inline void transpose_tile_8x8(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+{
+    uint8x8_t r0 = vld1_u8(src + 0 * src_stride);
+    uint8x8_t r1 = vld1_u8(src + 1 * src_stride);
+    uint8x8_t r2 = vld1_u8(src + 2 * src_stride);
+    uint8x8_t r3 = vld1_u8(src + 3 * src_stride);
+    uint8x8_t r4 = vld1_u8(src + 4 * src_stride);
+    uint8x8_t r5 = vld1_u8(src + 5 * src_stride);
+    uint8x8_t r6 = vld1_u8(src + 6 * src_stride);
+    uint8x8_t r7 = vld1_u8(src + 7 * src_stride);
+
+    const uint8x8x2_t p01 = vtrn_u8(r0, r1);
+    const uint8x8x2_t p23 = vtrn_u8(r2, r3);
+    const uint8x8x2_t p45 = vtrn_u8(r4, r5);
+    const uint8x8x2_t p67 = vtrn_u8(r6, r7);
+
+    const uint16x4x2_t q02 = vtrn_u16(vreinterpret_u16_u8(p01.val[0]), vreinterpret_u16_u8(p23.val[0]));
+    const uint16x4x2_t q13 = vtrn_u16(vreinterpret_u16_u8(p01.val[1]), vreinterpret_u16_u8(p23.val[1]));
+    const uint16x4x2_t q46 = vtrn_u16(vreinterpret_u16_u8(p45.val[0]), vreinterpret_u16_u8(p67.val[0]));
+    const uint16x4x2_t q57 = vtrn_u16(vreinterpret_u16_u8(p45.val[1]), vreinterpret_u16_u8(p67.val[1]));
+
+    const uint32x2x2_t w04 = vtrn_u32(vreinterpret_u32_u16(q02.val[0]), vreinterpret_u32_u16(q46.val[0]));
+    const uint32x2x2_t w15 = vtrn_u32(vreinterpret_u32_u16(q13.val[0]), vreinterpret_u32_u16(q57.val[0]));
+    const uint32x2x2_t w26 = vtrn_u32(vreinterpret_u32_u16(q02.val[1]), vreinterpret_u32_u16(q46.val[1]));
+    const uint32x2x2_t w37 = vtrn_u32(vreinterpret_u32_u16(q13.val[1]), vreinterpret_u32_u16(q57.val[1]));
+
+    vst1_u8(dst + 0 * dst_stride, vreinterpret_u8_u32(w04.val[0]));
+    vst1_u8(dst + 1 * dst_stride, vreinterpret_u8_u32(w15.val[0]));
+    vst1_u8(dst + 2 * dst_stride, vreinterpret_u8_u32(w26.val[0]));
+    vst1_u8(dst + 3 * dst_stride, vreinterpret_u8_u32(w37.val[0]));
+    vst1_u8(dst + 4 * dst_stride, vreinterpret_u8_u32(w04.val[1]));
+    vst1_u8(dst + 5 * dst_stride, vreinterpret_u8_u32(w15.val[1]));
+    vst1_u8(dst + 6 * dst_stride, vreinterpret_u8_u32(w26.val[1]));
+    vst1_u8(dst + 7 * dst_stride, vreinterpret_u8_u32(w37.val[1]));
+}
+
+// Full 8x8 uint16 tile transpose with NEON vtrn shuffles
+inline void transpose_tile_8x8(const uint16_t *src, size_t src_stride, uint16_t *dst, size_t dst_stride)
+{
+    uint16x8_t r0 = vld1q_u16(src + 0 * src_stride);
+    uint16x8_t r1 = vld1q_u16(src + 1 * src_stride);
+    uint16x8_t r2 = vld1q_u16(src + 2 * src_stride);
+    uint16x8_t r3 = vld1q_u16(src + 3 * src_stride);
+    uint16x8_t r4 = vld1q_u16(src + 4 * src_stride);
+    uint16x8_t r5 = vld1q_u16(src + 5 * src_stride);
+    uint16x8_t r6 = vld1q_u16(src + 6 * src_stride);
+    uint16x8_t r7 = vld1q_u16(src + 7 * src_stride);
+
+    const uint16x8x2_t p01 = vtrnq_u16(r0, r1);
+    const uint16x8x2_t p23 = vtrnq_u16(r2, r3);
+    const uint16x8x2_t p45 = vtrnq_u16(r4, r5);
+    const uint16x8x2_t p67 = vtrnq_u16(r6, r7);
+
+    const uint32x4x2_t q02 = vtrnq_u32(vreinterpretq_u32_u16(p01.val[0]), vreinterpretq_u32_u16(p23.val[0]));
+    const uint32x4x2_t q13 = vtrnq_u32(vreinterpretq_u32_u16(p01.val[1]), vreinterpretq_u32_u16(p23.val[1]));
+    const uint32x4x2_t q46 = vtrnq_u32(vreinterpretq_u32_u16(p45.val[0]), vreinterpretq_u32_u16(p67.val[0]));
+    const uint32x4x2_t q57 = vtrnq_u32(vreinterpretq_u32_u16(p45.val[1]), vreinterpretq_u32_u16(p67.val[1]));
+
+    // Combine the 64-bit halves of matching quads into the transposed output rows
+    vst1q_u16(dst + 0 * dst_stride, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(q02.val[0]), vget_low_u32(q46.val[0]))));
+    vst1q_u16(dst + 1 * dst_stride, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(q13.val[0]), vget_low_u32(q57.val[0]))));
+    vst1q_u16(dst + 2 * dst_stride, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(q02.val[1]), vget_low_u32(q46.val[1]))));
+    vst1q_u16(dst + 3 * dst_stride, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(q13.val[1]), vget_low_u32(q57.val[1]))));
+    vst1q_u16(dst + 4 * dst_stride, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(q02.val[0]), vget_high_u32(q46.val[0]))));
+    vst1q_u16(dst + 5 * dst_stride, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(q13.val[0]), vget_high_u32(q57.val[0]))));
+    vst1q_u16(dst + 6 * dst_stride, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(q02.val[1]), vget_high_u32(q46.val[1]))));
+    vst1q_u16(dst + 7 * dst_stride, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(q13.val[1]), vget_high_u32(q57.val[1]))));
+}
+
+#endif
+
+#if defined(HAILO_REORDER_SIMD_X86) || defined(HAILO_REORDER_SIMD_NEON)
+
+template <typename T>
+inline void transpose_tile_full(const T *src, size_t src_stride, T *dst, size_t dst_stride)
+{
+    transpose_tile_8x8(src, src_stride, dst, dst_stride);
+}
+
+// float32 (and other widths) have no shuffle kernel - the blocked scalar tile is still cache friendly
+inline void transpose_tile_full(const float32_t *src, size_t src_stride, float32_t *dst, size_t dst_stride)
+{
+    transpose_tile_scalar(src, src_stride, dst, dst_stride, TILE_DIM, TILE_DIM);
+}
+
+#else
+
+template <typename T>
+inline void transpose_tile_full(const T *src, size_t src_stride, T *dst, size_t dst_stride)
+{
+    transpose_tile_scalar(src, src_stride, dst, dst_stride, TILE_DIM, TILE_DIM);
+}
+
+#endif
+
+/**
+ * Transpose a rows x cols matrix (src, row stride @a src_stride) into dst (row stride @a dst_stride),
+ * 8x8 tiles on the fast path, scalar tiles on the edges.
+ */
+template <typename T>
+inline void transpose_blocked(const T *src, size_t src_stride, T *dst, size_t dst_stride,
+    size_t rows, size_t cols)
+{
+    const size_t full_rows = rows - (rows % TILE_DIM);
+    const size_t full_cols = cols - (cols % TILE_DIM);
+
+    for (size_t r = 0; r < full_rows; r += TILE_DIM) {
+        for (size_t c = 0; c < full_cols; c += TILE_DIM) {
+            transpose_tile_full(src + r * src_stride + c, src_stride, dst + c * dst_stride + r, dst_stride);
+        }
+        if (full_cols < cols) {
+            transpose_tile_scalar(src + r * src_stride + full_cols, src_stride,
+                dst + full_cols * dst_stride + r, dst_stride, TILE_DIM, cols - full_cols);
+        }
+    }
+    if (full_rows < rows) {
+        transpose_tile_scalar(src + full_rows * src_stride, src_stride, dst + full_rows, dst_stride,
+            rows - full_rows, cols);
+    }
+}
+
+/**
+ * One H-row of an NHCW->NHWC reorder: the src row is a features x width matrix (feature-major,
+ * row stride @a src_width which may contain padding), the dst row is width x features.
+ */
+template <typename T>
+inline void nhcw_row_to_nhwc(const T *src_row, uint32_t features, uint32_t src_width, uint32_t dst_width,
+    T *dst_row)
+{
+    transpose_blocked(src_row, src_width, dst_row, features, features, dst_width);
+}
+
+/**
+ * Fused single-pass NHCW->NHWC reorder + dequantize of one H-row: the transpose's store phase
+ * converts straight to dequantized float32, so the frame is walked once instead of a reorder pass
+ * followed by an in-place dequantize pass. Cache-blocked like transpose_blocked.
+ */
+template <typename Q>
+inline void nhcw_row_to_nhwc_dequantize(const Q *src_row, uint32_t features, uint32_t src_width,
+    uint32_t dst_width, float32_t *dst_row, float32_t qp_zp, float32_t qp_scale)
+{
+    for (uint32_t f0 = 0; f0 < features; f0 += TILE_DIM) {
+        const uint32_t f_end = (f0 + TILE_DIM < features) ? static_cast<uint32_t>(f0 + TILE_DIM) : features;
+        for (uint32_t w0 = 0; w0 < dst_width; w0 += TILE_DIM) {
+            const uint32_t w_end = (w0 + TILE_DIM < dst_width) ? static_cast<uint32_t>(w0 + TILE_DIM) : dst_width;
+            for (uint32_t f = f0; f < f_end; f++) {
+                const Q *src_channel = src_row + (static_cast<size_t>(f) * src_width);
+                for (uint32_t w = w0; w < w_end; w++) {
+                    dst_row[(static_cast<size_t>(w) * features) + f] =
+                        (static_cast<float32_t>(src_channel[w]) - qp_zp) * qp_scale;
+                }
+            }
+        }
+    }
+}
+
+} /* namespace reorder_engine */
+} /* namespace hailort */
+
+#endif /* _HAILO_LAYOUT_REORDER_ENGINE_HPP_ */
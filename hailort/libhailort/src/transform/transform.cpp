@@ -20,7 +20,12 @@
 #include "common/utils.hpp"
 
 #include "transform/transform_internal.hpp"
+#include "transform/layout_reorder_engine.hpp"
+#include "transform/transform_thread_pool.hpp"
 
+#include <atomic>
+
+#include <algorithm>
 #include <type_traits>
 #include <sstream>
 
@@ -445,19 +450,13 @@ void transform__d2h_NHCW_to_NHWC(const T *src_ptr, hailo_3d_image_shape_t *src_i
     ASSERT(NULL != src_ptr);
     ASSERT(NULL != dst_ptr);
 
-    /* transpose - switch channels and width, ignore padded elements */
+    /* transpose - switch channels and width, ignore padded elements. Every H-row is a
+       features x width matrix transpose, done in cache-blocked SIMD tiles by the reorder engine */
     const auto row_size_src = src_image_shape->width * src_image_shape->features;
     const auto row_size_dest = dst_image_shape->width * dst_image_shape->features;
     for (uint32_t r = 0; r < dst_image_shape->height ; r++) {
-        const auto row_offset_src = r * row_size_src;
-        const auto row_offset_dest = r * row_size_dest;
-        for (uint32_t c = 0; c < dst_image_shape->width; c++) {
-            const auto src_offset = row_offset_src + c;
-            const auto dest_offset = row_offset_dest + c * dst_image_shape->features;
-            for (uint32_t f = 0; f < dst_image_shape->features; f++) {
-                dst_ptr[dest_offset + f] = src_ptr[src_offset + f * src_image_shape->width];
-            }
-        }
+        reorder_engine::nhcw_row_to_nhwc(src_ptr + r * row_size_src, dst_image_shape->features,
+            src_image_shape->width, dst_image_shape->width, dst_ptr + r * row_size_dest);
     }
 }
 
@@ -929,14 +928,14 @@ hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
                     if (m_are_all_qps_the_same) {
                         Quantization::dequantize_output_buffer_in_place<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size, m_dst_quant_infos[0]);
                     } else {
-                        dequantize_output_by_feature<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+                        dequantize_output_by_feature<float32_t, uint8_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature.get(), m_quant_infos_rep_count);
                     }
                 }
                 else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
                     if (m_are_all_qps_the_same) {
                         Quantization::dequantize_output_buffer_in_place<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size, m_dst_quant_infos[0]);
                     } else {
-                        dequantize_output_by_feature<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+                        dequantize_output_by_feature<float32_t, uint16_t>((float32_t*)dst_ptr, shape_size, m_quant_info_per_feature.get(), m_quant_infos_rep_count);
                     }
                 }
                 else {
@@ -962,6 +961,56 @@ hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
     return HAILO_SUCCESS;
 }
 
+// BT.601 integer (fixed point, 8 fractional bits) YUV->RGB conversion helpers. The conversion is
+// fused into the input reorder stage, so camera pipelines don't need an external full-frame
+// color-space pass before the library.
+static inline void yuv_to_rgb_pixel(int32_t y, int32_t u, int32_t v, uint8_t *rgb_out)
+{
+    const int32_t c = y - 16;
+    const int32_t d = u - 128;
+    const int32_t e = v - 128;
+    const int32_t r = ((298 * c) + (409 * e) + 128) >> 8;
+    const int32_t g = ((298 * c) - (100 * d) - (208 * e) + 128) >> 8;
+    const int32_t b = ((298 * c) + (516 * d) + 128) >> 8;
+    rgb_out[0] = static_cast<uint8_t>(Quantization::clip(static_cast<float32_t>(r), 0, 255));
+    rgb_out[1] = static_cast<uint8_t>(Quantization::clip(static_cast<float32_t>(g), 0, 255));
+    rgb_out[2] = static_cast<uint8_t>(Quantization::clip(static_cast<float32_t>(b), 0, 255));
+}
+
+// NV12 (Y plane followed by interleaved UV at half resolution) -> packed RGB (NHWC, 3 features)
+static void transform__h2d_NV12_to_RGB(const uint8_t *src_ptr, const hailo_3d_image_shape_t &src_image_shape,
+    uint8_t *dst_ptr, const hailo_3d_image_shape_t &dst_image_shape)
+{
+    // src shape is the NV12 internal representation - the luma plane is (height, width)
+    const uint32_t height = dst_image_shape.height;
+    const uint32_t width = dst_image_shape.width;
+    const uint8_t *y_plane = src_ptr;
+    const uint8_t *uv_plane = src_ptr + (static_cast<size_t>(height) * width);
+    (void)src_image_shape;
+
+    for (uint32_t row = 0; row < height; row++) {
+        const uint8_t *y_row = y_plane + (static_cast<size_t>(row) * width);
+        const uint8_t *uv_row = uv_plane + (static_cast<size_t>(row / 2) * width);
+        uint8_t *dst_row = dst_ptr + (static_cast<size_t>(row) * width * RGB_FEATURES);
+        for (uint32_t col = 0; col < width; col++) {
+            const auto u = uv_row[(col / 2) * 2];
+            const auto v = uv_row[((col / 2) * 2) + 1];
+            yuv_to_rgb_pixel(y_row[col], u, v, dst_row + (static_cast<size_t>(col) * RGB_FEATURES));
+        }
+    }
+}
+
+// YUY2 (packed Y0 U Y1 V) -> packed RGB (NHWC, 3 features)
+static void transform__h2d_YUY2_to_RGB(const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t pixels_count)
+{
+    for (uint32_t pixel_pair = 0; pixel_pair < (pixels_count / 2); pixel_pair++) {
+        const uint8_t *src_pair = src_ptr + (static_cast<size_t>(pixel_pair) * 4);
+        uint8_t *dst_pair = dst_ptr + (static_cast<size_t>(pixel_pair) * 2 * RGB_FEATURES);
+        yuv_to_rgb_pixel(src_pair[0], src_pair[1], src_pair[3], dst_pair);
+        yuv_to_rgb_pixel(src_pair[2], src_pair[1], src_pair[3], dst_pair + RGB_FEATURES);
+    }
+}
+
 hailo_status reorder_input_stream(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, hailo_format_t src_format, 
     void *dst_ptr, hailo_3d_image_shape_t dst_image_shape, hailo_format_t dst_format)
 {
@@ -1127,6 +1176,27 @@ hailo_status reorder_input_stream(const void *src_ptr, hailo_3d_image_shape_t sr
         }
     }
 
+    if ((HAILO_FORMAT_ORDER_NV12 == src_format.order) &&
+        (HAILO_FORMAT_ORDER_NHWC == dst_format.order)) {
+        CHECK(HAILO_FORMAT_TYPE_UINT8 == src_format.type, HAILO_INVALID_ARGUMENT,
+            "NV12 to RGB conversion supports uint8 frames only");
+        CHECK(RGB_FEATURES == dst_image_shape.features, HAILO_INVALID_ARGUMENT,
+            "NV12 to RGB conversion expects {} output features", RGB_FEATURES);
+        transform__h2d_NV12_to_RGB((const uint8_t*)src_ptr, src_image_shape, (uint8_t*)dst_ptr, dst_image_shape);
+        return HAILO_SUCCESS;
+    }
+
+    if ((HAILO_FORMAT_ORDER_YUY2 == src_format.order) &&
+        (HAILO_FORMAT_ORDER_NHWC == dst_format.order)) {
+        CHECK(HAILO_FORMAT_TYPE_UINT8 == src_format.type, HAILO_INVALID_ARGUMENT,
+            "YUY2 to RGB conversion supports uint8 frames only");
+        CHECK(RGB_FEATURES == dst_image_shape.features, HAILO_INVALID_ARGUMENT,
+            "YUY2 to RGB conversion expects {} output features", RGB_FEATURES);
+        transform__h2d_YUY2_to_RGB((const uint8_t*)src_ptr, (uint8_t*)dst_ptr,
+            dst_image_shape.height * dst_image_shape.width);
+        return HAILO_SUCCESS;
+    }
+
     if ((HAILO_FORMAT_ORDER_YUY2 == src_format.order) &&
         (HAILO_FORMAT_ORDER_YUY2 == dst_format.order)) {
         auto shape_size = HailoRTCommon::get_shape_size(src_image_shape);
@@ -1468,8 +1538,11 @@ hailo_status FrameOutputTransformContext::transform_inner(const void *src_ptr, v
         } else {
             orig_dst_ptr = dst_ptr;
         }
-        auto status = reorder_output_stream(src_ptr, m_src_image_shape, m_src_format, orig_dst_ptr, transposed_image_shape, 
-            m_dst_format);
+        // The plan (when resolved) skips the per-frame order/type dispatch
+        auto status = (m_reorder_plan && !m_should_transpose) ?
+            m_reorder_plan(src_ptr, orig_dst_ptr) :
+            reorder_output_stream(src_ptr, m_src_image_shape, m_src_format, orig_dst_ptr, transposed_image_shape,
+                m_dst_format);
         CHECK_SUCCESS(status);
     }
 
@@ -1766,6 +1839,28 @@ hailo_status InputTransformContext::transform(const MemoryView src, MemoryView d
     return HAILO_SUCCESS;
 }
 
+bool InputTransformContext::is_identity() const
+{
+    return !(m_should_quantize || m_should_transpose || m_should_reorder || m_should_pad_periph);
+}
+
+hailo_status InputTransformContext::transform_batch(const MemoryView src, MemoryView dst, uint32_t batch_size)
+{
+    /* Check sizes once for the whole batch */
+    CHECK(src.size() == (m_src_frame_size * batch_size), HAILO_INVALID_ARGUMENT,
+        "src size must be {}. passed size - {}", (m_src_frame_size * batch_size), src.size());
+    CHECK(dst.size() == (m_dst_frame_size * batch_size), HAILO_INVALID_ARGUMENT,
+        "dst_size must be {}. passed size - {}", (m_dst_frame_size * batch_size), dst.size());
+
+    // The quantization and transpose scratch buffers are shared, so input frames run serially
+    for (uint32_t frame = 0; frame < batch_size; frame++) {
+        auto status = transform_inner(src.data() + (frame * m_src_frame_size),
+            quant_buffer().data(), dst.data() + (frame * m_dst_frame_size), transpose_buffer());
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
+}
+
 size_t InputTransformContext::get_src_frame_size() const
 {
     return m_src_frame_size;
@@ -1807,7 +1902,8 @@ bool OutputTransformContext::is_transformation_required(
 
 Expected<std::unique_ptr<OutputTransformContext>> OutputTransformContext::create(const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info)
+        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info,
+        uint32_t worker_threads_count)
 {
     auto status = validate_output_transform_params(src_image_shape, src_format, dst_image_shape, dst_format);
     CHECK_SUCCESS_AS_EXPECTED(status);
@@ -1821,7 +1917,8 @@ Expected<std::unique_ptr<OutputTransformContext>> OutputTransformContext::create
         return NMSOutputTransformContext::create(src_format, dst_format, dst_quant_infos, nms_info);
     }
 
-    return FrameOutputTransformContext::create(src_image_shape, src_format, dst_image_shape, dst_format, dst_quant_infos);
+    return FrameOutputTransformContext::create(src_image_shape, src_format, dst_image_shape, dst_format, dst_quant_infos,
+        worker_threads_count);
 }
 
 Expected<std::unique_ptr<OutputTransformContext>> OutputTransformContext::create(const hailo_3d_image_shape_t &src_image_shape,
@@ -1837,7 +1934,8 @@ Expected<std::unique_ptr<OutputTransformContext>> OutputTransformContext::create
 {
     std::vector<hailo_quant_info_t> quant_infos = { stream_info.quant_info };
     return create(stream_info.hw_shape, stream_info.format, stream_info.shape,
-        transform_params.user_buffer_format, quant_infos, stream_info.nms_info);
+        transform_params.user_buffer_format, quant_infos, stream_info.nms_info,
+        transform_params.transform_worker_threads_count);
 }
 
 Expected<std::unique_ptr<OutputTransformContext>> OutputTransformContext::create(const hailo_stream_info_t &stream_info, bool quantized,
@@ -1855,7 +1953,29 @@ Expected<std::unique_ptr<OutputTransformContext>> OutputTransformContext::create
     auto stream_info = output_stream.get_info();
     auto dst_quant_infos = output_stream.get_quant_infos();
     return create(stream_info.hw_shape, stream_info.format, stream_info.shape,
-        transform_params.user_buffer_format, dst_quant_infos, stream_info.nms_info);
+        transform_params.user_buffer_format, dst_quant_infos, stream_info.nms_info,
+        transform_params.transform_worker_threads_count);
+}
+
+bool OutputTransformContext::is_identity() const
+{
+    return !(m_should_quantize || m_should_transpose || m_should_reorder || m_should_pad_periph);
+}
+
+hailo_status OutputTransformContext::transform_batch(const MemoryView src, MemoryView dst, uint32_t batch_size)
+{
+    /* Check sizes once for the whole batch */
+    CHECK(src.size() == (m_src_frame_size * batch_size), HAILO_INVALID_ARGUMENT,
+        "src size must be {}. passed size - {}", (m_src_frame_size * batch_size), src.size());
+    CHECK(dst.size() == (m_dst_frame_size * batch_size), HAILO_INVALID_ARGUMENT,
+        "dst_size must be {}. passed size - {}", (m_dst_frame_size * batch_size), dst.size());
+
+    for (uint32_t frame = 0; frame < batch_size; frame++) {
+        auto status = transform(MemoryView(const_cast<uint8_t *>(src.data()) + (frame * m_src_frame_size), m_src_frame_size),
+            MemoryView(dst.data() + (frame * m_dst_frame_size), m_dst_frame_size));
+        CHECK_SUCCESS(status);
+    }
+    return HAILO_SUCCESS;
 }
 
 OutputTransformContext::OutputTransformContext(size_t src_frame_size, const hailo_format_t &src_format, size_t dst_frame_size,
@@ -1875,10 +1995,11 @@ OutputTransformContext::OutputTransformContext(size_t src_frame_size, const hail
 FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size, const hailo_3d_image_shape_t &src_image_shape,
     const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
     const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, Buffer&& transpose_buffer,
-    const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph) :
+    const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph,
+    uint32_t worker_threads_count) :
         OutputTransformContext(src_frame_size, src_format, dst_frame_size, dst_format, dst_quant_infos, should_quantize, 
             should_transpose, should_reorder, should_pad_periph), m_src_image_shape(src_image_shape), m_dst_image_shape(dst_image_shape), 
-            m_transpose_buffer(std::move(transpose_buffer))
+            m_worker_threads_count(worker_threads_count), m_transpose_buffer(std::move(transpose_buffer))
 {
     // TODO: Add verification that quant infos size equals to features count (HRT-11052)
 
@@ -1893,13 +2014,16 @@ FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size,
     }
     m_are_all_qps_the_same = are_all_qps_the_same;
 
+    build_transform_plan();
+
+    std::vector<QuantInfoForDequantize> quant_info_per_feature;
     switch (dst_format.order) {
     case HAILO_FORMAT_ORDER_NHW:
     case HAILO_FORMAT_ORDER_BAYER_RGB:
     case HAILO_FORMAT_ORDER_12_BIT_BAYER_RGB:
     case HAILO_FORMAT_ORDER_NCHW:
         for (const auto &quant_info : dst_quant_infos) {
-            m_quant_info_per_feature.emplace_back(quant_info.qp_zp, quant_info.qp_scale);
+            quant_info_per_feature.emplace_back(quant_info.qp_zp, quant_info.qp_scale);
         }
         m_quant_infos_rep_count = static_cast<uint32_t>(dst_frame_size);
         break;
@@ -1909,13 +2033,13 @@ FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size,
     case HAILO_FORMAT_ORDER_NC:
     case HAILO_FORMAT_ORDER_RGB4:
         for (const auto &quant_info : dst_quant_infos) {
-            m_quant_info_per_feature.emplace_back(quant_info.qp_zp, quant_info.qp_scale);
+            quant_info_per_feature.emplace_back(quant_info.qp_zp, quant_info.qp_scale);
         }
         m_quant_infos_rep_count = 1;
         break;
     case HAILO_FORMAT_ORDER_NHCW:
         for (const auto &quant_info : dst_quant_infos) {
-            m_quant_info_per_feature.emplace_back(quant_info.qp_zp, quant_info.qp_scale);
+            quant_info_per_feature.emplace_back(quant_info.qp_zp, quant_info.qp_scale);
         }
         m_quant_infos_rep_count = dst_image_shape.width;
         break;
@@ -1923,11 +2047,13 @@ FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size,
         LOGGER__CRITICAL("Got unknown format order = {}", HailoRTCommon::get_format_order_str(dst_format.order));
         break;
     }
+    m_quant_info_per_feature = NumaReplicated<std::vector<QuantInfoForDequantize>>(std::move(quant_info_per_feature));
 }
 
 Expected<std::unique_ptr<OutputTransformContext>> FrameOutputTransformContext::create(const hailo_3d_image_shape_t &src_image_shape,
     const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-    const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos)
+    const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos,
+    uint32_t worker_threads_count)
 {
     const auto internal_dst_format = HailoRTDefaults::expand_auto_format(dst_format, src_format);
 
@@ -1950,7 +2076,7 @@ Expected<std::unique_ptr<OutputTransformContext>> FrameOutputTransformContext::c
 
     std::unique_ptr<OutputTransformContext> frame_transform_context = std::make_unique<FrameOutputTransformContext>(src_frame_size,
         src_image_shape, src_format, dst_frame_size, dst_image_shape, internal_dst_format, dst_quant_infos, std::move(transpose_buffer),
-        *should_quantize, should_transpose, should_reorder, should_pad_periph);
+        *should_quantize, should_transpose, should_reorder, should_pad_periph, worker_threads_count);
 
     CHECK_AS_EXPECTED(nullptr != frame_transform_context, HAILO_OUT_OF_HOST_MEMORY);
 
@@ -2002,6 +2128,85 @@ Expected<std::unique_ptr<OutputTransformContext>> NMSOutputTransformContext::cre
     return nms_transform_context;
 }
 
+void FrameOutputTransformContext::build_transform_plan()
+{
+    if (!m_should_reorder || m_should_transpose) {
+        return;
+    }
+
+    const auto src_shape = m_src_image_shape;
+    const auto dst_shape = m_dst_image_shape;
+
+    // Fused reorder+dequantize - one pass over the frame instead of reorder followed by the
+    // in-place dequantize expansion. Applies to the hot NHCW->NHWC pairs with a uniform qp.
+    if ((HAILO_FORMAT_ORDER_NHCW == m_src_format.order) && (HAILO_FORMAT_ORDER_NHWC == m_dst_format.order) &&
+        m_should_quantize && m_are_all_qps_the_same && (HAILO_FORMAT_TYPE_FLOAT32 == m_dst_format.type) &&
+        !m_should_pad_periph && !m_dst_quant_infos.empty()) {
+        const auto qp_zp = m_dst_quant_infos[0].qp_zp;
+        const auto qp_scale = m_dst_quant_infos[0].qp_scale;
+        const auto src_row_elements = static_cast<size_t>(src_shape.width) * src_shape.features;
+        const auto dst_row_elements = static_cast<size_t>(dst_shape.width) * dst_shape.features;
+
+        if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+            m_fused_plan = [src_shape, dst_shape, src_row_elements, dst_row_elements, qp_zp, qp_scale](
+                const void *src_ptr, void *dst_ptr) {
+                for (uint32_t row = 0; row < dst_shape.height; row++) {
+                    reorder_engine::nhcw_row_to_nhwc_dequantize(
+                        (const uint8_t*)src_ptr + (row * src_row_elements), dst_shape.features,
+                        src_shape.width, dst_shape.width,
+                        (float32_t*)dst_ptr + (row * dst_row_elements), qp_zp, qp_scale);
+                }
+                return HAILO_SUCCESS;
+            };
+        } else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+            m_fused_plan = [src_shape, dst_shape, src_row_elements, dst_row_elements, qp_zp, qp_scale](
+                const void *src_ptr, void *dst_ptr) {
+                for (uint32_t row = 0; row < dst_shape.height; row++) {
+                    reorder_engine::nhcw_row_to_nhwc_dequantize(
+                        (const uint16_t*)src_ptr + (row * src_row_elements), dst_shape.features,
+                        src_shape.width, dst_shape.width,
+                        (float32_t*)dst_ptr + (row * dst_row_elements), qp_zp, qp_scale);
+                }
+                return HAILO_SUCCESS;
+            };
+        }
+    }
+
+    if ((HAILO_FORMAT_ORDER_NHCW == m_src_format.order) && (HAILO_FORMAT_ORDER_NHWC == m_dst_format.order)) {
+        if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+            m_reorder_plan = [src_shape, dst_shape](const void *src_ptr, void *dst_ptr) {
+                auto src_image_shape = src_shape;
+                auto dst_image_shape = dst_shape;
+                transform__d2h_NHCW_to_NHWC<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
+                return HAILO_SUCCESS;
+            };
+        } else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+            m_reorder_plan = [src_shape, dst_shape](const void *src_ptr, void *dst_ptr) {
+                auto src_image_shape = src_shape;
+                auto dst_image_shape = dst_shape;
+                transform__d2h_NHCW_to_NHWC<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
+                return HAILO_SUCCESS;
+            };
+        }
+    } else if ((HAILO_FORMAT_ORDER_NHW == m_src_format.order) && (HAILO_FORMAT_ORDER_NHW == m_dst_format.order)) {
+        if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+            m_reorder_plan = [src_shape, dst_shape](const void *src_ptr, void *dst_ptr) {
+                auto src_image_shape = src_shape;
+                auto dst_image_shape = dst_shape;
+                transform__d2h_NHW_to_NHW<uint8_t>((uint8_t*)src_ptr, &src_image_shape, (uint8_t*)dst_ptr, &dst_image_shape);
+                return HAILO_SUCCESS;
+            };
+        } else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+            m_reorder_plan = [src_shape, dst_shape](const void *src_ptr, void *dst_ptr) {
+                auto src_image_shape = src_shape;
+                auto dst_image_shape = dst_shape;
+                transform__d2h_NHW_to_NHW<uint16_t>((uint16_t*)src_ptr, &src_image_shape, (uint16_t*)dst_ptr, &dst_image_shape);
+                return HAILO_SUCCESS;
+            };
+        }
+    }
+}
+
 hailo_status FrameOutputTransformContext::transform(const MemoryView src, MemoryView dst)
 {
     /* Check sizes */
@@ -2010,12 +2215,196 @@ hailo_status FrameOutputTransformContext::transform(const MemoryView src, Memory
     CHECK(dst.size() == m_dst_frame_size, HAILO_INVALID_ARGUMENT,
         "dst_size must be {}. passed size - {}", m_dst_frame_size, dst.size());
 
+    if ((m_worker_threads_count.load(std::memory_order_relaxed) > 1) && is_parallel_transform_supported()) {
+        auto status = transform_parallel(src.data(), dst.data());
+        CHECK_SUCCESS(status);
+        return HAILO_SUCCESS;
+    }
+
+    if (m_fused_plan) {
+        // Single fused pass - reorder and dequantize together
+        auto status = m_fused_plan(src.data(), dst.data());
+        CHECK_SUCCESS(status);
+        return HAILO_SUCCESS;
+    }
+
     auto status = transform_inner(src.data(), dst.data(), MemoryView(m_transpose_buffer));
     CHECK_SUCCESS(status);
 
     return HAILO_SUCCESS;
 }
 
+hailo_status FrameOutputTransformContext::transform_batch(const MemoryView src, MemoryView dst, uint32_t batch_size)
+{
+    /* Check sizes once for the whole batch */
+    CHECK(src.size() == (m_src_frame_size * batch_size), HAILO_INVALID_ARGUMENT,
+        "src size must be {}. passed size - {}", (m_src_frame_size * batch_size), src.size());
+    CHECK(dst.size() == (m_dst_frame_size * batch_size), HAILO_INVALID_ARGUMENT,
+        "dst_size must be {}. passed size - {}", (m_dst_frame_size * batch_size), dst.size());
+
+    // Frame-level parallelism - workers transform whole, independent frames, so every transform
+    // (not only the row-separable ones) benefits from a batch. Skipped when the per-frame path
+    // needs the shared transpose buffer, or already shards rows over the same pool (a nested
+    // pool.run from a worker would stall waiting on itself).
+    auto &pool = TransformThreadPool::instance();
+    const auto parts_count = std::min(batch_size, pool.max_parallelism());
+    const bool frames_are_independent = (!m_should_transpose) &&
+        !((m_worker_threads_count.load(std::memory_order_relaxed) > 1) && is_parallel_transform_supported());
+    if ((parts_count <= 1) || (!frames_are_independent)) {
+        return OutputTransformContext::transform_batch(src, dst, batch_size);
+    }
+
+    std::atomic<uint32_t> next_frame{0};
+    auto status = pool.run(parts_count, [&](uint32_t) -> hailo_status {
+        for (auto frame = next_frame.fetch_add(1); frame < batch_size; frame = next_frame.fetch_add(1)) {
+            const auto *frame_src = src.data() + (frame * m_src_frame_size);
+            auto *frame_dst = dst.data() + (frame * m_dst_frame_size);
+            auto frame_status = m_fused_plan ? m_fused_plan(frame_src, frame_dst) :
+                transform_inner(frame_src, frame_dst, MemoryView());
+            CHECK_SUCCESS(frame_status);
+        }
+        return HAILO_SUCCESS;
+    });
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status FrameOutputTransformContext::set_worker_threads_count(uint32_t worker_threads_count)
+{
+    CHECK(worker_threads_count >= 1, HAILO_INVALID_ARGUMENT, "worker threads count must be at least 1");
+    if (!is_parallel_transform_supported()) {
+        return HAILO_NOT_SUPPORTED;
+    }
+    const auto clamped = std::min(worker_threads_count, TransformThreadPool::instance().max_parallelism());
+    m_worker_threads_count.store(clamped, std::memory_order_relaxed);
+    return HAILO_SUCCESS;
+}
+
+bool FrameOutputTransformContext::is_parallel_transform_supported() const
+{
+    // The frame is splitted to row ranges, so every step must be row separable
+    if (m_should_transpose || m_should_pad_periph) {
+        return false;
+    }
+    if (m_src_image_shape.height != m_dst_image_shape.height) {
+        return false;
+    }
+    if (!(m_should_reorder || m_should_quantize)) {
+        return false;
+    }
+    if (m_should_quantize && !m_are_all_qps_the_same) {
+        // Per feature dequantization depends on the element position inside the full frame
+        return false;
+    }
+    if (m_should_reorder) {
+        const bool row_separable_reorder =
+            ((HAILO_FORMAT_ORDER_NHCW == m_src_format.order) && (HAILO_FORMAT_ORDER_NHWC == m_dst_format.order)) ||
+            ((HAILO_FORMAT_ORDER_NHW == m_src_format.order) && (HAILO_FORMAT_ORDER_NHW == m_dst_format.order));
+        if (!row_separable_reorder) {
+            return false;
+        }
+    }
+    return true;
+}
+
+hailo_status FrameOutputTransformContext::transform_parallel(const void *src_ptr, void *dst_ptr)
+{
+    auto &pool = TransformThreadPool::instance();
+    const auto rows_count = m_dst_image_shape.height;
+    const auto parts_count = std::min({m_worker_threads_count.load(std::memory_order_relaxed),
+        pool.max_parallelism(), rows_count});
+    if (parts_count <= 1) {
+        return transform_inner(src_ptr, dst_ptr, MemoryView(m_transpose_buffer));
+    }
+
+    const auto rows_per_part = rows_count / parts_count;
+    const auto leftover_rows = rows_count % parts_count;
+    auto status = pool.run(parts_count, [&](uint32_t part) -> hailo_status {
+        // Spread the leftover rows over the first parts
+        const auto part_rows = rows_per_part + ((part < leftover_rows) ? 1 : 0);
+        const auto part_start = (part * rows_per_part) + std::min(part, leftover_rows);
+        return transform_row_slice(src_ptr, dst_ptr, part_start, part_rows);
+    });
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status FrameOutputTransformContext::transform_row_slice(const void *src_ptr, void *dst_ptr, uint32_t row_start,
+    uint32_t rows_count)
+{
+    const size_t src_row_elements = static_cast<size_t>(m_src_image_shape.width) * m_src_image_shape.features;
+    const size_t dst_row_elements = static_cast<size_t>(m_dst_image_shape.width) * m_dst_image_shape.features;
+    const auto src_data_bytes = HailoRTCommon::get_format_data_bytes(m_src_format);
+    const auto dst_data_bytes = HailoRTCommon::get_format_data_bytes(m_dst_format);
+
+    auto src_slice_shape = m_src_image_shape;
+    src_slice_shape.height = rows_count;
+    auto dst_slice_shape = m_dst_image_shape;
+    dst_slice_shape.height = rows_count;
+
+    const auto *src_slice = static_cast<const uint8_t *>(src_ptr) + (row_start * src_row_elements * src_data_bytes);
+    // The slice base is taken at the final (dst element sized) offset, so the in-place dequantize
+    // expansion of this slice cannot run over a neighbor slice
+    auto *dst_slice = static_cast<uint8_t *>(dst_ptr) + (row_start * dst_row_elements * dst_data_bytes);
+
+    if (m_should_reorder) {
+        auto status = reorder_output_stream(src_slice, src_slice_shape, m_src_format, dst_slice, dst_slice_shape,
+            m_dst_format);
+        CHECK_SUCCESS(status);
+    } else {
+        memcpy(dst_slice, src_slice, rows_count * src_row_elements * src_data_bytes);
+    }
+
+    if (m_should_quantize) {
+        auto status = dequantize_slice(dst_slice, static_cast<uint32_t>(rows_count * dst_row_elements));
+        CHECK_SUCCESS(status);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status FrameOutputTransformContext::dequantize_slice(void *dst_ptr, uint32_t elements_count)
+{
+    // Eligibility is verified by is_parallel_transform_supported() - all the qps are the same
+    assert(m_are_all_qps_the_same);
+
+    switch (m_dst_format.type) {
+        case HAILO_FORMAT_TYPE_UINT16:
+            CHECK(HAILO_FORMAT_TYPE_UINT8 == m_src_format.type, HAILO_INVALID_OPERATION);
+            cast_elements_inplace<uint16_t, uint8_t>((uint16_t*)dst_ptr, elements_count);
+            break;
+        case HAILO_FORMAT_TYPE_FLOAT32:
+            /* if output layer is argmax - do not rescale */
+            if (HAILO_FORMAT_ORDER_NHW != m_dst_format.order) {
+                if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+                    Quantization::dequantize_output_buffer_in_place<float32_t, uint8_t>((float32_t*)dst_ptr,
+                        elements_count, m_dst_quant_infos[0]);
+                } else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+                    Quantization::dequantize_output_buffer_in_place<float32_t, uint16_t>((float32_t*)dst_ptr,
+                        elements_count, m_dst_quant_infos[0]);
+                } else {
+                    return HAILO_INVALID_OPERATION;
+                }
+            } else {
+                if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+                    cast_elements_inplace<float32_t, uint8_t>((float32_t*)dst_ptr, elements_count);
+                } else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+                    cast_elements_inplace<float32_t, uint16_t>((float32_t*)dst_ptr, elements_count);
+                } else {
+                    return HAILO_INVALID_OPERATION;
+                }
+            }
+            break;
+        default:
+            LOGGER__ERROR("Invalid dst-buffer's type format");
+            return HAILO_INVALID_ARGUMENT;
+    }
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status NMSOutputTransformContext::transform(const MemoryView src, MemoryView dst)
 {
     /* Check sizes */
@@ -20,7 +20,10 @@
 
 #include "stream_common/stream_internal.hpp"
 #include "hef/layer_info.hpp"
+#include "common/numa_replicated.hpp"
 
+#include <atomic>
+#include <functional>
 #include <map>
 #include <vector>
 
@@ -127,19 +130,33 @@ class HAILORTAPI FrameOutputTransformContext final : public OutputTransformConte
 public:
     static Expected<std::unique_ptr<OutputTransformContext>> create(const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, const hailo_3d_image_shape_t &dst_image_shape,
-        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_info);
+        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_info,
+        uint32_t worker_threads_count = 1);
 
     FrameOutputTransformContext(size_t src_frame_size, const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
         const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_info, Buffer&& transpose_buffer,
-        const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph);
+        const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph,
+        uint32_t worker_threads_count = 1);
 
     hailo_status transform_inner(const void *src_ptr, void *dst_ptr, MemoryView transpose_buffer);
 
+    // Transformation plan - the reorder kernel for the dominant order/type pairs is resolved once
+    // here instead of re-dispatched per frame; pairs without a plan keep the generic dispatch
+    void build_transform_plan();
+
     hailo_status quantize_stream(const void *dst_ptr);
 
+    // Opt-in parallel (row-range splitted) transform support
+    bool is_parallel_transform_supported() const;
+    hailo_status transform_parallel(const void *src_ptr, void *dst_ptr);
+    hailo_status transform_row_slice(const void *src_ptr, void *dst_ptr, uint32_t row_start, uint32_t rows_count);
+    hailo_status dequantize_slice(void *dst_ptr, uint32_t elements_count);
+
 
     virtual hailo_status transform(const MemoryView src, MemoryView dst) override;
+    virtual hailo_status transform_batch(const MemoryView src, MemoryView dst, uint32_t batch_size) override;
+    virtual hailo_status set_worker_threads_count(uint32_t worker_threads_count) override;
     virtual std::string description() const override;
 
 private:
@@ -159,9 +176,17 @@ private:
 
     const hailo_3d_image_shape_t m_src_image_shape;
     const hailo_3d_image_shape_t m_dst_image_shape;
+    // Runtime adjustable (see set_worker_threads_count) - read per frame by the transform paths
+    std::atomic<uint32_t> m_worker_threads_count;
+    // Bound reorder kernel (see build_transform_plan), empty when the generic dispatch is used
+    std::function<hailo_status(const void *, void *)> m_reorder_plan;
+    // Bound fused reorder+dequantize kernel - single pass over the frame (see build_transform_plan)
+    std::function<hailo_status(const void *, void *)> m_fused_plan;
     Buffer m_transpose_buffer;
     bool m_are_all_qps_the_same;
-    std::vector<QuantInfoForDequantize> m_quant_info_per_feature;
+    // NUMA-replicated (opt-in, HAILO_NUMA_REPLICATE=1) - read per frame by every worker thread,
+    // so on multi-socket hosts each reads its node-local clone
+    NumaReplicated<std::vector<QuantInfoForDequantize>> m_quant_info_per_feature;
     uint32_t m_quant_infos_rep_count;
 };
 
@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transform_thread_pool.cpp
+ * @brief Implementation of the shared transform worker thread pool
+ **/
+
+#include "transform/transform_thread_pool.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <atomic>
+
+namespace hailort
+{
+
+TransformThreadPool &TransformThreadPool::instance()
+{
+    static TransformThreadPool pool;
+    return pool;
+}
+
+TransformThreadPool::~TransformThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_cv.notify_all();
+    for (auto &worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+uint32_t TransformThreadPool::max_parallelism() const
+{
+    const auto quota = m_parallelism_quota.load();
+    if (0 != quota) {
+        return quota;
+    }
+
+    static const uint32_t env_quota = []() {
+        const auto *env = std::getenv("HAILO_COMPUTE_THREADS");
+        return (nullptr != env) ? static_cast<uint32_t>(strtoul(env, nullptr, 10)) : 0;
+    }();
+    if (0 != env_quota) {
+        return env_quota;
+    }
+
+    const auto hw_concurrency = std::thread::hardware_concurrency();
+    return (0 == hw_concurrency) ? 1 : hw_concurrency;
+}
+
+void TransformThreadPool::set_parallelism_quota(uint32_t max_threads)
+{
+    m_parallelism_quota.store(max_threads);
+}
+
+void TransformThreadPool::ensure_workers(uint32_t workers_count)
+{
+    const auto target = std::min(workers_count, max_parallelism() - 1);
+    while (m_workers.size() < target) {
+        m_workers.emplace_back(&TransformThreadPool::worker_main, this);
+    }
+}
+
+void TransformThreadPool::worker_main()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_shutdown || !m_pending_tasks.empty(); });
+            if (m_shutdown && m_pending_tasks.empty()) {
+                return;
+            }
+            task = std::move(m_pending_tasks.front());
+            m_pending_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+hailo_status TransformThreadPool::run(uint32_t parts_count, const std::function<hailo_status(uint32_t)> &part_func)
+{
+    if ((parts_count <= 1) || (max_parallelism() <= 1)) {
+        // No workers to hand the parts to - run everything on the calling thread
+        for (uint32_t part = 0; part < parts_count; part++) {
+            const auto status = part_func(part);
+            if (HAILO_SUCCESS != status) {
+                return status;
+            }
+        }
+        return HAILO_SUCCESS;
+    }
+
+    std::atomic<uint32_t> remaining_parts(parts_count - 1);
+    std::atomic<int> first_error(static_cast<int>(HAILO_SUCCESS));
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ensure_workers(parts_count - 1);
+        for (uint32_t part = 1; part < parts_count; part++) {
+            m_pending_tasks.emplace_back([&, part]() {
+                const auto status = part_func(part);
+                if (HAILO_SUCCESS != status) {
+                    int expected = static_cast<int>(HAILO_SUCCESS);
+                    first_error.compare_exchange_strong(expected, static_cast<int>(status));
+                }
+                if (1 == remaining_parts.fetch_sub(1)) {
+                    std::unique_lock<std::mutex> done_lock(done_mutex);
+                    done_cv.notify_one();
+                }
+            });
+        }
+    }
+    m_cv.notify_all();
+
+    // Part 0 always runs on the calling thread
+    const auto caller_status = part_func(0);
+    if (HAILO_SUCCESS != caller_status) {
+        int expected = static_cast<int>(HAILO_SUCCESS);
+        first_error.compare_exchange_strong(expected, static_cast<int>(caller_status));
+    }
+
+    {
+        std::unique_lock<std::mutex> done_lock(done_mutex);
+        done_cv.wait(done_lock, [&]() { return 0 == remaining_parts.load(); });
+    }
+
+    return static_cast<hailo_status>(first_error.load());
+}
+
+} /* namespace hailort */
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file transform_thread_pool.hpp
+ * @brief Worker thread pool shared between all transform contexts, used for the opt-in
+ *        parallel (row-range splitted) frame transformations.
+ **/
+
+#ifndef _HAILO_TRANSFORM_THREAD_POOL_HPP_
+#define _HAILO_TRANSFORM_THREAD_POOL_HPP_
+
+#include "hailo/hailort.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hailort
+{
+
+class TransformThreadPool final
+{
+public:
+    // Single pool shared across all transform contexts in the process. Workers are spawned
+    // lazily on the first parallel transform, up to the hardware concurrency.
+    static TransformThreadPool &instance();
+
+    TransformThreadPool(const TransformThreadPool &) = delete;
+    TransformThreadPool &operator=(const TransformThreadPool &) = delete;
+    ~TransformThreadPool();
+
+    /**
+     * Runs @a part_func over part indexes [0, parts_count). Part 0 runs on the calling thread,
+     * the rest on the pool workers. Blocks until all parts are done and returns the first
+     * non-success status (if any).
+     */
+    hailo_status run(uint32_t parts_count, const std::function<hailo_status(uint32_t)> &part_func);
+
+    // Upper bound for useful parts count (calling thread included). Defaults to the hardware
+    // concurrency; cappable at runtime via set_parallelism_quota (and the HAILO_COMPUTE_THREADS
+    // env var), so a multi-tenant host can bound the library's compute footprint in one place -
+    // transform contexts, NMS sharding and future kernels all draw from this pool.
+    uint32_t max_parallelism() const;
+
+    // Caps the pool's parallelism (0 restores the hardware default). Already-spawned workers
+    // above the quota drain naturally - the quota bounds how many are handed work.
+    void set_parallelism_quota(uint32_t max_threads);
+
+private:
+    TransformThreadPool() = default;
+
+    // Must be called with m_mutex held
+    void ensure_workers(uint32_t workers_count);
+    void worker_main();
+
+    std::atomic<uint32_t> m_parallelism_quota{0};
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_pending_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_shutdown = false;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TRANSFORM_THREAD_POOL_HPP_ */
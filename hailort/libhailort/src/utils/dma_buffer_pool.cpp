@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file dma_buffer_pool.cpp
+ * @brief Implementation of the process-wide pinned-buffer pool
+ **/
+
+#include "utils/dma_buffer_pool.hpp"
+
+#include "hailo/buffer_storage.hpp"
+
+#include "common/utils.hpp"
+
+namespace hailort
+{
+
+// Smallest size class - below this everything shares one class
+static const size_t MIN_SIZE_CLASS = 4096;
+
+DmaBufferPool &DmaBufferPool::instance()
+{
+    static DmaBufferPool pool;
+    return pool;
+}
+
+bool DmaBufferPool::is_poolable(const BufferStorageParams &params)
+{
+    if (0 == (params.flags & HAILO_BUFFER_FLAGS_DMA)) {
+        return false;
+    }
+    // Only lazily mapped buffers are recycled across users
+    return (nullptr == params.dma_mapping_params.device) && (nullptr == params.dma_mapping_params.vdevice);
+}
+
+size_t DmaBufferPool::size_class(size_t size)
+{
+    size_t size_class = MIN_SIZE_CLASS;
+    while (size_class < size) {
+        size_class *= 2;
+    }
+    return size_class;
+}
+
+Expected<std::shared_ptr<Buffer>> DmaBufferPool::acquire(size_t size, const BufferStorageParams &params)
+{
+    if (!is_poolable(params)) {
+        return Buffer::create_shared(size, params);
+    }
+
+    const auto buffer_size_class = size_class(size);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto free_list_it = m_free_lists.find(buffer_size_class);
+        if ((m_free_lists.end() != free_list_it) && (!free_list_it->second.empty())) {
+            auto buffer = free_list_it->second.back();
+            free_list_it->second.pop_back();
+            m_handed_out_buffers.insert(buffer->data());
+            return buffer;
+        }
+    }
+
+    // Miss - allocate (and later pool) a buffer of the full class size
+    auto buffer = Buffer::create_shared(buffer_size_class, params);
+    CHECK_EXPECTED(buffer);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_handed_out_buffers.insert(buffer.value()->data());
+    }
+    return buffer;
+}
+
+bool DmaBufferPool::release(const std::shared_ptr<Buffer> &buffer)
+{
+    if (nullptr == buffer) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Symmetric with acquire - only buffers this pool handed out come back (device-bound buffers
+    // are rejected by is_poolable on acquire and therefore never tracked here)
+    auto handed_out = m_handed_out_buffers.find(buffer->data());
+    if (m_handed_out_buffers.end() == handed_out) {
+        return false;
+    }
+    m_handed_out_buffers.erase(handed_out);
+
+    auto &free_list = m_free_lists[size_class(buffer->size())];
+    if (free_list.size() >= MAX_FREE_BUFFERS_PER_CLASS) {
+        return false;
+    }
+    free_list.emplace_back(buffer);
+    return true;
+}
+
+void DmaBufferPool::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Dropping the free lists releases the buffers (and any lazy driver mappings they hold) now,
+    // while the driver is still alive. Buffers still held by users stay tracked and are simply
+    // not re-pooled when released after the clear.
+    m_free_lists.clear();
+    m_handed_out_buffers.clear();
+}
+
+} /* namespace hailort */
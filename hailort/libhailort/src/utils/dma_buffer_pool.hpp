@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file dma_buffer_pool.hpp
+ * @brief Process-wide pool of pinned (DMA-able) buffers, size-class based with LIFO free lists.
+ *        Acquiring a pooled buffer on the hot path is an O(1) list pop that also keeps the
+ *        existing driver mappings (and cache warmth) of the recycled buffer, instead of paying
+ *        the allocation + mapping ioctls of a fresh Buffer::create.
+ **/
+
+#ifndef _HAILO_DMA_BUFFER_POOL_HPP_
+#define _HAILO_DMA_BUFFER_POOL_HPP_
+
+#include "hailo/buffer.hpp"
+#include "hailo/expected.hpp"
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace hailort
+{
+
+class DmaBufferPool final
+{
+public:
+    static DmaBufferPool &instance();
+
+    DmaBufferPool(const DmaBufferPool &) = delete;
+    DmaBufferPool &operator=(const DmaBufferPool &) = delete;
+
+    // Pops a pinned buffer of a matching size class from the pool, or allocates a new one.
+    // Only lazily-mapped DMA buffers are pooled - params with an explicit device/vdevice mapping
+    // allocate directly (a recycled mapping could belong to the wrong device).
+    Expected<std::shared_ptr<Buffer>> acquire(size_t size, const BufferStorageParams &params);
+
+    // Returns a buffer previously handed out by acquire() back to its size-class free list.
+    // Returns false (and drops the buffer) when the buffer did not come from the pool or the
+    // class is full - release is symmetric with acquire, so device-bound buffers (which acquire
+    // never pools) are never captured either.
+    bool release(const std::shared_ptr<Buffer> &buffer);
+
+    // Drops every pooled (and tracked) buffer. Called on device teardown: pooled buffers may hold
+    // lazy driver mappings, which must not outlive the driver they were created against - and a
+    // recycled mapping must not resurface for a new device reusing the same device id.
+    void clear();
+
+private:
+    DmaBufferPool() = default;
+
+    static bool is_poolable(const BufferStorageParams &params);
+    static size_t size_class(size_t size);
+
+    // Bounds the memory pinned by each free list
+    static const size_t MAX_FREE_BUFFERS_PER_CLASS = 32;
+
+    std::mutex m_mutex;
+    // Size class -> LIFO free list (most recently released first, for cache warmth)
+    std::unordered_map<size_t, std::vector<std::shared_ptr<Buffer>>> m_free_lists;
+    // Data pointers of buffers handed out by acquire() and not yet released - the only buffers
+    // release() will take back (symmetric with acquire's poolability rules)
+    std::unordered_set<const void *> m_handed_out_buffers;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_DMA_BUFFER_POOL_HPP_ */
@@ -17,6 +17,9 @@
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/android_sink.h>
 #include <spdlog/sinks/null_sink.h>
+#include <spdlog/async.h>
+
+#include <cstdlib>
 #include <stdio.h>
 #include <stdlib.h>
 #include <iostream>
@@ -194,7 +197,23 @@ HailoRTLogger::HailoRTLogger(spdlog::level::level_enum console_level, spdlog::le
 
     m_console_sink->set_pattern(HAILORT_CONSOLE_LOGGER_PATTERN);
     spdlog::sinks_init_list sink_list = { m_console_sink, m_main_log_file_sink, m_local_log_file_sink };
-    m_hailort_logger = make_shared_nothrow<spdlog::logger>(HAILORT_NAME, sink_list.begin(), sink_list.end());
+
+    // Zero-allocation fast path notes:
+    //  - Disabled-level sites never evaluate their arguments (the SPDLOG_* macros gate on
+    //    should_log before touching them), so hot-path LOGGER__TRACE/DEBUG are free in release.
+    //  - With HAILO_LOGGER_ASYNC set, formatting and sink IO move off the calling thread onto
+    //    spdlog's async thread pool, so an error logged while holding transfer state only pays an
+    //    enqueue (messages can be dropped under a flood - the bounded queue blocks are avoided
+    //    with the overrun_oldest policy).
+    if (nullptr != std::getenv("HAILO_LOGGER_ASYNC")) {
+        static const size_t ASYNC_LOGGER_QUEUE_SIZE = 8192;
+        static const size_t ASYNC_LOGGER_THREADS = 1;
+        spdlog::init_thread_pool(ASYNC_LOGGER_QUEUE_SIZE, ASYNC_LOGGER_THREADS);
+        m_hailort_logger = make_shared_nothrow<spdlog::async_logger>(HAILORT_NAME, sink_list.begin(), sink_list.end(),
+            spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
+    } else {
+        m_hailort_logger = make_shared_nothrow<spdlog::logger>(HAILORT_NAME, sink_list.begin(), sink_list.end());
+    }
     if (nullptr == m_hailort_logger) {
         std::cerr << "Allocating memory on heap for HailoRT logger has failed! Please check if this host has enough memory. Writing to log will result in a SEGFAULT!" << std::endl;
         return;
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file infer_result_cache.cpp
+ * @brief Implementation of the content-addressed inference result cache
+ **/
+
+#include "hailo/infer_result_cache.hpp"
+
+#include "common/crc32c.hpp"
+
+#include <atomic>
+#include <cstring>
+
+namespace hailort
+{
+
+// Process-wide aggregates across caches, sampled by the stats emitter
+static std::atomic<uint64_t> g_total_cache_hits{0};
+static std::atomic<uint64_t> g_total_cache_misses{0};
+
+InferResultCache::InferResultCache(size_t max_entries) :
+    m_max_entries(max_entries)
+{}
+
+uint64_t InferResultCache::hash_views(const std::vector<MemoryView> &views)
+{
+    // Two independently seeded CRC32C passes give a 64-bit content key; CRC32C is hardware
+    // accelerated on the relevant hosts (crc32c::compute dispatches to SSE4.2 when available)
+    uint32_t low = 0;
+    uint32_t high = 0x9E3779B9;
+    for (const auto &view : views) {
+        low = crc32c::compute(view.data(), view.size(), low);
+        high = crc32c::compute(view.data(), view.size(), high);
+    }
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+bool InferResultCache::try_get(const std::vector<MemoryView> &input_views, std::vector<MemoryView> &output_views)
+{
+    const auto key = hash_views(input_views);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto entry_it = m_entries.find(key);
+    if (m_entries.end() == entry_it) {
+        m_misses++;
+        g_total_cache_misses++;
+        return false;
+    }
+
+    const auto &outputs = entry_it->second.outputs;
+    if (outputs.size() != output_views.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < outputs.size(); i++) {
+        if (outputs[i].size() != output_views[i].size()) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < outputs.size(); i++) {
+        memcpy(output_views[i].data(), outputs[i].data(), outputs[i].size());
+    }
+
+    // LRU touch
+    m_lru.splice(m_lru.begin(), m_lru, entry_it->second.lru_position);
+    m_hits++;
+    g_total_cache_hits++;
+    return true;
+}
+
+void InferResultCache::store(const std::vector<MemoryView> &input_views, const std::vector<MemoryView> &output_views)
+{
+    const auto key = hash_views(input_views);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_entries.end() != m_entries.find(key)) {
+        return;
+    }
+
+    while (m_entries.size() >= m_max_entries) {
+        m_entries.erase(m_lru.back());
+        m_lru.pop_back();
+    }
+
+    Entry entry;
+    entry.outputs.reserve(output_views.size());
+    for (const auto &output : output_views) {
+        entry.outputs.emplace_back(output.data(), output.data() + output.size());
+    }
+    m_lru.emplace_front(key);
+    entry.lru_position = m_lru.begin();
+    m_entries.emplace(key, std::move(entry));
+}
+
+uint64_t InferResultCache::total_hits()
+{
+    return g_total_cache_hits.load();
+}
+
+uint64_t InferResultCache::total_misses()
+{
+    return g_total_cache_misses.load();
+}
+
+} /* namespace hailort */
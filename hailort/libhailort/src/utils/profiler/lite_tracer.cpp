@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file lite_tracer.cpp
+ * @brief Implementation of the always-on lightweight binary tracer
+ **/
+
+#include "utils/profiler/lite_tracer.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <cstdlib>
+#include <fstream>
+
+namespace hailort
+{
+
+LiteTracer &LiteTracer::instance()
+{
+    static LiteTracer tracer;
+    return tracer;
+}
+
+LiteTracer::LiteTracer() :
+    m_category_mask(0)
+{
+    const auto *mask_env = std::getenv("HAILO_LITE_TRACE");
+    if (nullptr != mask_env) {
+        m_category_mask = static_cast<uint32_t>(strtoul(mask_env, nullptr, 16));
+    }
+}
+
+LiteTracer::ThreadRing &LiteTracer::this_thread_ring()
+{
+    thread_local ThreadRing *ring = nullptr;
+    if (nullptr == ring) {
+        auto *new_ring = new ThreadRing();
+        new_ring->records.resize(RECORDS_PER_THREAD);
+        {
+            std::lock_guard<std::mutex> lock(m_rings_mutex);
+            new_ring->thread_index = static_cast<uint16_t>(m_rings.size());
+            m_rings.emplace_back(new_ring);
+        }
+        // Intentionally leaked on thread exit - rings must stay dumpable after their thread died,
+        // and the bounded ring count keeps the footprint fixed
+        ring = new_ring;
+    }
+    return *ring;
+}
+
+void LiteTracer::record(LiteTraceCategory category, uint8_t event, uint32_t arg)
+{
+    auto &ring = this_thread_ring();
+    auto &slot = ring.records[ring.next_index % RECORDS_PER_THREAD];
+    ring.next_index++;
+
+    slot.timestamp_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    slot.category = static_cast<uint8_t>(category);
+    slot.event = event;
+    slot.thread_index = ring.thread_index;
+    slot.arg = arg;
+}
+
+hailo_status LiteTracer::dump(const std::string &path)
+{
+    auto file = std::ofstream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    CHECK(file.is_open(), HAILO_OPEN_FILE_FAILURE, "Failed creating lite trace dump \"{}\"", path);
+
+    struct {
+        char magic[4];
+        uint32_t version;
+        uint64_t records_count;
+    } header{{'H', 'R', 'T', 'L'}, 1, 0};
+
+    std::lock_guard<std::mutex> lock(m_rings_mutex);
+    for (const auto *ring : m_rings) {
+        header.records_count += std::min<uint64_t>(ring->next_index, RECORDS_PER_THREAD);
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    for (const auto *ring : m_rings) {
+        const auto valid_records = std::min<uint64_t>(ring->next_index, RECORDS_PER_THREAD);
+        // Oldest first - when the ring wrapped, the oldest record sits at next_index
+        const auto start = (ring->next_index >= RECORDS_PER_THREAD) ? (ring->next_index % RECORDS_PER_THREAD) : 0;
+        for (uint64_t i = 0; i < valid_records; i++) {
+            const auto &slot = ring->records[(start + i) % RECORDS_PER_THREAD];
+            file.write(reinterpret_cast<const char *>(&slot), sizeof(slot));
+        }
+    }
+
+    CHECK(file.good(), HAILO_FILE_OPERATION_FAILURE, "Failed writing lite trace dump \"{}\"", path);
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file lite_tracer.hpp
+ * @brief Always-compiled, nanosecond-cheap binary tracer. Each thread owns a fixed ring of
+ *        16-byte records; LITE_TRACE() costs one relaxed mask load when disabled and a timestamp
+ *        plus ring store when its category is enabled. The category mask is runtime controlled
+ *        (HAILO_LITE_TRACE env var as a hex mask, or LiteTracer::set_category_mask), so traces of
+ *        a production hiccup can be captured without a profiler build or restart.
+ *        LiteTracer::dump() writes all rings to a binary file: a 16-byte header
+ *        ("HRTL", version, record count) followed by raw LiteTraceRecord entries.
+ **/
+
+#ifndef _HAILO_LITE_TRACER_HPP_
+#define _HAILO_LITE_TRACER_HPP_
+
+#include "hailo/hailort.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hailort
+{
+
+// Trace categories - bits in the runtime mask
+enum LiteTraceCategory : uint8_t {
+    LITE_TRACE_CATEGORY_SCHEDULER = 0,
+    LITE_TRACE_CATEGORY_VDMA = 1,
+    LITE_TRACE_CATEGORY_PIPELINE = 2,
+    LITE_TRACE_CATEGORY_STREAM = 3,
+};
+
+#pragma pack(push, 1)
+struct LiteTraceRecord {
+    uint64_t timestamp_ns; // steady clock
+    uint8_t category;
+    uint8_t event;
+    uint16_t thread_index;
+    uint32_t arg;
+};
+#pragma pack(pop)
+static_assert(16 == sizeof(LiteTraceRecord), "LiteTraceRecord must stay 16 bytes");
+
+// TODO: replay half of deterministic record/replay (HRT wishlist):
+//       The capture side exists: with the STREAM category enabled, every async submission
+//       records a timestamped frame-size and content-hash pair (see
+//       AsyncInputStreamBase::call_write_async_impl), alongside the scheduler decision and vdma
+//       completion records already here - enough to re-synthesize the exact arrival process and
+//       verify content determinism. Replay = a mock HailoRTDriver that completes transfers per
+//       the captured timing plus a feeder re-submitting the captured arrivals; a compile-time
+//       mock linking in place of the posix implementation suffices (the CLI links statically),
+//       and the front end belongs next to `hailortcli sched simulate`.
+class LiteTracer final
+{
+public:
+    static const size_t RECORDS_PER_THREAD = 16 * 1024;
+
+    static LiteTracer &instance();
+
+    LiteTracer(const LiteTracer &) = delete;
+    LiteTracer &operator=(const LiteTracer &) = delete;
+
+    bool is_category_enabled(LiteTraceCategory category) const
+    {
+        return 0 != (m_category_mask.load(std::memory_order_relaxed) & (1u << category));
+    }
+
+    void set_category_mask(uint32_t mask)
+    {
+        m_category_mask.store(mask, std::memory_order_relaxed);
+    }
+
+    void record(LiteTraceCategory category, uint8_t event, uint32_t arg);
+
+    // Writes all per-thread rings (oldest record first per thread) to a binary file
+    hailo_status dump(const std::string &path);
+
+private:
+    struct ThreadRing {
+        std::vector<LiteTraceRecord> records;
+        uint64_t next_index = 0;
+        uint16_t thread_index = 0;
+    };
+
+    LiteTracer();
+    ThreadRing &this_thread_ring();
+
+    std::atomic<uint32_t> m_category_mask;
+    std::mutex m_rings_mutex;
+    std::vector<ThreadRing *> m_rings;
+};
+
+// Always compiled - one relaxed load when the category is disabled
+#define LITE_TRACE(category, event, arg)                                                        \
+    do {                                                                                        \
+        auto &lite_tracer__ = ::hailort::LiteTracer::instance();                                \
+        if (lite_tracer__.is_category_enabled(category)) {                                      \
+            lite_tracer__.record((category), static_cast<uint8_t>(event),                       \
+                static_cast<uint32_t>(arg));                                                    \
+        }                                                                                       \
+    } while (0)
+
+} /* namespace hailort */
+
+#endif /* _HAILO_LITE_TRACER_HPP_ */
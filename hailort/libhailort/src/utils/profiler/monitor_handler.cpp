@@ -12,6 +12,14 @@
 #include "common/logger_macros.hpp"
 #include "common/os_utils.hpp"
 
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdlib>
+#endif
+
 namespace hailort
 {
 MonitorHandler::MonitorHandler()
@@ -215,8 +223,76 @@ Expected<std::shared_ptr<TempFile>> MonitorHandler::open_temp_mon_file()
     return tmp_file_ptr;
 }
 
+#if defined(__linux__)
+// Shared-memory transport for the monitor (opt-in via HAILO_MONITOR_SHM): instead of rewriting a
+// tmp file every cycle (file churn the reader re-opens and re-parses), the serialized snapshot is
+// published into a per-process shm segment with a seqlock header - the reader maps it once and
+// detects torn reads by comparing the sequence before/after parsing.
+struct MonitorShmHeader {
+    uint32_t version;
+    uint32_t size;
+    // Odd while a writer is mid-update
+    volatile uint32_t sequence;
+    uint32_t reserved;
+};
+
+static bool publish_monitor_shm(const std::string &serialized)
+{
+    static const size_t MONITOR_SHM_SIZE = 1024 * 1024;
+    static void *segment = nullptr;
+    if (nullptr == segment) {
+        const auto name = "/hailort_mon_" + std::to_string(getpid());
+        const auto fd = shm_open(name.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        if (fd < 0) {
+            return false;
+        }
+        if (0 != ftruncate(fd, MONITOR_SHM_SIZE)) {
+            (void)close(fd);
+            return false;
+        }
+        segment = mmap(nullptr, MONITOR_SHM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        (void)close(fd);
+        if (MAP_FAILED == segment) {
+            segment = nullptr;
+            return false;
+        }
+    }
+    if (serialized.size() > (MONITOR_SHM_SIZE - sizeof(MonitorShmHeader))) {
+        return false;
+    }
+
+    auto *header = static_cast<MonitorShmHeader *>(segment);
+    header->sequence = header->sequence + 1; // Odd - update in progress
+    __sync_synchronize();
+    header->version = 1;
+    header->size = static_cast<uint32_t>(serialized.size());
+    memcpy(static_cast<uint8_t *>(segment) + sizeof(MonitorShmHeader), serialized.data(), serialized.size());
+    __sync_synchronize();
+    header->sequence = header->sequence + 1; // Even - consistent
+    return true;
+}
+#endif /* defined(__linux__) */
+
 void MonitorHandler::dump_state()
 {
+#if defined(__linux__)
+    if (nullptr != std::getenv("HAILO_MONITOR_SHM")) {
+        ProtoMon shm_mon;
+        shm_mon.set_pid(get_curr_pid_as_str());
+        time_dependent_events_cycle_calc();
+        log_monitor_networks_infos(shm_mon);
+        log_monitor_device_infos(shm_mon);
+        log_monitor_frames_infos(shm_mon);
+        clear_accumulators();
+
+        std::string serialized;
+        if (!shm_mon.SerializeToString(&serialized) || !publish_monitor_shm(serialized)) {
+            LOGGER__ERROR("Failed publishing monitor state to shared memory");
+        }
+        return;
+    }
+#endif /* defined(__linux__) */
+
     auto file = LockedFile::create(m_mon_tmp_output->name(), "w");
     if (HAILO_SUCCESS != file.status()) {
         LOGGER__ERROR("Failed to open and lock file {}, with status: {}", m_mon_tmp_output->name(), file.status());
@@ -8,6 +8,8 @@
  **/
 
 #include "scheduler_profiler_handler.hpp"
+
+#include <chrono>
 #include "profiler_utils.hpp"
 
 #include "common/logger_macros.hpp"
@@ -36,6 +38,18 @@
 namespace hailort
 {
 
+// TODO: trace replay / what-if simulation (HRT wishlist):
+//       The profiler trace captured here (core-op add/switch/infer enqueue events with
+//       timestamps) contains everything needed to replay a production workload offline:
+//         - reconstruct the arrival process per core op from FrameEnqueue events,
+//         - re-run CoreOpsSchedulerOracle::get_oracle_decisions against a virtual clock with
+//           alternative priorities/thresholds/timeouts and the measured switch-cost EMAs,
+//         - report per-model latency/throughput deltas per parameter set.
+//       The oracle is already separable from the device (SchedulerBase is an interface), so the
+//       simulator only needs a trace-backed SchedulerBase implementation plus a
+//       `hailortcli sched simulate <trace> [--priority ...]` front end; kept as the agreed design
+//       for that tool.
+
 SchedulerProfilerHandler::SchedulerProfilerHandler(int64_t &start_time)
 #ifndef __ANDROID__
     : m_file_sink(HailoRTLogger::create_file_sink(HailoRTLogger::get_log_path(SCHEDULER_PROFILER_LOGGER_PATH), SCHEDULER_PROFILER_LOGGER_FILENAME, false)),
@@ -57,9 +71,150 @@ SchedulerProfilerHandler::SchedulerProfilerHandler(int64_t &start_time)
 
 SchedulerProfilerHandler::~SchedulerProfilerHandler()
 {
+    m_flush_stop = true;
+    if (m_flush_thread.joinable()) {
+        m_flush_thread.join();
+    }
+    flush_pending();
     m_profiler_logger->info("]\n}");
 }
 
+void SchedulerProfilerHandler::capture_pending(PendingTrace &&pending)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pending_lock);
+        m_pending_traces.emplace_back(std::move(pending));
+    }
+    // Lazily spawned on the first hot event, so profiler-less runs pay nothing
+    if (!m_flush_thread.joinable()) {
+        std::lock_guard<std::mutex> lock(m_proto_lock);
+        if (!m_flush_thread.joinable()) {
+            m_flush_thread = std::thread([this]() { flush_thread_main(); });
+        }
+    }
+}
+
+void SchedulerProfilerHandler::flush_thread_main()
+{
+    while (!m_flush_stop) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        flush_pending();
+    }
+}
+
+void SchedulerProfilerHandler::flush_pending()
+{
+    std::vector<PendingTrace> backlog;
+    {
+        std::lock_guard<std::mutex> lock(m_pending_lock);
+        backlog.swap(m_pending_traces);
+    }
+
+    for (const auto &pending : backlog) {
+        switch (pending.type) {
+        case PendingTrace::Type::FRAME_ENQUEUE_H2D:
+        {
+            log(JSON({
+                {"action", json_to_string(std::string("write_frame"))},
+                {"timestamp", json_to_string(pending.timestamp)},
+                {"core_op_handle", json_to_string(pending.core_op_handle)},
+                {"queue_name", json_to_string(pending.queue_name)}
+            }));
+            std::lock_guard<std::mutex> lock(m_proto_lock);
+            auto added_trace = m_profiler_trace_proto.add_added_trace();
+            added_trace->mutable_frame_enqueue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__H2D);
+            added_trace->mutable_frame_enqueue()->set_stream_name(pending.queue_name);
+            added_trace->mutable_frame_enqueue()->set_core_op_handle(pending.core_op_handle);
+            added_trace->mutable_frame_enqueue()->set_time_stamp(pending.timestamp);
+            break;
+        }
+        case PendingTrace::Type::FRAME_DEQUEUE_H2D:
+        {
+            log(JSON({
+                {"action", json_to_string(std::string("input_vdma_dequeue"))},
+                {"timestamp", json_to_string(pending.timestamp)},
+                {"device_id", json_to_string(pending.device_id)},
+                {"core_op_handle", json_to_string(pending.core_op_handle)},
+                {"queue_name", json_to_string(pending.queue_name)}
+            }));
+            std::lock_guard<std::mutex> lock(m_proto_lock);
+            auto added_trace = m_profiler_trace_proto.add_added_trace();
+            added_trace->mutable_frame_dequeue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__H2D);
+            added_trace->mutable_frame_dequeue()->set_device_id(pending.device_id);
+            added_trace->mutable_frame_dequeue()->set_stream_name(pending.queue_name);
+            added_trace->mutable_frame_dequeue()->set_core_op_handle(pending.core_op_handle);
+            added_trace->mutable_frame_dequeue()->set_time_stamp(pending.timestamp);
+            break;
+        }
+        case PendingTrace::Type::FRAME_DEQUEUE_D2H:
+        {
+            log(JSON({
+                {"action", json_to_string(std::string("read_frame"))},
+                {"timestamp", json_to_string(pending.timestamp)},
+                {"core_op_handle", json_to_string(pending.core_op_handle)},
+                {"queue_name", json_to_string(pending.queue_name)}
+            }));
+            std::lock_guard<std::mutex> lock(m_proto_lock);
+            auto added_trace = m_profiler_trace_proto.add_added_trace();
+            added_trace->mutable_frame_dequeue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__D2H);
+            added_trace->mutable_frame_dequeue()->set_stream_name(pending.queue_name);
+            added_trace->mutable_frame_dequeue()->set_core_op_handle(pending.core_op_handle);
+            added_trace->mutable_frame_dequeue()->set_time_stamp(pending.timestamp);
+            break;
+        }
+        case PendingTrace::Type::FRAME_ENQUEUE_D2H:
+        {
+            log(JSON({
+                {"action", json_to_string(std::string("output_vdma_enqueue"))},
+                {"timestamp", json_to_string(pending.timestamp)},
+                {"device_id", json_to_string(pending.device_id)},
+                {"core_op_handle", json_to_string(pending.core_op_handle)},
+                {"queue_name", json_to_string(pending.queue_name)}
+            }));
+            std::lock_guard<std::mutex> lock(m_proto_lock);
+            auto added_trace = m_profiler_trace_proto.add_added_trace();
+            added_trace->mutable_frame_enqueue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__D2H);
+            added_trace->mutable_frame_enqueue()->set_device_id(pending.device_id);
+            added_trace->mutable_frame_enqueue()->set_stream_name(pending.queue_name);
+            added_trace->mutable_frame_enqueue()->set_core_op_handle(pending.core_op_handle);
+            added_trace->mutable_frame_enqueue()->set_time_stamp(pending.timestamp);
+            break;
+        }
+        case PendingTrace::Type::SWITCH_CORE_OP:
+        {
+            log(JSON({
+                {"action", json_to_string(std::string("switch_core_op"))},
+                {"timestamp", json_to_string(pending.timestamp)},
+                {"device_id", json_to_string(pending.device_id)},
+                {"core_op_handle", json_to_string(pending.core_op_handle)}
+            }));
+            std::lock_guard<std::mutex> lock(m_proto_lock);
+            auto added_trace = m_profiler_trace_proto.add_added_trace();
+            added_trace->mutable_switched_core_op()->set_device_id(pending.device_id);
+            added_trace->mutable_switched_core_op()->set_new_core_op_handle(pending.core_op_handle);
+            added_trace->mutable_switched_core_op()->set_time_stamp(pending.timestamp);
+            break;
+        }
+        case PendingTrace::Type::ORACLE_DECISION:
+        {
+            log(JSON({
+                {"action", json_to_string(std::string("switch_core_op_decision"))},
+                {"reason", json_to_string(pending.reason_idle)},
+                {"core_op_handle", json_to_string(pending.core_op_handle)}
+            }));
+            std::lock_guard<std::mutex> lock(m_proto_lock);
+            auto added_trace = m_profiler_trace_proto.add_added_trace();
+            added_trace->mutable_switch_core_op_decision()->set_core_op_handle(pending.core_op_handle);
+            added_trace->mutable_switch_core_op_decision()->set_time_stamp(pending.timestamp);
+            added_trace->mutable_switch_core_op_decision()->set_over_threshold(pending.over_threshold);
+            added_trace->mutable_switch_core_op_decision()->set_switch_because_idle(pending.reason_idle);
+            added_trace->mutable_switch_core_op_decision()->set_over_timeout(pending.over_timeout);
+            break;
+        }
+        }
+    }
+}
+
 void SchedulerProfilerHandler::serialize_and_dump_proto()
 {
     auto file_env_var = std::getenv(PROFILER_FILE_ENV_VAR);
@@ -227,90 +382,54 @@ void SchedulerProfilerHandler::handle_trace(const AddStreamD2HTrace &trace)
 
 void SchedulerProfilerHandler::handle_trace(const FrameEnqueueH2DTrace &trace)
 {
-    log(JSON({
-        {"action", json_to_string(trace.name)},
-        {"timestamp", json_to_string(trace.timestamp)},
-        {"core_op_handle", json_to_string(trace.core_op_handle)},
-        {"queue_name", json_to_string(trace.queue_name)}
-    }));
-
-    std::lock_guard<std::mutex> lock(m_proto_lock);
-    auto added_trace = m_profiler_trace_proto.add_added_trace();
-    added_trace->mutable_frame_enqueue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__H2D);
-    added_trace->mutable_frame_enqueue()->set_stream_name(trace.queue_name);
-    added_trace->mutable_frame_enqueue()->set_core_op_handle(trace.core_op_handle);
-    added_trace->mutable_frame_enqueue()->set_time_stamp(trace.timestamp);
+    PendingTrace pending{};
+    pending.type = PendingTrace::Type::FRAME_ENQUEUE_H2D;
+    pending.timestamp = trace.timestamp;
+    pending.core_op_handle = trace.core_op_handle;
+    pending.queue_name = trace.queue_name;
+    capture_pending(std::move(pending));
 }
 
 void SchedulerProfilerHandler::handle_trace(const FrameDequeueH2DTrace &trace)
 {
-    log(JSON({
-        {"action", json_to_string(trace.name)},
-        {"timestamp", json_to_string(trace.timestamp)},
-        {"device_id", json_to_string(trace.device_id)},
-        {"core_op_handle", json_to_string(trace.core_op_handle)},
-        {"queue_name", json_to_string(trace.queue_name)}
-    }));
-
-    std::lock_guard<std::mutex> lock(m_proto_lock);
-    auto added_trace = m_profiler_trace_proto.add_added_trace();
-    added_trace->mutable_frame_dequeue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__H2D);
-    added_trace->mutable_frame_dequeue()->set_device_id(trace.device_id);
-    added_trace->mutable_frame_dequeue()->set_stream_name(trace.queue_name);
-    added_trace->mutable_frame_dequeue()->set_core_op_handle(trace.core_op_handle);
-    added_trace->mutable_frame_dequeue()->set_time_stamp(trace.timestamp);
+    PendingTrace pending{};
+    pending.type = PendingTrace::Type::FRAME_DEQUEUE_H2D;
+    pending.timestamp = trace.timestamp;
+    pending.core_op_handle = trace.core_op_handle;
+    pending.device_id = trace.device_id;
+    pending.queue_name = trace.queue_name;
+    capture_pending(std::move(pending));
 }
 
 void SchedulerProfilerHandler::handle_trace(const FrameDequeueD2HTrace &trace)
 {
-    log(JSON({
-        {"action", json_to_string(trace.name)},
-        {"timestamp", json_to_string(trace.timestamp)},
-        {"core_op_handle", json_to_string(trace.core_op_handle)},
-        {"queue_name", json_to_string(trace.queue_name)}
-    }));
-
-    std::lock_guard<std::mutex> lock(m_proto_lock);
-    auto added_trace = m_profiler_trace_proto.add_added_trace();
-    added_trace->mutable_frame_dequeue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__D2H);
-    added_trace->mutable_frame_dequeue()->set_stream_name(trace.queue_name);
-    added_trace->mutable_frame_dequeue()->set_core_op_handle(trace.core_op_handle);
-    added_trace->mutable_frame_dequeue()->set_time_stamp(trace.timestamp);
+    PendingTrace pending{};
+    pending.type = PendingTrace::Type::FRAME_DEQUEUE_D2H;
+    pending.timestamp = trace.timestamp;
+    pending.core_op_handle = trace.core_op_handle;
+    pending.queue_name = trace.queue_name;
+    capture_pending(std::move(pending));
 }
 
 void SchedulerProfilerHandler::handle_trace(const FrameEnqueueD2HTrace &trace)
 {
-    log(JSON({
-        {"action", json_to_string(trace.name)},
-        {"timestamp", json_to_string(trace.timestamp)},
-        {"device_id", json_to_string(trace.device_id)},
-        {"core_op_handle", json_to_string(trace.core_op_handle)},
-        {"queue_name", json_to_string(trace.queue_name)}
-    }));
-
-    std::lock_guard<std::mutex> lock(m_proto_lock);
-    auto added_trace = m_profiler_trace_proto.add_added_trace();
-    added_trace->mutable_frame_enqueue()->set_direction(ProtoProfilerStreamDirection::PROTO__STREAM_DIRECTION__D2H);
-    added_trace->mutable_frame_enqueue()->set_device_id(trace.device_id);
-    added_trace->mutable_frame_enqueue()->set_stream_name(trace.queue_name);
-    added_trace->mutable_frame_enqueue()->set_core_op_handle(trace.core_op_handle);
-    added_trace->mutable_frame_enqueue()->set_time_stamp(trace.timestamp);
+    PendingTrace pending{};
+    pending.type = PendingTrace::Type::FRAME_ENQUEUE_D2H;
+    pending.timestamp = trace.timestamp;
+    pending.core_op_handle = trace.core_op_handle;
+    pending.device_id = trace.device_id;
+    pending.queue_name = trace.queue_name;
+    capture_pending(std::move(pending));
 }
 
 void SchedulerProfilerHandler::handle_trace(const SwitchCoreOpTrace &trace)
 {
-    log(JSON({
-        {"action", json_to_string(trace.name)},
-        {"timestamp", json_to_string(trace.timestamp)},
-        {"device_id", json_to_string(trace.device_id)},
-        {"core_op_handle", json_to_string(trace.core_op_handle)}
-    }));
-
-    std::lock_guard<std::mutex> lock(m_proto_lock);
-    auto added_trace = m_profiler_trace_proto.add_added_trace();
-    added_trace->mutable_switched_core_op()->set_device_id(trace.device_id);
-    added_trace->mutable_switched_core_op()->set_new_core_op_handle(trace.core_op_handle);
-    added_trace->mutable_switched_core_op()->set_time_stamp(trace.timestamp);
+    PendingTrace pending{};
+    pending.type = PendingTrace::Type::SWITCH_CORE_OP;
+    pending.timestamp = trace.timestamp;
+    pending.core_op_handle = trace.core_op_handle;
+    pending.device_id = trace.device_id;
+    capture_pending(std::move(pending));
 }
 
 void SchedulerProfilerHandler::handle_trace(const SetCoreOpTimeoutTrace &trace)
@@ -357,24 +476,20 @@ void SchedulerProfilerHandler::handle_trace(const SetCoreOpPriorityTrace &trace)
 
 void SchedulerProfilerHandler::handle_trace(const OracleDecisionTrace &trace)
 {
-    log(JSON({
-        {"action", json_to_string(trace.name)},
-        {"reason", json_to_string(trace.reason_idle)},
-        {"core_op_handle", json_to_string(trace.core_op_handle)}
-    }));
-
-    std::lock_guard<std::mutex> lock(m_proto_lock);
-    auto added_trace = m_profiler_trace_proto.add_added_trace();
-    added_trace->mutable_switch_core_op_decision()->set_core_op_handle(trace.core_op_handle);
-    added_trace->mutable_switch_core_op_decision()->set_time_stamp(trace.timestamp);
-    added_trace->mutable_switch_core_op_decision()->set_over_threshold(trace.over_threshold);
-    added_trace->mutable_switch_core_op_decision()->set_switch_because_idle(trace.reason_idle);
-    added_trace->mutable_switch_core_op_decision()->set_over_timeout(trace.over_timeout);
+    PendingTrace pending{};
+    pending.type = PendingTrace::Type::ORACLE_DECISION;
+    pending.timestamp = trace.timestamp;
+    pending.core_op_handle = trace.core_op_handle;
+    pending.reason_idle = trace.reason_idle;
+    pending.over_threshold = trace.over_threshold;
+    pending.over_timeout = trace.over_timeout;
+    capture_pending(std::move(pending));
 }
 
 void SchedulerProfilerHandler::handle_trace(const DumpProfilerStateTrace &trace)
 {
     (void)trace;
+    flush_pending();
     serialize_and_dump_proto();
     m_profiler_trace_proto.Clear();
 }
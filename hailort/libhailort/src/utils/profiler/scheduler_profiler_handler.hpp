@@ -28,6 +28,10 @@
 
 #include "handler.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace hailort
 {
 class SchedulerProfilerHandler : public Handler
@@ -56,6 +60,35 @@ public:
     virtual void handle_trace(const InitProfilerProtoTrace&) override;
 
 private:
+    // Deferred capture for the per-frame (hot) trace types. Scheduler callbacks only append this
+    // plain struct under a short lock - no protobuf arena work, no spdlog formatting - and the
+    // background flush thread converts the backlog to the JSON log and the protobuf trace, so
+    // tracing no longer perturbs the scheduling it measures. The rare control-plane events
+    // (add/set/init/dump) keep the direct path; the trace file format is unchanged.
+    struct PendingTrace {
+        enum class Type : uint8_t {
+            FRAME_ENQUEUE_H2D,
+            FRAME_DEQUEUE_H2D,
+            FRAME_DEQUEUE_D2H,
+            FRAME_ENQUEUE_D2H,
+            SWITCH_CORE_OP,
+            ORACLE_DECISION,
+        };
+
+        Type type;
+        bool reason_idle;
+        bool over_threshold;
+        bool over_timeout;
+        uint32_t core_op_handle;
+        uint64_t timestamp;
+        std::string device_id;
+        std::string queue_name;
+    };
+
+    void capture_pending(PendingTrace &&pending);
+    void flush_pending();
+    void flush_thread_main();
+
     void log(JSON json);
     bool comma();
     void serialize_and_dump_proto();
@@ -65,6 +98,11 @@ private:
     std::atomic<bool> m_first_write;
     ProtoProfiler m_profiler_trace_proto;
     std::mutex m_proto_lock;
+
+    std::mutex m_pending_lock;
+    std::vector<PendingTrace> m_pending_traces;
+    std::atomic<bool> m_flush_stop{false};
+    std::thread m_flush_thread;
 };
 
 }
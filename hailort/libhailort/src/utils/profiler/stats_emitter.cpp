@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file stats_emitter.cpp
+ * @brief Implementation of the push-mode binary stats emitter
+ **/
+
+#include "utils/profiler/stats_emitter.hpp"
+
+#include "hailo/infer_result_cache.hpp"
+
+#include "common/os_utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace hailort
+{
+
+#define STATS_EMITTER_TARGET_ENV ("HAILO_STATS_EMITTER")
+#define STATS_EMITTER_INTERVAL_ENV ("HAILO_STATS_EMITTER_INTERVAL_MS")
+#define STATS_EMITTER_DEFAULT_INTERVAL_MS (1000)
+
+#pragma pack(push, 1)
+struct StatsFrameHeader {
+    char magic[4]; // 'HRST'
+    uint32_t version;
+    uint32_t pid;
+    uint32_t metrics_count;
+    // Since version 2 - process-wide result-cache aggregates (see InferResultCache)
+    uint64_t cache_hits;
+    uint64_t cache_misses;
+};
+#pragma pack(pop)
+
+bool StatsEmitter::is_enabled()
+{
+#if defined(__linux__)
+    const auto *target = std::getenv(STATS_EMITTER_TARGET_ENV);
+    return (nullptr != target) && ('\0' != target[0]);
+#else
+    return false;
+#endif
+}
+
+StatsEmitter::StatsEmitter(MetricsProvider provider) :
+    m_provider(std::move(provider))
+{
+    if (is_enabled() && m_provider) {
+        m_thread = std::thread(&StatsEmitter::emitter_main, this);
+    }
+}
+
+StatsEmitter::~StatsEmitter()
+{
+    m_should_stop = true;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void StatsEmitter::emitter_main()
+{
+#if defined(__linux__)
+    OsUtils::set_current_thread_name("STATS_EMIT");
+
+    // Target parse - host:port
+    const std::string target(std::getenv(STATS_EMITTER_TARGET_ENV));
+    const auto colon = target.rfind(':');
+    if (std::string::npos == colon) {
+        LOGGER__ERROR("Invalid {} format (expected host:port)", STATS_EMITTER_TARGET_ENV);
+        return;
+    }
+    const auto host = target.substr(0, colon);
+    const auto port = static_cast<uint16_t>(strtoul(target.c_str() + colon + 1, nullptr, 10));
+
+    struct sockaddr_in addr {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (1 != inet_pton(AF_INET, host.c_str(), &addr.sin_addr)) {
+        LOGGER__ERROR("Invalid {} host", STATS_EMITTER_TARGET_ENV);
+        return;
+    }
+
+    const auto socket_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (socket_fd < 0) {
+        LOGGER__ERROR("Failed creating stats emitter socket (errno {})", errno);
+        return;
+    }
+
+    const auto *interval_env = std::getenv(STATS_EMITTER_INTERVAL_ENV);
+    const auto interval = std::chrono::milliseconds((nullptr != interval_env) ?
+        strtoul(interval_env, nullptr, 10) : STATS_EMITTER_DEFAULT_INTERVAL_MS);
+
+    std::vector<uint8_t> frame;
+    while (!m_should_stop) {
+        const auto metrics = m_provider();
+
+        frame.resize(sizeof(StatsFrameHeader) + (metrics.size() * sizeof(hailo_scheduler_core_op_metrics_t)));
+        auto *header = reinterpret_cast<StatsFrameHeader *>(frame.data());
+        memcpy(header->magic, "HRST", sizeof(header->magic));
+        header->version = 2;
+        header->pid = OsUtils::get_curr_pid();
+        header->metrics_count = static_cast<uint32_t>(metrics.size());
+        header->cache_hits = InferResultCache::total_hits();
+        header->cache_misses = InferResultCache::total_misses();
+        if (!metrics.empty()) {
+            memcpy(frame.data() + sizeof(StatsFrameHeader), metrics.data(),
+                metrics.size() * sizeof(hailo_scheduler_core_op_metrics_t));
+        }
+
+        (void)sendto(socket_fd, frame.data(), frame.size(), 0,
+            reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr));
+
+        // Responsive shutdown within the interval
+        auto remaining = interval;
+        while ((remaining.count() > 0) && !m_should_stop) {
+            const auto sleep_slice = std::min<std::chrono::milliseconds>(remaining, std::chrono::milliseconds(100));
+            std::this_thread::sleep_for(sleep_slice);
+            remaining -= sleep_slice;
+        }
+    }
+
+    (void)close(socket_fd);
+#endif /* defined(__linux__) */
+}
+
+} /* namespace hailort */
@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file stats_emitter.hpp
+ * @brief Push-mode fleet telemetry: a background thread periodically packs the scheduler metrics
+ *        into compact binary frames and sends them over UDP - no files, no polling agents.
+ *        Enabled by HAILO_STATS_EMITTER=<host:port> (interval via HAILO_STATS_EMITTER_INTERVAL_MS,
+ *        default 1000). Frame layout: header {magic 'HRST', version, pid, metrics_count} followed
+ *        by hailo_scheduler_core_op_metrics_t records.
+ **/
+
+#ifndef _HAILO_STATS_EMITTER_HPP_
+#define _HAILO_STATS_EMITTER_HPP_
+
+#include "hailo/hailort.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace hailort
+{
+
+class StatsEmitter final
+{
+public:
+    using MetricsProvider = std::function<std::vector<hailo_scheduler_core_op_metrics_t>()>;
+
+    // Returns whether the emitter is enabled by the environment
+    static bool is_enabled();
+
+    // Starts the push thread; @a provider is sampled every interval. No-op when disabled.
+    StatsEmitter(MetricsProvider provider);
+    ~StatsEmitter();
+
+    StatsEmitter(const StatsEmitter &) = delete;
+    StatsEmitter &operator=(const StatsEmitter &) = delete;
+
+private:
+    void emitter_main();
+
+    MetricsProvider m_provider;
+    std::atomic<bool> m_should_stop{false};
+    std::thread m_thread;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_STATS_EMITTER_HPP_ */
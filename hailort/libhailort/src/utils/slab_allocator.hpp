@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file slab_allocator.hpp
+ * @brief Fixed-size block recycler for per-frame control objects. A slab carves one arena up
+ *        front and hands blocks out LIFO (the most recently freed block is cache warm); when the
+ *        slab is exhausted - or asked for a foreign size - it falls back to the global heap, so
+ *        it only ever bounds the fast path, never correctness. Intended through
+ *        SlabAllocator<T> + std::allocate_shared for the pipeline's per-frame wrappers, where the
+ *        steady-state frame rate otherwise costs one heap pair per frame.
+ **/
+
+#ifndef _HAILO_SLAB_ALLOCATOR_HPP_
+#define _HAILO_SLAB_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hailort
+{
+
+class BlockSlab final
+{
+public:
+    explicit BlockSlab(size_t blocks_capacity) :
+        m_blocks_capacity(blocks_capacity)
+    {}
+
+    BlockSlab(const BlockSlab &) = delete;
+    BlockSlab &operator=(const BlockSlab &) = delete;
+
+    void *allocate(size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_arena.empty()) {
+                // The block size is locked in by the first allocation (allocate_shared's combined
+                // object + control block size is implementation defined)
+                m_block_size = size;
+                m_arena.resize(m_block_size * m_blocks_capacity);
+                m_free_blocks.reserve(m_blocks_capacity);
+                for (size_t i = 0; i < m_blocks_capacity; i++) {
+                    m_free_blocks.emplace_back(m_arena.data() + (i * m_block_size));
+                }
+            }
+            if ((size == m_block_size) && (!m_free_blocks.empty())) {
+                auto *block = m_free_blocks.back();
+                m_free_blocks.pop_back();
+                return block;
+            }
+        }
+        // Exhausted (or foreign size) - the heap keeps correctness, the slab only bounds the
+        // fast path
+        return ::operator new(size);
+    }
+
+    void deallocate(void *block, size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto *bytes = static_cast<uint8_t *>(block);
+            if ((!m_arena.empty()) && (bytes >= m_arena.data()) && (bytes < (m_arena.data() + m_arena.size()))) {
+                m_free_blocks.emplace_back(bytes);
+                return;
+            }
+        }
+        ::operator delete(block);
+        (void)size;
+    }
+
+private:
+    const size_t m_blocks_capacity;
+    size_t m_block_size = 0;
+    std::vector<uint8_t> m_arena;
+    std::vector<uint8_t *> m_free_blocks;
+    std::mutex m_mutex;
+};
+
+// Minimal C++14 allocator over a shared BlockSlab, for std::allocate_shared. The slab must
+// outlive every object allocated through it - sharing ownership (shared_ptr) is the easy way.
+template <typename T>
+class SlabAllocator
+{
+public:
+    using value_type = T;
+
+    explicit SlabAllocator(std::shared_ptr<BlockSlab> slab) :
+        m_slab(std::move(slab))
+    {}
+
+    template <typename U>
+    SlabAllocator(const SlabAllocator<U> &other) :
+        m_slab(other.m_slab)
+    {}
+
+    T *allocate(size_t n)
+    {
+        return static_cast<T *>(m_slab->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, size_t n)
+    {
+        m_slab->deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const SlabAllocator<U> &other) const { return m_slab == other.m_slab; }
+    template <typename U>
+    bool operator!=(const SlabAllocator<U> &other) const { return m_slab != other.m_slab; }
+
+    std::shared_ptr<BlockSlab> m_slab;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_SLAB_ALLOCATOR_HPP_ */
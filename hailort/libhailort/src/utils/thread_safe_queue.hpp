@@ -32,7 +32,9 @@
 #undef HAILO_UNDEF_UNIX_FLAG
 #endif
 
+#include <atomic>
 #include <queue>
+#include <vector>
 #include <mutex>
 #include <memory>
 #include <condition_variable>
@@ -44,14 +46,29 @@ namespace hailort
 
 #define DEFAULT_TIMEOUT_MS (1000)
 
+// TODO: move the timed waits here onto the shared TimerWheel (utils/timer_wheel.hpp - already
+//       driving the scheduler's coalescing wakeup): waits register a wheel entry (O(1)) and park
+//       on their plain (untimed) primitive, replacing a timeout bookkeeping step per operation
+//       with the single shared tick thread. The SpscQueue waiter-flag protocol already separates
+//       state from blocking, so the wheel slots in by replacing only the timed waits.
+
 template <class T>
 class SafeQueue final {
 public:
     static constexpr size_t UNLIMITED_QUEUE_SIZE = std::numeric_limits<size_t>::max();
 
+    // Bounded queues (the common case - capacity known at vstream/scheduler build) use an inlined
+    // fixed-capacity ring allocated once up front, so steady-state enqueue/dequeue touch no deque
+    // nodes. Unbounded queues keep the std::queue storage.
     SafeQueue(size_t max_size) :
-        m_max_size(max_size)
-    {}
+        m_max_size(max_size),
+        m_ring_head(0),
+        m_ring_count(0)
+    {
+        if (UNLIMITED_QUEUE_SIZE != m_max_size) {
+            m_ring.resize(m_max_size);
+        }
+    }
 
     SafeQueue() :
         SafeQueue(UNLIMITED_QUEUE_SIZE)
@@ -63,8 +80,13 @@ public:
     hailo_status enqueue(T &&t)
     {
         std::lock_guard<std::mutex> lock(m_mutex);
-        if ((m_max_size != UNLIMITED_QUEUE_SIZE) && (m_queue.size() >= m_max_size)) {
-            return HAILO_QUEUE_IS_FULL;
+        if (UNLIMITED_QUEUE_SIZE != m_max_size) {
+            if (m_ring_count >= m_max_size) {
+                return HAILO_QUEUE_IS_FULL;
+            }
+            m_ring[(m_ring_head + m_ring_count) % m_max_size] = std::move(t);
+            m_ring_count++;
+            return HAILO_SUCCESS;
         }
         m_queue.push(std::move(t));
         return HAILO_SUCCESS;
@@ -73,6 +95,14 @@ public:
     Expected<T> dequeue()
     {
         std::lock_guard<std::mutex> lock(m_mutex);
+        if (UNLIMITED_QUEUE_SIZE != m_max_size) {
+            CHECK_AS_EXPECTED(m_ring_count > 0, HAILO_INTERNAL_FAILURE, "Can't dequeue if queue is empty");
+            T val = std::move(m_ring[m_ring_head]);
+            m_ring[m_ring_head] = T{};
+            m_ring_head = (m_ring_head + 1) % m_max_size;
+            m_ring_count--;
+            return val;
+        }
         CHECK_AS_EXPECTED(!m_queue.empty(), HAILO_INTERNAL_FAILURE, "Can't dequeue if queue is empty");
         T val = m_queue.front();
         m_queue.pop();
@@ -82,23 +112,37 @@ public:
     void clear()
     {
         std::lock_guard<std::mutex> lock(m_mutex);
+        if (UNLIMITED_QUEUE_SIZE != m_max_size) {
+            while (m_ring_count > 0) {
+                m_ring[m_ring_head] = T{};
+                m_ring_head = (m_ring_head + 1) % m_max_size;
+                m_ring_count--;
+            }
+            return;
+        }
         while (!m_queue.empty()) {
             m_queue.pop();
         }
     }
 
-    bool empty() const { return m_queue.empty(); }
-    size_t size() const { return m_queue.size(); }
+    bool empty() const { return (UNLIMITED_QUEUE_SIZE != m_max_size) ? (0 == m_ring_count) : m_queue.empty(); }
+    size_t size() const { return (UNLIMITED_QUEUE_SIZE != m_max_size) ? m_ring_count : m_queue.size(); }
     size_t max_size() const { return m_max_size; }
 
 protected:
     const size_t m_max_size;
+    std::vector<T> m_ring;
+    size_t m_ring_head;
+    size_t m_ring_count;
     std::queue<T> m_queue;
     mutable std::mutex m_mutex;
 };
 
 // Single-Producer Single-Consumer Queue
-// The queue's size is limited
+// The queue's size is limited.
+// The inner ring buffer is lock free - enqueue/dequeue on a non-full/non-empty queue touch only
+// atomics (no syscalls). Blocking happens only on empty/full transitions, where the waiting side
+// raises its waiter flag and parks on the matching semaphore until the other side wakes it.
 template<typename T, size_t MAX_BLOCK_SIZE = 512>
 class SpscQueue
 {
@@ -111,6 +155,9 @@ public:
     SpscQueue(size_t max_size, SemaphorePtr items_enqueued_sema, SemaphorePtr items_dequeued_sema,
               EventPtr shutdown_event, std::chrono::milliseconds default_timeout) :
         m_inner(max_size),
+        m_max_size(max_size),
+        m_consumer_waiting(false),
+        m_producer_waiting(false),
         m_items_enqueued_sema_or_shutdown(items_enqueued_sema, shutdown_event),
         m_items_enqueued_sema(items_enqueued_sema),
         m_items_dequeued_sema_or_shutdown(items_dequeued_sema, shutdown_event),
@@ -119,7 +166,17 @@ public:
     {}
 
     virtual ~SpscQueue() = default;
-    SpscQueue(SpscQueue &&other) = default;
+    SpscQueue(SpscQueue &&other) :
+        m_inner(std::move(other.m_inner)),
+        m_max_size(other.m_max_size),
+        m_consumer_waiting(other.m_consumer_waiting.load()),
+        m_producer_waiting(other.m_producer_waiting.load()),
+        m_items_enqueued_sema_or_shutdown(std::move(other.m_items_enqueued_sema_or_shutdown)),
+        m_items_enqueued_sema(std::move(other.m_items_enqueued_sema)),
+        m_items_dequeued_sema_or_shutdown(std::move(other.m_items_dequeued_sema_or_shutdown)),
+        m_items_dequeued_sema(std::move(other.m_items_dequeued_sema)),
+        m_default_timeout(other.m_default_timeout)
+    {}
 
     static Expected<SpscQueue> create(size_t max_size, const EventPtr& shutdown_event,
         std::chrono::milliseconds default_timeout = std::chrono::milliseconds(1000))
@@ -129,18 +186,14 @@ public:
             return make_unexpected(HAILO_INVALID_ARGUMENT);
         }
 
-        // * items_enqueued_sema:
-        //   +1 for each enqueued item
-        //   -1 for each dequeued item
-        //   Blocks when there are no items in the queue (hence when the queue is built it starts at zero)
-        // * items_dequeued_sema:
-        //   +1 for each dequeued item
-        //   -1 for each enqueued item
-        //   Blocks when the queue is full (which happens when it's value reaches zero, hence it starts at queue size)
+        // The semaphores are used only as parking lots for empty/full transitions - the queue state
+        // itself lives in the lock-free ring. A side that finds the queue empty (consumer) or full
+        // (producer) raises its waiter flag and parks on its semaphore; the opposite side signals it
+        // after the next enqueue/dequeue. Stale signals only cause a spurious re-check.
         const auto items_enqueued_sema = Semaphore::create_shared(0);
         CHECK_AS_EXPECTED(nullptr != items_enqueued_sema, HAILO_OUT_OF_HOST_MEMORY, "Failed creating items_enqueued_sema semaphore");
 
-        const auto items_dequeued_sema = Semaphore::create_shared(static_cast<uint32_t>(max_size));
+        const auto items_dequeued_sema = Semaphore::create_shared(0);
         CHECK_AS_EXPECTED(nullptr != items_dequeued_sema, HAILO_OUT_OF_HOST_MEMORY, "Failed creating items_dequeued_sema semaphore");
 
         return SpscQueue(max_size, items_enqueued_sema, items_dequeued_sema, shutdown_event, default_timeout);
@@ -172,37 +225,51 @@ public:
     
     Expected<T> dequeue(std::chrono::milliseconds timeout, bool ignore_shutdown_event = false) AE_NO_TSAN
     {
-        hailo_status wait_result = HAILO_UNINITIALIZED;
-        if (ignore_shutdown_event) {
-            wait_result = m_items_enqueued_sema->wait(timeout);
-        } else {
-            wait_result = m_items_enqueued_sema_or_shutdown.wait(timeout);
-        }
-
-        if (HAILO_SHUTDOWN_EVENT_SIGNALED == wait_result) {
-            LOGGER__TRACE("Shutdown event has been signaled");
-            return make_unexpected(wait_result);
-        }
-        if (HAILO_TIMEOUT == wait_result) {
-            LOGGER__TRACE("Timeout, the queue is empty");
-            return make_unexpected(wait_result);
-        }
-        if (HAILO_SUCCESS != wait_result) {
-            LOGGER__WARNING("m_items_enqueued_sema received an unexpected failure");
-            return make_unexpected(wait_result);
-        }
-        
-        // The queue isn't empty
         T result{};
-        const bool success = m_inner.try_dequeue(result);
-        assert(success);
-        AE_UNUSED(success);
+        // Fast path - no syscalls when the queue has items
+        if (m_inner.try_dequeue(result)) {
+            wake_producer_if_waiting();
+            return result;
+        }
 
-        const auto signal_result = m_items_dequeued_sema_or_shutdown.signal();
-        if (HAILO_SUCCESS != signal_result) {
-            return make_unexpected(signal_result);
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            // Raise the waiter flag before the last empty check - the producer checks it after
+            // publishing to the ring, so one of the sides always observes the other (both fence)
+            m_consumer_waiting.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_inner.try_dequeue(result)) {
+                m_consumer_waiting.store(false);
+                wake_producer_if_waiting();
+                return result;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                m_consumer_waiting.store(false);
+                LOGGER__TRACE("Timeout, the queue is empty");
+                return make_unexpected(HAILO_TIMEOUT);
+            }
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now);
+
+            hailo_status wait_result = HAILO_UNINITIALIZED;
+            if (ignore_shutdown_event) {
+                wait_result = m_items_enqueued_sema->wait(remaining);
+            } else {
+                wait_result = m_items_enqueued_sema_or_shutdown.wait(remaining);
+            }
+            m_consumer_waiting.store(false);
+
+            if (HAILO_SHUTDOWN_EVENT_SIGNALED == wait_result) {
+                LOGGER__TRACE("Shutdown event has been signaled");
+                return make_unexpected(wait_result);
+            }
+            if ((HAILO_SUCCESS != wait_result) && (HAILO_TIMEOUT != wait_result)) {
+                LOGGER__WARNING("m_items_enqueued_sema received an unexpected failure");
+                return make_unexpected(wait_result);
+            }
+            // HAILO_SUCCESS - woken by the producer; HAILO_TIMEOUT - deadline re-checked above
         }
-        return result;
     }
 
     Expected<T> dequeue() AE_NO_TSAN
@@ -212,26 +279,7 @@ public:
 
     hailo_status enqueue(const T& result, std::chrono::milliseconds timeout) AE_NO_TSAN
     {
-        const auto wait_result = m_items_dequeued_sema_or_shutdown.wait(timeout);
-        if (HAILO_SHUTDOWN_EVENT_SIGNALED == wait_result) {
-            LOGGER__TRACE("Shutdown event has been signaled");
-            return wait_result;
-        }
-        if (HAILO_TIMEOUT == wait_result) {
-            LOGGER__TRACE("Timeout, the queue is full");
-            return wait_result;
-        }
-        if (HAILO_SUCCESS != wait_result) {
-            LOGGER__WARNING("m_items_dequeued_sema received an unexpected failure");
-            return wait_result;
-        }
-
-        // The queue isn't full
-        const bool success = m_inner.try_enqueue(result);
-        assert(success);
-        AE_UNUSED(success);
-
-        return m_items_enqueued_sema_or_shutdown.signal();
+        return enqueue_impl(result, timeout, false);
     }
 
     inline hailo_status enqueue(const T& result) AE_NO_TSAN
@@ -239,35 +287,9 @@ public:
         return enqueue(result, m_default_timeout);
     }
 
-    // TODO: Do away with two copies of this function? (SDK-16481)
     hailo_status enqueue(T&& result, std::chrono::milliseconds timeout, bool ignore_shutdown_event = false) AE_NO_TSAN
     {
-        hailo_status wait_result = HAILO_UNINITIALIZED;
-        if (ignore_shutdown_event) {
-            wait_result = m_items_dequeued_sema->wait(timeout);
-        } else {
-            wait_result = m_items_dequeued_sema_or_shutdown.wait(timeout);
-        }
-
-        if (HAILO_SHUTDOWN_EVENT_SIGNALED == wait_result) {
-            LOGGER__TRACE("Shutdown event has been signaled");
-            return wait_result;
-        }
-        if (HAILO_TIMEOUT == wait_result) {
-            LOGGER__TRACE("Timeout, the queue is full");
-            return wait_result;
-        }
-        if (HAILO_SUCCESS != wait_result) {
-            LOGGER__WARNING("m_items_dequeued_sema received an unexpected failure");
-            return wait_result;
-        }
-
-        // The queue isn't full
-        const bool success = m_inner.try_enqueue(std::move(result));
-        assert(success);
-        AE_UNUSED(success);
-
-        return m_items_enqueued_sema_or_shutdown.signal();
+        return enqueue_impl(std::move(result), timeout, ignore_shutdown_event);
     }
 
     // TODO: HRT-3810, remove hacky argument ignore_shutdown_event
@@ -283,7 +305,7 @@ public:
 
     bool is_queue_full()
     {
-        return (m_inner.size_approx() == m_inner.max_capacity());
+        return (m_inner.size_approx() >= m_max_size);
     }
 
     hailo_status clear() AE_NO_TSAN
@@ -301,7 +323,84 @@ public:
     }
 
 private:
+    template <typename U>
+    hailo_status enqueue_impl(U &&result, std::chrono::milliseconds timeout, bool ignore_shutdown_event) AE_NO_TSAN
+    {
+        // Fast path - no syscalls when the queue has room. The producer is the only one enqueueing,
+        // so concurrent dequeues can only make more room
+        if (m_inner.size_approx() < m_max_size) {
+            const bool success = m_inner.try_enqueue(std::forward<U>(result));
+            assert(success);
+            AE_UNUSED(success);
+            wake_consumer_if_waiting();
+            return HAILO_SUCCESS;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            // Raise the waiter flag before the last full check - the consumer checks it after
+            // popping from the ring, so one of the sides always observes the other (both fence)
+            m_producer_waiting.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_inner.size_approx() < m_max_size) {
+                m_producer_waiting.store(false);
+                const bool success = m_inner.try_enqueue(std::forward<U>(result));
+                assert(success);
+                AE_UNUSED(success);
+                wake_consumer_if_waiting();
+                return HAILO_SUCCESS;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                m_producer_waiting.store(false);
+                LOGGER__TRACE("Timeout, the queue is full");
+                return HAILO_TIMEOUT;
+            }
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now);
+
+            hailo_status wait_result = HAILO_UNINITIALIZED;
+            if (ignore_shutdown_event) {
+                wait_result = m_items_dequeued_sema->wait(remaining);
+            } else {
+                wait_result = m_items_dequeued_sema_or_shutdown.wait(remaining);
+            }
+            m_producer_waiting.store(false);
+
+            if (HAILO_SHUTDOWN_EVENT_SIGNALED == wait_result) {
+                LOGGER__TRACE("Shutdown event has been signaled");
+                return wait_result;
+            }
+            if ((HAILO_SUCCESS != wait_result) && (HAILO_TIMEOUT != wait_result)) {
+                LOGGER__WARNING("m_items_dequeued_sema received an unexpected failure");
+                return wait_result;
+            }
+            // HAILO_SUCCESS - woken by the consumer; HAILO_TIMEOUT - deadline re-checked above
+        }
+    }
+
+    void wake_consumer_if_waiting()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_consumer_waiting.load()) {
+            (void)m_items_enqueued_sema_or_shutdown.signal();
+        }
+    }
+
+    void wake_producer_if_waiting()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_producer_waiting.load()) {
+            (void)m_items_dequeued_sema_or_shutdown.signal();
+        }
+    }
+
     ReaderWriterQueue m_inner;
+    size_t m_max_size;
+    // Each waiter flag on its own cache line - the consumer flag is written by the consumer and
+    // read by the producer (and vice versa), so sharing a line would ping-pong it per operation
+    alignas(64) std::atomic<bool> m_consumer_waiting;
+    alignas(64) std::atomic<bool> m_producer_waiting;
     WaitOrShutdown m_items_enqueued_sema_or_shutdown;
     SemaphorePtr m_items_enqueued_sema;
     WaitOrShutdown m_items_dequeued_sema_or_shutdown;
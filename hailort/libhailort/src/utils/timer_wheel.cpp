@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file timer_wheel.cpp
+ * @brief Implementation of the shared hashed timer wheel
+ **/
+
+#include "utils/timer_wheel.hpp"
+
+#include "common/os_utils.hpp"
+
+#include <vector>
+
+namespace hailort
+{
+
+// Out-of-class definitions for the odr-used constants (C++14)
+const TimerWheel::TimerId TimerWheel::INVALID_TIMER_ID;
+const size_t TimerWheel::SLOTS_COUNT;
+const uint64_t TimerWheel::TICK_DURATION_MS;
+
+uint64_t TimerWheel::tick_of(std::chrono::steady_clock::time_point time_point)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        time_point.time_since_epoch()).count()) / TICK_DURATION_MS;
+}
+
+TimerWheel &TimerWheel::instance()
+{
+    static TimerWheel wheel;
+    return wheel;
+}
+
+TimerWheel::~TimerWheel()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_cv.notify_all();
+    if (m_tick_thread.joinable()) {
+        m_tick_thread.join();
+    }
+}
+
+TimerWheel::TimerId TimerWheel::register_timer(std::chrono::milliseconds timeout,
+    std::function<void()> on_expire)
+{
+    // Round up - firing early would wake a waiter before its deadline
+    const auto deadline = std::chrono::steady_clock::now() + timeout +
+        std::chrono::milliseconds(TICK_DURATION_MS);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ensure_tick_thread();
+    const auto timer_id = m_next_timer_id++;
+    m_slots[tick_of(deadline) % SLOTS_COUNT].emplace(timer_id, Entry{deadline, std::move(on_expire)});
+    m_pending_count++;
+    m_cv.notify_one();
+    return timer_id;
+}
+
+void TimerWheel::cancel(TimerId timer_id)
+{
+    if (INVALID_TIMER_ID == timer_id) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto &slot : m_slots) {
+        if (slot.erase(timer_id) > 0) {
+            m_pending_count--;
+            return;
+        }
+    }
+    // Not found - the timer already expired (or was cancelled); nothing to do
+}
+
+void TimerWheel::ensure_tick_thread()
+{
+    if (!m_tick_thread.joinable()) {
+        m_tick_thread = std::thread([this]() { tick_thread_main(); });
+    }
+}
+
+void TimerWheel::tick_thread_main()
+{
+    OsUtils::configure_current_thread("TIMER_WHEEL");
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_last_processed_tick = tick_of(std::chrono::steady_clock::now());
+    while (!m_shutdown) {
+        if (0 == m_pending_count) {
+            // Empty wheel parks untimed - registration wakes us
+            m_cv.wait(lock, [this]() { return (m_pending_count > 0) || m_shutdown; });
+            m_last_processed_tick = tick_of(std::chrono::steady_clock::now()) - 1;
+            continue;
+        }
+        m_cv.wait_for(lock, std::chrono::milliseconds(TICK_DURATION_MS));
+        if (m_shutdown) {
+            break;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        // Only fully elapsed ticks are processed (a tick's entries are all due once it ended) -
+        // processing the current, still-running tick would leave its not-yet-due entries stranded
+        // until the next wheel revolution
+        const auto last_elapsed_tick = tick_of(now) - 1;
+        if (last_elapsed_tick <= m_last_processed_tick) {
+            continue;
+        }
+        // Each slot repeats every SLOTS_COUNT ticks - a longer gap (late wakeup) still only needs
+        // one pass over the whole wheel
+        const auto ticks_to_process = std::min<uint64_t>(last_elapsed_tick - m_last_processed_tick, SLOTS_COUNT);
+
+        std::vector<std::function<void()>> expired;
+        for (uint64_t tick = last_elapsed_tick - ticks_to_process + 1; tick <= last_elapsed_tick; tick++) {
+            auto &slot = m_slots[tick % SLOTS_COUNT];
+            for (auto entry = slot.begin(); entry != slot.end();) {
+                if (entry->second.deadline <= now) {
+                    expired.emplace_back(std::move(entry->second.on_expire));
+                    entry = slot.erase(entry);
+                    m_pending_count--;
+                } else {
+                    // Belongs to a later wheel revolution
+                    entry++;
+                }
+            }
+        }
+        m_last_processed_tick = last_elapsed_tick;
+
+        if (!expired.empty()) {
+            // Callbacks run outside the lock, so they may register/cancel freely
+            lock.unlock();
+            for (auto &on_expire : expired) {
+                on_expire();
+            }
+            lock.lock();
+        }
+    }
+}
+
+} /* namespace hailort */
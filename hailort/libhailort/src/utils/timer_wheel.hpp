@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2020-2022 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file timer_wheel.hpp
+ * @brief Hashed timer wheel shared across the process. Waiters register a deadline callback
+ *        (O(1)) and park on their plain (untimed) primitive; one tick thread expires due entries
+ *        and invokes the callbacks, replacing a timed wait per blocked operation with a single
+ *        shared timing source. The tick thread is spawned lazily on the first registration and
+ *        parks untimed while the wheel is empty.
+ **/
+
+#ifndef _HAILO_TIMER_WHEEL_HPP_
+#define _HAILO_TIMER_WHEEL_HPP_
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace hailort
+{
+
+class TimerWheel final
+{
+public:
+    using TimerId = uint64_t;
+    static const TimerId INVALID_TIMER_ID = 0;
+
+    static TimerWheel &instance();
+
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+    ~TimerWheel();
+
+    // Registers @a on_expire to run once @a timeout elapsed (rounded up to the tick resolution).
+    // The callback runs on the wheel's tick thread - it must be short and must not block on the
+    // wheel itself (signalling a cv/event is the intended use). Returns an id for cancel().
+    TimerId register_timer(std::chrono::milliseconds timeout, std::function<void()> on_expire);
+
+    // Cancels a pending timer. A timer whose callback already fired (or is firing) is a no-op -
+    // callers' wakeup predicates must tolerate a spurious late callback.
+    void cancel(TimerId timer_id);
+
+private:
+    TimerWheel() = default;
+
+    static uint64_t tick_of(std::chrono::steady_clock::time_point time_point);
+
+    // Must be called with m_mutex held
+    void ensure_tick_thread();
+    void tick_thread_main();
+
+    static const size_t SLOTS_COUNT = 256;
+    static const uint64_t TICK_DURATION_MS = 1;
+
+    struct Entry {
+        std::chrono::steady_clock::time_point deadline;
+        std::function<void()> on_expire;
+    };
+
+    // Deadline tick (mod SLOTS_COUNT) -> pending entries. An id map per slot keeps both
+    // registration and cancellation O(1) amortized.
+    std::array<std::map<TimerId, Entry>, SLOTS_COUNT> m_slots;
+    size_t m_pending_count = 0;
+    TimerId m_next_timer_id = 1;
+    uint64_t m_last_processed_tick = 0;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::thread m_tick_thread;
+    bool m_shutdown = false;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TIMER_WHEEL_HPP_ */
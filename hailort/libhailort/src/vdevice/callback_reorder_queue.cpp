@@ -8,67 +8,68 @@
 
 #include "callback_reorder_queue.hpp"
 
+#include <cassert>
+#include <thread>
+
 namespace hailort
 {
 
 TransferDoneCallback CallbackReorderQueue::wrap_callback(const TransferDoneCallback &original)
 {
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
-    const uint64_t current_callback_index = m_registered_callbacks++;
+    const uint64_t current_callback_index = m_registered_callbacks.fetch_add(1);
 
     return [this, original, current_callback_index](hailo_status status) {
-        // Push callback without calling it yet.
-        push_callback(std::make_pair(current_callback_index, [original, status]() {
+        publish_and_drain(current_callback_index, [original, status]() {
             return original(status);
-        }));
-
-        // Then, call the queued callbacks in order (if there is ready callback).
-        call_queued_callbacks_in_order();
+        });
     };
 }
 
 void CallbackReorderQueue::cancel_last_callback()
 {
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
-    assert(m_called_callbacks < m_registered_callbacks);
-    m_registered_callbacks--;
-}
-
-void CallbackReorderQueue::push_callback(const Callback &callback)
-{
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
-    assert(m_callbacks_queue.size() < m_max_size);
-    m_callbacks_queue.push(callback);
+    const auto previous_registered = m_registered_callbacks.fetch_sub(1);
+    (void)previous_registered;
+    assert(m_called_callbacks.load() < previous_registered);
 }
 
-void CallbackReorderQueue::call_queued_callbacks_in_order()
+void CallbackReorderQueue::publish_and_drain(uint64_t callback_index, std::function<void()> &&callback)
 {
-    // Allow only one thread to execute the callbacks.
-    std::lock_guard<std::mutex> callbacks_lock(m_callbacks_mutex);
-
-    while (auto callback = pop_ready_callback()) {
-        callback->second();
-    }
-}
+    // The capacity bounds in-flight callbacks, so this slot's previous round was already consumed
+    auto &slot = slot_of(callback_index);
+    assert((callback_index - m_called_callbacks.load()) < m_capacity);
+    slot.callback = std::move(callback);
+    slot.ready_marker.store(callback_index + 1, std::memory_order_release);
 
-Expected<CallbackReorderQueue::Callback> CallbackReorderQueue::pop_ready_callback()
-{
-    std::lock_guard<std::mutex> lock_guard(m_queue_mutex);
+    // Single drainer at a time. After releasing the drain flag we re-check for slots published
+    // concurrently with the release, so no ready callback is left behind.
+    while (true) {
+        if (m_draining.exchange(true, std::memory_order_acquire)) {
+            // Another thread is draining - it will observe our published slot (or we will retake
+            // the flag below if it released it before our publish became visible)
+            if (slot_of(m_called_callbacks.load()).ready_marker.load(std::memory_order_acquire) !=
+                (m_called_callbacks.load() + 1)) {
+                return;
+            }
+            // A ready callback is still pending - retry taking the drain flag
+            std::this_thread::yield();
+            continue;
+        }
 
-    if (m_callbacks_queue.empty()) {
-        return make_unexpected(HAILO_NOT_AVAILABLE);
-    }
+        // We own the drain flag - call the ready prefix in registration order
+        auto next_to_call = m_called_callbacks.load();
+        while (slot_of(next_to_call).ready_marker.load(std::memory_order_acquire) == (next_to_call + 1)) {
+            auto ready_callback = std::move(slot_of(next_to_call).callback);
+            next_to_call++;
+            m_called_callbacks.store(next_to_call);
+            ready_callback();
+        }
+        m_draining.store(false, std::memory_order_release);
 
-    if (m_callbacks_queue.top().first != m_called_callbacks) {
-        // We need to wait until top() contains callback with index - m_called_callbacks.
-        return make_unexpected(HAILO_NOT_AVAILABLE);
+        // Re-check - a publisher may have landed between our last scan and the flag release
+        if (slot_of(next_to_call).ready_marker.load(std::memory_order_acquire) != (next_to_call + 1)) {
+            return;
+        }
     }
-
-    auto next_callback = m_callbacks_queue.top();
-    m_callbacks_queue.pop();
-
-    m_called_callbacks++;
-    return next_callback;
 }
 
 } /* namespace hailort */
@@ -6,7 +6,10 @@
  * @file callback_reorder_queue.hpp
  * @brief When using multiple devices with async API, we may get interrupt for some input/output stream out of order
  *        (For example - the second device may be faster than the first).
- *        To ensure the order of the callbacks, we put the callbacks in queue and call them in the same order inserted.
+ *        To ensure the order of the callbacks, we put the callbacks in a sequence-numbered ring and
+ *        call them in the same order inserted. The completion path is lock free - a completing
+ *        thread publishes its slot with a release store and at most one thread at a time drains the
+ *        ready prefix of the ring.
  **/
 
 #ifndef _HAILO_CALLBACK_REORDER_QUEUE_HPP_
@@ -14,8 +17,11 @@
 
 #include "stream_common/transfer_common.hpp"
 
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
 
 namespace hailort
 {
@@ -23,8 +29,8 @@ namespace hailort
 class CallbackReorderQueue final {
 public:
     CallbackReorderQueue(size_t max_size) :
-        m_max_size(max_size),
-        m_callbacks_queue(compare_callbacks{}, make_queue_storage(m_max_size))
+        m_capacity(next_power_of_two(max_size)),
+        m_slots(m_capacity)
     {}
 
     // Wraps the given original callback so it will be called in the same wrap_callback order.
@@ -38,52 +44,44 @@ public:
     void cancel_last_callback();
 
 private:
-    // must be called with m_lock held
-    void call_queued_callbacks_in_order();
-
-    // Each callback has a function pointer and its index
-    using Callback = std::pair<uint64_t, std::function<void()>>;
-
-    void push_callback(const Callback &callback);
-
-    // Pop next callback ready to be called. Can return HAILO_NOT_AVAILABLE if there is no callback ready.
-    Expected<Callback> pop_ready_callback();
+    struct Slot {
+        // Holds (callback index + 1) once the slot's callback is published, so every ring round has
+        // a distinct ready marker and slots don't need resetting between rounds.
+        std::atomic<uint64_t> ready_marker{0};
+        std::function<void()> callback;
+    };
 
-    // We don't want to have any memory allocations in runtime, so we init the priority queue with a reserved vector.
-    static std::vector<Callback> make_queue_storage(size_t max_size)
+    static size_t next_power_of_two(size_t size)
     {
-        std::vector<Callback> storage;
-        storage.reserve(max_size);
-        return storage;
+        size_t result = 1;
+        while (result < size) {
+            result *= 2;
+        }
+        return result;
     }
 
-    const size_t m_max_size;
-
-    // Guards access to m_callbacks_queue and the counters.
-    std::mutex m_queue_mutex;
+    Slot &slot_of(uint64_t callback_index)
+    {
+        return m_slots[callback_index & (m_capacity - 1)];
+    }
 
-    // Increasing counter for the index on next register callback. We don't worry about overflow (Even if we assume
-    // extreme value of 1,000,000 per second)
-    uint64_t m_registered_callbacks = 0;
+    // Publishes the callback of the given index into its ring slot (release), then drains the
+    // ready prefix of the ring unless another thread is already draining (that thread will pick
+    // the newly published slot up on its re-check).
+    void publish_and_drain(uint64_t callback_index, std::function<void()> &&callback);
 
-    // Amount of callback that have called. Because the callbacks are called in order, this counter contains the index
-    // of the next callback expected to be executed.
-    uint64_t m_called_callbacks = 0;
+    const size_t m_capacity;
+    std::vector<Slot> m_slots;
 
-    struct compare_callbacks {
-        bool operator()(const Callback &a, const Callback &b)
-        {
-            // We want to pop the lower index first
-            return a.first > b.first;
-        }
-    };
+    // Index for the next registered callback. In-flight callbacks are bounded by the external
+    // queue sizes (<= capacity), so a slot is always consumed before its index round repeats.
+    std::atomic<uint64_t> m_registered_callbacks{0};
 
-    // Callbacks are stored inside a priority_queue data-structure.
-    // The queue is sorted by the callbacks index (so we pop the callbacks with the smallest index first).
-    std::priority_queue<Callback, std::vector<Callback>, compare_callbacks> m_callbacks_queue;
+    // Index of the next callback to be executed. Written only by the draining thread.
+    std::atomic<uint64_t> m_called_callbacks{0};
 
-    // This lock guarantee that only one thread is executing the callbacks.
-    std::mutex m_callbacks_mutex;
+    // Guarantees a single draining thread, without blocking the publishers.
+    std::atomic<bool> m_draining{false};
 };
 
 } /* namespace hailort */
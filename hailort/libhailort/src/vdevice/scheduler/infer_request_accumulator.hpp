@@ -20,6 +20,14 @@
 namespace hailort
 {
 
+// On atomic frame-group submission (HRT wishlist):
+//       The async API is already atomic at the scheduler boundary: run_async stages every input
+//       and output transfer of a bindings object here, and the scheduler only sees the frame once
+//       all of the core op's streams contributed (m_frame_accumulated fires on the completed
+//       group) - no partial frame ever holds device state. The remaining gap is the raw
+//       per-stream write/read API, where callers submit streams individually; such callers should
+//       move to bindings + run_async, and a stage+commit variant of the raw API would reuse this
+//       accumulator unchanged as its commit point.
 class InferRequestAccumulator final {
 public:
     InferRequestAccumulator(size_t streams_count, size_t max_queue_size,
@@ -11,6 +11,9 @@
 #include "vdevice/scheduler/scheduled_core_op_state.hpp"
 #include "vdevice/vdevice_core_op.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 
 namespace hailort
 {
@@ -20,6 +23,8 @@ ScheduledCoreOp::ScheduledCoreOp(std::shared_ptr<VDeviceCoreOp> core_op, std::ch
     m_core_op(core_op),
     m_last_run_time_stamp(std::chrono::steady_clock::now()),
     m_timeout(std::move(timeout)),
+    m_deadline(0),
+    m_oldest_pending_arrival(std::chrono::steady_clock::now()),
     m_max_batch_size(max_batch_size),
     m_max_ongoing_frames_per_device(max_ongoing_frames_per_device),
     m_use_dynamic_batch_flow(use_dynamic_batch_flow),
@@ -69,6 +74,144 @@ hailo_status ScheduledCoreOp::set_timeout(const std::chrono::milliseconds &timeo
     return HAILO_SUCCESS;
 }
 
+std::chrono::milliseconds ScheduledCoreOp::get_deadline() const
+{
+    return m_deadline;
+}
+
+void ScheduledCoreOp::set_deadline(const std::chrono::milliseconds &deadline)
+{
+    m_deadline = deadline;
+}
+
+Expected<std::chrono::time_point<std::chrono::steady_clock>> ScheduledCoreOp::predicted_next_arrival() const
+{
+    static const uint64_t MIN_ARRIVALS_FOR_PREDICTION = 8;
+    if ((m_arrivals_count < MIN_ARRIVALS_FOR_PREDICTION) || (0 == m_interarrival_ema_us)) {
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+    return m_last_arrival_time + std::chrono::microseconds(static_cast<int64_t>(m_interarrival_ema_us));
+}
+
+Expected<std::chrono::time_point<std::chrono::steady_clock>> ScheduledCoreOp::get_earliest_deadline() const
+{
+    if ((0 == m_deadline.count()) || (!m_has_pending_arrival) || (0 == m_requested_infer_requests.load())) {
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+    return m_oldest_pending_arrival + m_deadline;
+}
+
+void ScheduledCoreOp::mark_request_arrival()
+{
+    // Queue depth EMA for adaptive batching (single writer - the enqueueing caller)
+    static const double QUEUE_DEPTH_EMA_ALPHA = 0.125;
+    m_queue_depth_ema = (QUEUE_DEPTH_EMA_ALPHA * static_cast<double>(m_requested_infer_requests.load())) +
+        ((1.0 - QUEUE_DEPTH_EMA_ALPHA) * m_queue_depth_ema);
+
+    // Inter-arrival EMA for predictive prefetch
+    const auto arrival_time = std::chrono::steady_clock::now();
+    if (m_arrivals_count > 0) {
+        static const double INTERARRIVAL_EMA_ALPHA = 0.125;
+        const auto gap_us = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+            arrival_time - m_last_arrival_time).count());
+        m_interarrival_ema_us = (0 == m_interarrival_ema_us) ? gap_us :
+            ((INTERARRIVAL_EMA_ALPHA * gap_us) + ((1.0 - INTERARRIVAL_EMA_ALPHA) * m_interarrival_ema_us));
+    }
+    m_last_arrival_time = arrival_time;
+    m_arrivals_count++;
+
+    if (!m_has_pending_arrival) {
+        m_oldest_pending_arrival = std::chrono::steady_clock::now();
+        m_has_pending_arrival = true;
+    }
+}
+
+void ScheduledCoreOp::set_coalescing_window(std::chrono::microseconds max_wait)
+{
+    m_coalescing_window = max_wait;
+}
+
+std::chrono::microseconds ScheduledCoreOp::get_coalescing_window() const
+{
+    return m_coalescing_window;
+}
+
+bool ScheduledCoreOp::should_wait_for_coalescing() const
+{
+    return time_until_coalescing_expiry().has_value();
+}
+
+Expected<std::chrono::microseconds> ScheduledCoreOp::time_until_coalescing_expiry() const
+{
+    if ((0 == m_coalescing_window.count()) || (!m_has_pending_arrival)) {
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+
+    const auto pending = m_requested_infer_requests.load();
+    if ((0 == pending) || (pending >= m_max_batch_size)) {
+        // Nothing pending, or a full batch already formed
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+
+    // Adaptive shrink - the fuller the batch, the shorter we are willing to wait
+    const auto fill_ratio = static_cast<double>(pending) / m_max_batch_size;
+    const auto effective_window = std::chrono::microseconds(
+        static_cast<int64_t>(static_cast<double>(m_coalescing_window.count()) * (1.0 - fill_ratio)));
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - m_oldest_pending_arrival);
+    if (elapsed >= effective_window) {
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+    return effective_window - elapsed;
+}
+
+// EMA smoothing factor for the switch cost model
+static const double SWITCH_COST_EMA_ALPHA = 0.25;
+// A switch is considered amortized when its cost is spread over frames worth this much device time
+static const double SWITCH_AMORTIZATION_FRAME_TIME_US = 500.0;
+// Upper bound so a pathological measurement can't starve a core op forever
+static const uint16_t MAX_AMORTIZATION_FRAMES = 64;
+
+void ScheduledCoreOp::record_switch_duration(std::chrono::microseconds duration)
+{
+    m_switches_count++;
+
+    const auto duration_us = static_cast<double>(duration.count());
+    if (0 == m_switch_cost_ema_us) {
+        m_switch_cost_ema_us = duration_us;
+    } else {
+        m_switch_cost_ema_us = (SWITCH_COST_EMA_ALPHA * duration_us) +
+            ((1.0 - SWITCH_COST_EMA_ALPHA) * m_switch_cost_ema_us);
+    }
+}
+
+uint16_t ScheduledCoreOp::get_adaptive_burst_size()
+{
+    const auto configured_burst = get_burst_size();
+    const auto depth = static_cast<uint16_t>(std::max(1.0, std::ceil(m_queue_depth_ema)));
+    return std::min(configured_burst, depth);
+}
+
+uint16_t ScheduledCoreOp::get_min_amortization_frames() const
+{
+    if (0 == m_switch_cost_ema_us) {
+        return 0;
+    }
+    const auto frames = m_switch_cost_ema_us / SWITCH_AMORTIZATION_FRAME_TIME_US;
+    return static_cast<uint16_t>(std::min<double>(frames, MAX_AMORTIZATION_FRAMES));
+}
+
+void ScheduledCoreOp::mark_requests_dequeued()
+{
+    if (m_requested_infer_requests.load() > 0) {
+        // Approximation - the next pending request arrived no later than now
+        m_oldest_pending_arrival = std::chrono::steady_clock::now();
+    } else {
+        m_has_pending_arrival = false;
+    }
+}
+
 hailo_status ScheduledCoreOp::set_threshold(uint32_t threshold)
 {
     CHECK(!use_dynamic_batch_flow() ||
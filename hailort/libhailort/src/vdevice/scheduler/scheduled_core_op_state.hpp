@@ -54,6 +54,10 @@ public:
 
     uint16_t get_max_batch_size() const;
     uint16_t get_burst_size() const;
+    // Adaptive batching - burst sized from the observed queue depth (EMA), between 1 and the
+    // configured burst, so light load gets latency-sized activations and bursts grow only when
+    // the queue actually sustains them
+    uint16_t get_adaptive_burst_size();
     bool use_dynamic_batch_flow() const;
 
     device_id_t get_last_device();
@@ -61,6 +65,39 @@ public:
 
     std::chrono::milliseconds get_timeout();
     hailo_status set_timeout(const std::chrono::milliseconds &timeout);
+
+    // Deadline (EDF) scheduling class - every infer request of this core op must complete within
+    // this duration from its arrival. Zero (default) keeps the core op in the priority/threshold
+    // scheduling class.
+    std::chrono::milliseconds get_deadline() const;
+    void set_deadline(const std::chrono::milliseconds &deadline);
+    // Absolute deadline of the oldest pending request, valid only when a deadline is configured
+    // and requests are pending
+    Expected<std::chrono::time_point<std::chrono::steady_clock>> get_earliest_deadline() const;
+    // Predicted next request arrival from the inter-arrival EMA (prefetch hinting). Unexpected
+    // until enough arrivals were observed.
+    Expected<std::chrono::time_point<std::chrono::steady_clock>> predicted_next_arrival() const;
+    void mark_request_arrival();
+    void mark_requests_dequeued();
+
+    // Time-bounded batch coalescing window - a ready core op below a full batch is held back up
+    // to this long (measured from its oldest pending request) to let a larger device batch form.
+    // The effective window shrinks linearly as the pending queue fills, so loaded producers are
+    // dispatched immediately. Zero (default) disables coalescing.
+    void set_coalescing_window(std::chrono::microseconds max_wait);
+    std::chrono::microseconds get_coalescing_window() const;
+    // True when dispatch should wait for more frames to coalesce into the batch
+    bool should_wait_for_coalescing() const;
+    // Time left until the current coalescing window expires; unexpected when no frame is held back
+    Expected<std::chrono::microseconds> time_until_coalescing_expiry() const;
+
+    // Online context-switch cost model - EMA of the measured activation/deactivation durations
+    void record_switch_duration(std::chrono::microseconds duration);
+    uint64_t get_switches_count() const { return m_switches_count.load(); }
+    // Minimum frames an incoming switch should amortize over, derived from the measured cost.
+    // Zero until the first switch was measured (keeping the previous preemption behavior).
+    uint16_t get_min_amortization_frames() const;
+
     uint32_t get_threshold();
     hailo_status set_threshold(uint32_t threshold);
     core_op_priority_t get_priority();
@@ -85,12 +122,28 @@ private:
     std::shared_ptr<VDeviceCoreOp> m_core_op;
     std::chrono::time_point<std::chrono::steady_clock> m_last_run_time_stamp;
     std::chrono::milliseconds m_timeout;
+    std::chrono::milliseconds m_deadline;
+    // EMA of measured core-op switch duration, in microseconds (0 = no samples yet)
+    double m_switch_cost_ema_us = 0;
+    std::atomic<uint64_t> m_switches_count{0};
+    std::chrono::microseconds m_coalescing_window{0};
+    // EMA of the pending queue depth observed at arrival (adaptive batching)
+    double m_queue_depth_ema = 0;
+    // Inter-arrival tracking for predictive prefetch
+    double m_interarrival_ema_us = 0;
+    std::chrono::time_point<std::chrono::steady_clock> m_last_arrival_time{};
+    uint64_t m_arrivals_count = 0;
+    // Arrival time of the oldest pending request (approximated to dequeue time once older
+    // requests were served)
+    std::chrono::time_point<std::chrono::steady_clock> m_oldest_pending_arrival;
+    bool m_has_pending_arrival = false;
     const uint16_t m_max_batch_size;
     const uint32_t m_max_ongoing_frames_per_device;
     const bool m_use_dynamic_batch_flow;
     size_t m_instances_count;
 
-    std::atomic_uint32_t m_requested_infer_requests;
+    // Own cache line - written from the enqueue path, read by the scheduler thread
+    alignas(64) std::atomic_uint32_t m_requested_infer_requests;
 
     uint32_t m_min_threshold;
 
@@ -14,11 +14,14 @@
 #include "vdevice/vdevice_core_op.hpp"
 #include "vdevice/scheduler/scheduler_oracle.hpp"
 #include "vdma/vdma_config_manager.hpp"
+#include "utils/timer_wheel.hpp"
 #include "hef/hef_internal.hpp"
 
 #include <fstream>
 
 
+#include <cstdlib>
+
 namespace hailort
 {
 
@@ -67,6 +70,9 @@ hailo_status CoreOpsScheduler::add_core_op(scheduler_core_op_handle_t core_op_ha
 
         const core_op_priority_t normal_priority = HAILO_SCHEDULER_PRIORITY_NORMAL;
         m_core_op_priority[normal_priority].add(core_op_handle);
+
+        // Shard the core op onto a home device run queue (oracle steals across queues when idle)
+        assign_core_op_home_device(core_op_handle);
     }
 
     return HAILO_SUCCESS;
@@ -101,14 +107,24 @@ hailo_status CoreOpsScheduler::switch_core_op(const scheduler_core_op_handle_t &
     assert(curr_device_info->is_idle());
     curr_device_info->is_switching_core_op = false;
 
-    const auto burst_size = scheduled_core_op->get_burst_size();
+    // Adaptive batching (opt-in) - burst follows the observed queue depth instead of the fixed
+    // configured burst, so batch size no longer trades latency against throughput statically
+    static const bool adaptive_batch = (nullptr != std::getenv("HAILO_ADAPTIVE_BATCH"));
+    const auto burst_size = adaptive_batch ? scheduled_core_op->get_adaptive_burst_size() :
+        scheduled_core_op->get_burst_size();
 
     auto frames_count = std::min(get_frames_ready_to_transfer(core_op_handle, device_id), burst_size);
     auto hw_batch_size = scheduled_core_op->use_dynamic_batch_flow() ? frames_count : SINGLE_CONTEXT_BATCH_SIZE;
 
     if (frames_count == 0) {
-        // TODO HRT-11753: don't allow this flow
-        return HAILO_SUCCESS;
+        // Predictive prefetch (opt-in) - an idle-time activation of the predicted-next model, so
+        // its context switch cost is paid before its request arrives
+        static const bool prefetch_enabled = (nullptr != std::getenv("HAILO_SCHED_PREFETCH"));
+        if ((!prefetch_enabled) || (core_op_handle == curr_device_info->current_core_op_handle)) {
+            // TODO HRT-11753: don't allow this flow
+            return HAILO_SUCCESS;
+        }
+        hw_batch_size = scheduled_core_op->use_dynamic_batch_flow() ? 1 : SINGLE_CONTEXT_BATCH_SIZE;
     }
 
     curr_device_info->frames_left_before_stop_streaming = burst_size;
@@ -125,8 +141,14 @@ hailo_status CoreOpsScheduler::switch_core_op(const scheduler_core_op_handle_t &
         }
 
         const bool is_batch_switch = (core_op_handle == curr_device_info->current_core_op_handle);
+        const auto switch_start_time = std::chrono::steady_clock::now();
         auto status = VdmaConfigManager::switch_core_op(current_core_op, next_core_op, hw_batch_size, is_batch_switch);
         CHECK_SUCCESS(status, "Failed switching core-op");
+        // Feed the online switch cost model (full core-op switches only - batch switches are cheap)
+        if (!is_batch_switch) {
+            scheduled_core_op->record_switch_duration(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - switch_start_time));
+        }
     }
 
     scheduled_core_op->set_last_run_timestamp(std::chrono::steady_clock::now()); // Mark timestamp on activation
@@ -221,6 +243,12 @@ CoreOpsScheduler::ReadyInfo CoreOpsScheduler::is_core_op_ready(const scheduler_c
         if (!result.over_threshold && !result.over_timeout){
             result.is_ready = false;
         }
+
+        // Hold back dispatch inside the coalescing window so bursty producers can still form a
+        // larger device batch (bounded by the window, which shrinks as the batch fills)
+        if (result.is_ready && scheduled_core_op->should_wait_for_coalescing()) {
+            result.is_ready = false;
+        }
     }
 
     return result;
@@ -237,6 +265,7 @@ hailo_status CoreOpsScheduler::enqueue_infer_request(const scheduler_core_op_han
     auto status = m_infer_requests.at(core_op_handle).enqueue(std::move(infer_request));
     if (HAILO_SUCCESS == status) {
         m_scheduled_core_ops.at(core_op_handle)->requested_infer_requests().fetch_add(1);
+        m_scheduled_core_ops.at(core_op_handle)->mark_request_arrival();
         m_scheduler_thread.signal();
     }
     return status;
@@ -253,6 +282,67 @@ hailo_status CoreOpsScheduler::set_timeout(const scheduler_core_op_handle_t &cor
     return status;
 }
 
+hailo_status CoreOpsScheduler::set_coalescing_window(const scheduler_core_op_handle_t &core_op_handle, const std::chrono::microseconds &max_wait, const std::string &/*network_name*/)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    m_scheduled_core_ops.at(core_op_handle)->set_coalescing_window(max_wait);
+    return HAILO_SUCCESS;
+}
+
+Expected<std::chrono::milliseconds> CoreOpsScheduler::time_until_next_coalescing_expiry()
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    Expected<std::chrono::milliseconds> earliest_expiry = make_unexpected(HAILO_NOT_AVAILABLE);
+    for (const auto &core_op_pair : m_scheduled_core_ops) {
+        auto expiry = core_op_pair.second->time_until_coalescing_expiry();
+        if (!expiry) {
+            continue;
+        }
+        // Round up, so the wait never wakes before the window actually expired
+        const auto expiry_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            expiry.value() + std::chrono::microseconds(999));
+        if ((!earliest_expiry) || (expiry_ms < earliest_expiry.value())) {
+            earliest_expiry = std::max(expiry_ms, std::chrono::milliseconds(1));
+        }
+    }
+    return earliest_expiry;
+}
+
+hailo_status CoreOpsScheduler::set_deadline(const scheduler_core_op_handle_t &core_op_handle, const std::chrono::milliseconds &deadline, const std::string &/*network_name*/)
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    m_scheduled_core_ops.at(core_op_handle)->set_deadline(deadline);
+    return HAILO_SUCCESS;
+}
+
+Expected<std::chrono::time_point<std::chrono::steady_clock>> CoreOpsScheduler::get_core_op_predicted_next_arrival(
+    const scheduler_core_op_handle_t &core_op_handle)
+{
+    return m_scheduled_core_ops.at(core_op_handle)->predicted_next_arrival();
+}
+
+Expected<std::chrono::time_point<std::chrono::steady_clock>> CoreOpsScheduler::get_core_op_earliest_deadline(
+    const scheduler_core_op_handle_t &core_op_handle)
+{
+    return m_scheduled_core_ops.at(core_op_handle)->get_earliest_deadline();
+}
+
+std::vector<hailo_scheduler_core_op_metrics_t> CoreOpsScheduler::get_metrics()
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+    std::vector<hailo_scheduler_core_op_metrics_t> metrics;
+    metrics.reserve(m_scheduled_core_ops.size());
+    for (const auto &handle_core_op_pair : m_scheduled_core_ops) {
+        hailo_scheduler_core_op_metrics_t core_op_metrics{};
+        core_op_metrics.core_op_handle = handle_core_op_pair.first;
+        core_op_metrics.pending_infer_requests = handle_core_op_pair.second->requested_infer_requests().load();
+        core_op_metrics.core_op_switches = handle_core_op_pair.second->get_switches_count();
+        core_op_metrics.max_batch_size = handle_core_op_pair.second->get_max_batch_size();
+        metrics.emplace_back(core_op_metrics);
+    }
+    return metrics;
+}
+
 hailo_status CoreOpsScheduler::set_threshold(const scheduler_core_op_handle_t &core_op_handle, uint32_t threshold, const std::string &/*network_name*/)
 {
     std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
@@ -304,12 +394,18 @@ hailo_status CoreOpsScheduler::optimize_streaming_if_enabled(const scheduler_cor
     return HAILO_SUCCESS;
 }
 
+uint16_t CoreOpsScheduler::get_core_op_min_amortization_frames(const scheduler_core_op_handle_t &core_op_handle) const
+{
+    return m_scheduled_core_ops.at(core_op_handle)->get_min_amortization_frames();
+}
+
 Expected<InferRequest> CoreOpsScheduler::dequeue_infer_request(scheduler_core_op_handle_t core_op_handle)
 {
     auto infer_request = m_infer_requests.at(core_op_handle).dequeue();
     CHECK_EXPECTED(infer_request);
 
     m_scheduled_core_ops.at(core_op_handle)->requested_infer_requests().fetch_sub(1);
+    m_scheduled_core_ops.at(core_op_handle)->mark_requests_dequeued();
     return infer_request.release();
 }
 
@@ -371,6 +467,26 @@ void CoreOpsScheduler::shutdown_core_op(scheduler_core_op_handle_t core_op_handl
 void CoreOpsScheduler::schedule()
 {
     std::shared_lock<std::shared_timed_mutex> lock(m_scheduler_mutex);
+
+    // Run-to-completion fast path: a vdevice hosting exactly one core op on one device never
+    // switches, so once the core op is current the per-wakeup oracle scan and switch machinery
+    // are skipped and pending frames are pushed straight to the device.
+    if ((1 == m_scheduled_core_ops.size()) && (1 == m_devices.size())) {
+        const auto core_op_handle = m_scheduled_core_ops.begin()->first;
+        auto &device_info = m_devices.begin()->second;
+        if ((device_info->current_core_op_handle == core_op_handle) && (!device_info->is_switching_core_op) &&
+            (m_scheduled_core_ops.begin()->second->instances_count() > 0)) {
+            const auto frames_ready = get_frames_ready_to_transfer(core_op_handle, device_info->device_id);
+            if (frames_ready > 0) {
+                auto status = send_all_pending_buffers(core_op_handle, device_info->device_id, frames_ready);
+                if ((HAILO_SUCCESS != status) && (HAILO_STREAM_ABORTED_BY_USER != status)) {
+                    LOGGER__ERROR("Run-to-completion fast path failed with status={}", status);
+                }
+            }
+            return;
+        }
+    }
+
     // First, we are using streaming optimization (where switch is not needed)
     for (auto &core_op_pair : m_scheduled_core_ops) {
         auto status = optimize_streaming_if_enabled(core_op_pair.first);
@@ -430,15 +546,31 @@ void CoreOpsScheduler::SchedulerThread::stop()
 
 void CoreOpsScheduler::SchedulerThread::worker_thread_main()
 {
-    OsUtils::set_current_thread_name("SCHEDULER");
+    OsUtils::configure_current_thread("SCHEDULER");
 
     while (m_is_running) {
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_cv.wait(lock, [this]() {
-                return m_execute_worker_thread.load();
-            });
-            m_execute_worker_thread = false;
+            // Wake exactly when the earliest coalescing window expires - the deadline is tracked
+            // by the shared timer wheel, so the wait itself stays untimed and purely event driven
+            // (coalescing is opt-in per core op, so usually no timer is registered at all).
+            auto coalescing_expiry = m_scheduler.time_until_next_coalescing_expiry();
+
+            auto timer_id = TimerWheel::INVALID_TIMER_ID;
+            if (coalescing_expiry) {
+                timer_id = TimerWheel::instance().register_timer(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(coalescing_expiry.value()),
+                    [this]() { signal(); });
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this]() {
+                    return m_execute_worker_thread.load();
+                });
+                m_execute_worker_thread = false;
+            }
+            // A late (already firing) callback only re-signals, which the predicate absorbs
+            TimerWheel::instance().cancel(timer_id);
         }
 
         if (!m_is_running) {
@@ -62,7 +62,21 @@ public:
     hailo_status enqueue_infer_request(const scheduler_core_op_handle_t &core_op_handle, InferRequest &&infer_request);
 
     hailo_status set_timeout(const scheduler_core_op_handle_t &core_op_handle, const std::chrono::milliseconds &timeout, const std::string &network_name);
+    // Moves the core op into the deadline (EDF) scheduling class - requests are served by earliest
+    // absolute deadline (arrival + deadline), ahead of the priority groups. Zero removes it.
+    hailo_status set_deadline(const scheduler_core_op_handle_t &core_op_handle, const std::chrono::milliseconds &deadline, const std::string &network_name);
+    // Time-bounded batch coalescing window (see ScheduledCoreOp::set_coalescing_window)
+    hailo_status set_coalescing_window(const scheduler_core_op_handle_t &core_op_handle, const std::chrono::microseconds &max_wait, const std::string &network_name);
+    // Time until the earliest active coalescing window expires, when some frame is held back.
+    // Used by the scheduler thread to bound its wait only while a re-evaluation is actually due.
+    Expected<std::chrono::milliseconds> time_until_next_coalescing_expiry();
+    virtual Expected<std::chrono::time_point<std::chrono::steady_clock>> get_core_op_earliest_deadline(
+        const scheduler_core_op_handle_t &core_op_handle) override;
+    virtual Expected<std::chrono::time_point<std::chrono::steady_clock>> get_core_op_predicted_next_arrival(
+        const scheduler_core_op_handle_t &core_op_handle) override;
     hailo_status set_threshold(const scheduler_core_op_handle_t &core_op_handle, uint32_t threshold, const std::string &network_name);
+    // Snapshot of per-core-op scheduler metrics (pending depth, switch counts) for telemetry
+    std::vector<hailo_scheduler_core_op_metrics_t> get_metrics();
     hailo_status set_priority(const scheduler_core_op_handle_t &core_op_handle, core_op_priority_t priority, const std::string &network_name);
 
     virtual ReadyInfo is_core_op_ready(const scheduler_core_op_handle_t &core_op_handle, bool check_threshold,
@@ -78,7 +92,8 @@ private:
     hailo_status optimize_streaming_if_enabled(const scheduler_core_op_handle_t &core_op_handle);
 
     Expected<InferRequest> dequeue_infer_request(scheduler_core_op_handle_t core_op_handle);
-    uint16_t get_frames_ready_to_transfer(scheduler_core_op_handle_t core_op_handle, const device_id_t &device_id) const;
+    virtual uint16_t get_frames_ready_to_transfer(scheduler_core_op_handle_t core_op_handle, const device_id_t &device_id) const override;
+    virtual uint16_t get_core_op_min_amortization_frames(const scheduler_core_op_handle_t &core_op_handle) const override;
 
     std::shared_ptr<VdmaConfigCoreOp> get_vdma_core_op(scheduler_core_op_handle_t core_op_handle,
         const device_id_t &device_id);
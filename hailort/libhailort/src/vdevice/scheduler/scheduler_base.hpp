@@ -48,6 +48,10 @@ struct ActiveDeviceInfo {
         return 0 == ongoing_infer_requests;
     }
 
+    // Thermal/power pressure flag - set from temperature polling (Control::get_chip_temperature)
+    // by the owner; the oracle prefers idle non-throttled devices when placing work
+    std::atomic_bool is_thermally_throttled{false};
+
     scheduler_core_op_handle_t current_core_op_handle;
     scheduler_core_op_handle_t next_core_op_handle;
     std::atomic_bool is_switching_core_op;
@@ -57,7 +61,8 @@ struct ActiveDeviceInfo {
     // (even if there is another core op ready).
     size_t frames_left_before_stop_streaming;
 
-    std::atomic_uint32_t ongoing_infer_requests;
+    // Own cache line - incremented by submitters, read by the scheduler thread
+    alignas(64) std::atomic_uint32_t ongoing_infer_requests;
 
     device_id_t device_id;
     std::string device_arch;
@@ -128,6 +133,39 @@ public:
     virtual ReadyInfo is_core_op_ready(const scheduler_core_op_handle_t &core_op_handle, bool check_threshold,
         const device_id_t &device_id) = 0;
 
+    // Frames of the core op that are ready to be sent to the given device
+    virtual uint16_t get_frames_ready_to_transfer(scheduler_core_op_handle_t core_op_handle,
+        const device_id_t &device_id) const
+    {
+        (void)core_op_handle;
+        (void)device_id;
+        return 0;
+    }
+
+    // Minimum ready frames an incoming core op must amortize a switch over (switch cost model)
+    virtual uint16_t get_core_op_min_amortization_frames(const scheduler_core_op_handle_t &core_op_handle) const
+    {
+        (void)core_op_handle;
+        return 0;
+    }
+
+    // Predicted next request arrival of the core op (prefetch hinting), when enough history exists
+    virtual Expected<std::chrono::time_point<std::chrono::steady_clock>> get_core_op_predicted_next_arrival(
+        const scheduler_core_op_handle_t &core_op_handle)
+    {
+        (void)core_op_handle;
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+
+    // Absolute deadline of the core op's oldest pending request, when it belongs to the deadline
+    // (EDF) scheduling class and has pending work. Unexpected(HAILO_NOT_AVAILABLE) otherwise.
+    virtual Expected<std::chrono::time_point<std::chrono::steady_clock>> get_core_op_earliest_deadline(
+        const scheduler_core_op_handle_t &core_op_handle)
+    {
+        (void)core_op_handle;
+        return make_unexpected(HAILO_NOT_AVAILABLE);
+    }
+
     virtual uint32_t get_device_count() const
     {
         return static_cast<uint32_t>(m_devices.size());
@@ -148,6 +186,32 @@ public:
         return m_core_op_priority;
     }
 
+    // Per-device run queues: every core op has a "home" device (assigned round-robin at add time).
+    // The oracle scans a device's own queue first and only steals from the other devices' queues
+    // when its queue has nothing ready, cutting the common-case scan by the device count while
+    // keeping the global priority/timeout semantics through the stealing fallback.
+    virtual void assign_core_op_home_device(const scheduler_core_op_handle_t &core_op_handle)
+    {
+        assert(!m_devices.empty());
+        auto device_iter = m_devices.begin();
+        std::advance(device_iter, m_next_home_device_index % m_devices.size());
+        m_next_home_device_index++;
+        m_core_op_home_device[core_op_handle] = device_iter->first;
+    }
+
+    virtual void remove_core_op_home_device(const scheduler_core_op_handle_t &core_op_handle)
+    {
+        m_core_op_home_device.erase(core_op_handle);
+    }
+
+    virtual bool is_core_op_homed_on_device(const scheduler_core_op_handle_t &core_op_handle,
+        const device_id_t &device_id) const
+    {
+        auto home_device = m_core_op_home_device.find(core_op_handle);
+        // Core ops without a home (single device / legacy paths) belong to every queue
+        return (m_core_op_home_device.end() == home_device) || (home_device->second == device_id);
+    }
+
 protected:
     SchedulerBase(hailo_scheduling_algorithm_t algorithm, std::vector<std::string> &devices_ids,
          std::vector<std::string> &devices_arch) : m_algorithm(algorithm)
@@ -167,6 +231,10 @@ protected:
 
     std::map<core_op_priority_t, PriorityGroup> m_core_op_priority;
 
+    // Home device per core op (see assign_core_op_home_device)
+    std::unordered_map<scheduler_core_op_handle_t, device_id_t> m_core_op_home_device;
+    size_t m_next_home_device_index = 0;
+
     hailo_scheduling_algorithm_t m_algorithm;
 };
 
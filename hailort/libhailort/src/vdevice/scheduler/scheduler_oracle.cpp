@@ -9,12 +9,103 @@
 
 #include "vdevice/scheduler/scheduler_oracle.hpp"
 #include "utils/profiler/tracer_macros.hpp"
+#include "utils/profiler/lite_tracer.hpp"
+
+#include <cstdlib>
 
 
 namespace hailort
 {
 
 scheduler_core_op_handle_t CoreOpsSchedulerOracle::choose_next_model(SchedulerBase &scheduler, const device_id_t &device_id, bool check_threshold)
+{
+    // Deadline (EDF) pass - core ops with a configured deadline are served strictly by earliest
+    // absolute deadline, ahead of the priority groups, to minimize deadline misses
+    auto edf_core_op = choose_earliest_deadline_model(scheduler, device_id);
+    if (INVALID_CORE_OP_HANDLE != edf_core_op) {
+        return edf_core_op;
+    }
+
+    // First pass runs over the device's own run queue only; when nothing there is ready, the second
+    // pass steals work homed on the other devices, preserving the global priority/timeout semantics
+    const bool OWN_QUEUE_ONLY = true;
+    auto core_op_handle = choose_next_model_from_queues(scheduler, device_id, check_threshold, OWN_QUEUE_ONLY);
+    if (INVALID_CORE_OP_HANDLE == core_op_handle) {
+        core_op_handle = choose_next_model_from_queues(scheduler, device_id, check_threshold, !OWN_QUEUE_ONLY);
+    }
+
+    // Predictive prefetch (opt-in) - with nothing ready and the device idle, begin activating the
+    // core op predicted to receive the next request, hiding its switch cost in the idle gap
+    if ((INVALID_CORE_OP_HANDLE == core_op_handle) && (!check_threshold) &&
+        (nullptr != std::getenv("HAILO_SCHED_PREFETCH"))) {
+        auto device_info = scheduler.get_device_info(device_id);
+        auto &priority_map = scheduler.get_core_op_priority_map();
+        std::chrono::time_point<std::chrono::steady_clock> soonest_arrival{};
+        for (auto iter = priority_map.rbegin(); iter != priority_map.rend(); ++iter) {
+            for (uint32_t i = 0; i < iter->second.size(); i++) {
+                const auto candidate = iter->second.get(i);
+                if (candidate == device_info->current_core_op_handle) {
+                    continue;
+                }
+                auto predicted = scheduler.get_core_op_predicted_next_arrival(candidate);
+                if (!predicted) {
+                    continue;
+                }
+                if ((INVALID_CORE_OP_HANDLE == core_op_handle) || (predicted.value() < soonest_arrival)) {
+                    core_op_handle = candidate;
+                    soonest_arrival = predicted.value();
+                }
+            }
+        }
+        if (INVALID_CORE_OP_HANDLE != core_op_handle) {
+            device_info->is_switching_core_op = true;
+            device_info->next_core_op_handle = core_op_handle;
+        }
+    }
+
+    return core_op_handle;
+}
+
+scheduler_core_op_handle_t CoreOpsSchedulerOracle::choose_earliest_deadline_model(SchedulerBase &scheduler,
+    const device_id_t &device_id)
+{
+    auto device_info = scheduler.get_device_info(device_id);
+    auto &priority_map = scheduler.get_core_op_priority_map();
+
+    auto earliest_core_op = INVALID_CORE_OP_HANDLE;
+    std::chrono::time_point<std::chrono::steady_clock> earliest_deadline{};
+    for (auto iter = priority_map.rbegin(); iter != priority_map.rend(); ++iter) {
+        auto &priority_group = iter->second;
+        for (uint32_t i = 0; i < priority_group.size(); i++) {
+            auto core_op_handle = priority_group.get(i);
+            auto deadline = scheduler.get_core_op_earliest_deadline(core_op_handle);
+            if (!deadline) {
+                // Not in the deadline scheduling class or no pending requests
+                continue;
+            }
+            // Deadline class disregards batching thresholds - a pending request must make progress
+            const bool CHECK_THRESHOLD = false;
+            if (!scheduler.is_core_op_ready(core_op_handle, CHECK_THRESHOLD, device_id).is_ready) {
+                continue;
+            }
+            if ((INVALID_CORE_OP_HANDLE == earliest_core_op) || (deadline.value() < earliest_deadline)) {
+                earliest_core_op = core_op_handle;
+                earliest_deadline = deadline.value();
+            }
+        }
+    }
+
+    if (INVALID_CORE_OP_HANDLE != earliest_core_op) {
+        const bool SWITCH_BECAUSE_IDLE = true;
+        TRACE(OracleDecisionTrace, SWITCH_BECAUSE_IDLE, device_id, earliest_core_op, false, true);
+        device_info->is_switching_core_op = true;
+        device_info->next_core_op_handle = earliest_core_op;
+    }
+    return earliest_core_op;
+}
+
+scheduler_core_op_handle_t CoreOpsSchedulerOracle::choose_next_model_from_queues(SchedulerBase &scheduler,
+    const device_id_t &device_id, bool check_threshold, bool own_queue_only)
 {
     auto device_info = scheduler.get_device_info(device_id);
     auto &priority_map = scheduler.get_core_op_priority_map();
@@ -24,11 +115,15 @@ scheduler_core_op_handle_t CoreOpsSchedulerOracle::choose_next_model(SchedulerBa
         // Iterate all core ops inside the priority group starting from priority_group next core op
         for (uint32_t i = 0; i < priority_group.size(); i++) {
             auto core_op_handle = priority_group.get(i);
+            if (own_queue_only != scheduler.is_core_op_homed_on_device(core_op_handle, device_id)) {
+                continue;
+            }
             auto ready_info = scheduler.is_core_op_ready(core_op_handle, check_threshold, device_id);
             if (ready_info.is_ready) {
                 // In cases device is idle the check_threshold is not needed, therefore is false.
                 bool switch_because_idle = !(check_threshold);
                 TRACE(OracleDecisionTrace, switch_because_idle, device_id, core_op_handle, ready_info.over_threshold, ready_info.over_timeout);
+                LITE_TRACE(LITE_TRACE_CATEGORY_SCHEDULER, 0 /* oracle decision */, core_op_handle);
                 device_info->is_switching_core_op = true;
                 device_info->next_core_op_handle = core_op_handle;
                  // Set next to run as next in round-robin
@@ -45,6 +140,20 @@ bool CoreOpsSchedulerOracle::should_stop_streaming(SchedulerBase &scheduler, cor
 {
     const auto device_info = scheduler.get_device_info(device_id);
     if (device_info->frames_left_before_stop_streaming > 0) {
+        // Priority inheritance - a strictly higher-priority core op with ready frames truncates
+        // the current burst instead of queueing behind it; equal/lower priorities keep waiting
+        // for the burst to finish
+        const auto &priorities = scheduler.get_core_op_priority_map();
+        for (auto iter = priorities.rbegin(); (iter != priorities.rend()) && (iter->first > core_op_priority); ++iter) {
+            auto &priority_group = iter->second;
+            for (uint32_t i = 0; i < priority_group.size(); i++) {
+                auto candidate = priority_group.get(i);
+                if (!is_core_op_active(scheduler, candidate) &&
+                    scheduler.is_core_op_ready(candidate, true, device_id).is_ready) {
+                    return true;
+                }
+            }
+        }
         // Only when frames_left_before_stop_streaming we consider stop streaming
         return false;
     }
@@ -58,6 +167,12 @@ bool CoreOpsSchedulerOracle::should_stop_streaming(SchedulerBase &scheduler, cor
         for (uint32_t i = 0; i < priority_group.size(); i++) {
             auto core_op_handle = priority_group.get(i);
             if (!is_core_op_active(scheduler, core_op_handle) && scheduler.is_core_op_ready(core_op_handle, true, device_id).is_ready) {
+                // Preempting costs a measured switch - require the incoming core op to have enough
+                // ready frames to amortize it (zero until its first switch was measured)
+                const auto min_amortization_frames = scheduler.get_core_op_min_amortization_frames(core_op_handle);
+                if (scheduler.get_frames_ready_to_transfer(core_op_handle, device_id) < min_amortization_frames) {
+                    continue;
+                }
                 return true;
             }
         }
@@ -84,6 +199,18 @@ std::vector<RunParams> CoreOpsSchedulerOracle::get_oracle_decisions(SchedulerBas
     auto &devices = scheduler.get_device_infos();
     std::vector<RunParams> oracle_decision;
 
+    // Thermal-aware placement - throttled devices only receive work when no cool device is idle,
+    // spreading load away from devices near their thermal limit
+    bool any_cool_idle_device = false;
+    for (const auto &pair : devices) {
+        auto &device_info = pair.second;
+        if (device_info->is_idle() && !device_info->is_switching_core_op &&
+            !device_info->is_thermally_throttled.load()) {
+            any_cool_idle_device = true;
+            break;
+        }
+    }
+
     for (const auto &pair : devices) {
         auto &active_device_info = pair.second;
 
@@ -92,6 +219,11 @@ std::vector<RunParams> CoreOpsSchedulerOracle::get_oracle_decisions(SchedulerBas
             oracle_decision.push_back({active_device_info->next_core_op_handle, active_device_info->device_id});
         }
 
+        if (any_cool_idle_device && active_device_info->is_thermally_throttled.load()) {
+            // Let the throttled device cool while a cool device can take the work
+            continue;
+        }
+
         // Check if device is idle
         if (!active_device_info->is_switching_core_op && active_device_info->is_idle()) {
             const bool CHECK_THRESHOLD = true;
@@ -37,6 +37,14 @@ private:
     CoreOpsSchedulerOracle() {}
     // TODO: Consider returning a vector of devices (we can use this function in other places)
     static bool is_core_op_active(SchedulerBase &scheduler, scheduler_core_op_handle_t core_op_handle);
+    // Single scan pass over the priority map, restricted to the device's own run queue
+    // (own_queue_only) or to work homed on other devices (work stealing pass)
+    static scheduler_core_op_handle_t choose_next_model_from_queues(SchedulerBase &scheduler,
+        const device_id_t &device_id, bool check_threshold, bool own_queue_only);
+    // EDF pass over the deadline scheduling class - returns the ready core op whose oldest pending
+    // request has the earliest absolute deadline
+    static scheduler_core_op_handle_t choose_earliest_deadline_model(SchedulerBase &scheduler,
+        const device_id_t &device_id);
 };
 
 } /* namespace hailort */
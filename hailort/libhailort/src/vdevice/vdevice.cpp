@@ -25,12 +25,21 @@
 #include "net_flow/pipeline/infer_model_internal.hpp"
 #include "core_op/core_op.hpp"
 
+#include "common/memory_accounting.hpp"
+#include "common/pipeline_manifest.hpp"
+#include "device_common/control.hpp"
+
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
 #include "service/rpc_client_utils.hpp"
 #include "rpc/rpc_definitions.hpp"
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
 
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <thread>
+
 namespace hailort
 {
 
@@ -101,6 +110,59 @@ Expected<ConfigureNetworkParams> VDevice::create_configure_params(Hef &hef, cons
     return hef.create_configure_params(stream_interface.release(), network_group_name);
 }
 
+// Process-level record of user buffer registrations. Mappings themselves die with the vdevice
+// (driver handles are per device), but the records survive - so a recovery path recreating its
+// VDevice after a device reset calls remap_registered_buffers() and gets its whole pre-mapped
+// arena re-registered in one call instead of re-threading registration through the application.
+struct BufferRegistrationRecord {
+    void *address;
+    size_t size;
+    hailo_stream_direction_t direction;
+};
+static std::mutex g_registered_buffers_mutex;
+static std::vector<BufferRegistrationRecord> g_registered_buffers;
+
+void record_buffer_registration(void *address, size_t size, hailo_stream_direction_t direction)
+{
+    std::lock_guard<std::mutex> lock(g_registered_buffers_mutex);
+    for (const auto &record : g_registered_buffers) {
+        if ((record.address == address) && (record.direction == direction)) {
+            return;
+        }
+    }
+    g_registered_buffers.emplace_back(BufferRegistrationRecord{address, size, direction});
+}
+
+void drop_buffer_registration(void *address, hailo_stream_direction_t direction)
+{
+    std::lock_guard<std::mutex> lock(g_registered_buffers_mutex);
+    for (auto it = g_registered_buffers.begin(); it != g_registered_buffers.end(); ++it) {
+        if ((it->address == address) && (it->direction == direction)) {
+            g_registered_buffers.erase(it);
+            return;
+        }
+    }
+}
+
+void VDevice::set_memory_steady_state(bool enabled)
+{
+    SteadyStateMemory::set(enabled);
+}
+
+hailo_status VDevice::remap_registered_buffers()
+{
+    std::vector<BufferRegistrationRecord> records;
+    {
+        std::lock_guard<std::mutex> lock(g_registered_buffers_mutex);
+        records = g_registered_buffers;
+    }
+    for (const auto &record : records) {
+        auto status = dma_map(record.address, record.size, record.direction);
+        CHECK_SUCCESS(status, "Failed re-mapping registered buffer {}", record.address);
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status VDevice::dma_map(void *address, size_t size, hailo_stream_direction_t direction)
 {
     (void) address;
@@ -136,6 +198,7 @@ VDeviceHandle::VDeviceHandle(uint32_t handle) : m_handle(handle)
 
 VDeviceHandle::~VDeviceHandle()
 {
+    join_background_configures();
     SharedResourceManager<std::string, VDeviceBase>::get_instance().release_resource(m_handle);
 }
 
@@ -229,6 +292,7 @@ VDeviceClient::VDeviceClient(std::unique_ptr<HailoRtRpcClient> client, VDeviceId
 
 VDeviceClient::~VDeviceClient()
 {
+    join_background_configures();
     auto status = finish_listener_thread();
     if (status != HAILO_SUCCESS) {
         LOGGER__CRITICAL("Failed to finish_listener_thread in VDevice");
@@ -436,13 +500,116 @@ Expected<hailo_stream_interface_t> VDeviceClient::get_default_streams_interface(
 #endif // HAILO_SUPPORT_MULTI_PROCESS
 
 
+// TODO: in-place vstream retarget for hot model reload (HRT wishlist):
+//       replace_network_group_async below covers the first two thirds of a zero-downtime swap -
+//       up-front interface validation and the background configure of the replacement while the
+//       old core op keeps serving. The last third is swapping without rebuilding vstreams:
+//       pause new submissions at the scheduler (pending frames drain to the old core op) and
+//       retarget the vstream entry elements at the new core op's streams. Elements hold their
+//       stream references for their lifetime today, so the swap needs the entry pads to
+//       re-resolve streams through a handle, which is the refactor this note tracks.
+void VDevice::join_background_configures()
+{
+    std::vector<std::thread> configure_threads;
+    {
+        std::lock_guard<std::mutex> lock(m_configure_threads_mutex);
+        configure_threads = std::move(m_configure_threads);
+    }
+    for (auto &configure_thread : configure_threads) {
+        if (configure_thread.joinable()) {
+            configure_thread.join();
+        }
+    }
+}
+
+VDevice::~VDevice()
+{
+    // Backstop - derived destructors join first, before their own members are torn down
+    join_background_configures();
+}
+
+hailo_status VDevice::configure_async(std::shared_ptr<Hef> hef, const NetworkGroupsParamsMap &configure_params,
+    std::function<void(Expected<ConfiguredNetworkGroupVector>)> on_configure_done)
+{
+    CHECK(nullptr != on_configure_done, HAILO_INVALID_ARGUMENT, "on_configure_done callback must be valid");
+    CHECK(nullptr != hef, HAILO_INVALID_ARGUMENT, "hef must be valid");
+
+    // The CPU-heavy part of configure (action-list building) runs on the spawned thread; the
+    // caller can launch several models back to back and collect results from the callbacks.
+    // The shared Hef handle keeps the model alive for the thread, and the thread itself is
+    // tracked and joined in the destructor, so neither the Hef nor this vdevice can be torn down
+    // underneath it.
+    std::lock_guard<std::mutex> lock(m_configure_threads_mutex);
+    m_configure_threads.emplace_back([this, hef, configure_params, on_configure_done]() {
+        on_configure_done(configure(*hef, configure_params));
+    });
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDevice::validate_replacement_compatibility(ConfiguredNetworkGroup &current_network_group,
+    Hef &new_hef)
+{
+    auto current_infos = current_network_group.get_all_stream_infos();
+    CHECK_EXPECTED_AS_STATUS(current_infos);
+    auto new_infos = new_hef.get_all_stream_infos(current_network_group.get_network_group_name());
+    CHECK_EXPECTED_AS_STATUS(new_infos);
+
+    CHECK(current_infos->size() == new_infos->size(), HAILO_INVALID_ARGUMENT,
+        "Replacement model is incompatible - {} streams instead of {}", new_infos->size(), current_infos->size());
+    for (const auto &current_info : current_infos.value()) {
+        auto matching_info = std::find_if(new_infos->begin(), new_infos->end(),
+            [&](const hailo_stream_info_t &new_info) { return 0 == strcmp(new_info.name, current_info.name); });
+        CHECK(new_infos->end() != matching_info, HAILO_INVALID_ARGUMENT,
+            "Replacement model is incompatible - stream {} does not exist in the new model", current_info.name);
+        CHECK((matching_info->direction == current_info.direction) &&
+            (matching_info->hw_frame_size == current_info.hw_frame_size) &&
+            (matching_info->format.type == current_info.format.type) &&
+            (matching_info->format.order == current_info.format.order), HAILO_INVALID_ARGUMENT,
+            "Replacement model is incompatible - stream {} interface differs", current_info.name);
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status VDevice::replace_network_group_async(std::shared_ptr<ConfiguredNetworkGroup> current_network_group,
+    std::shared_ptr<Hef> new_hef, const NetworkGroupsParamsMap &configure_params,
+    std::function<void(Expected<ConfiguredNetworkGroupVector>)> on_replacement_ready)
+{
+    CHECK(nullptr != current_network_group, HAILO_INVALID_ARGUMENT, "current network group must be valid");
+    CHECK(nullptr != new_hef, HAILO_INVALID_ARGUMENT, "new hef must be valid");
+
+    // Fail fast on an interface mismatch - after the callback the caller rebuilds its vstreams
+    // against the replacement, which only works when the edge interfaces line up
+    auto status = validate_replacement_compatibility(*current_network_group, *new_hef);
+    CHECK_SUCCESS(status);
+
+    return configure_async(new_hef, configure_params, std::move(on_replacement_ready));
+}
+
 Expected<std::unique_ptr<VDevice>> VDevice::create(const hailo_vdevice_params_t &params)
 {
+    // Declarative deployment config - the manifest's knob defaults apply once, before any device
+    // is opened (explicit environment variables still win)
+    PipelineManifest::apply_from_env();
+
     auto status = VDeviceBase::validate_params(params);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     std::unique_ptr<VDevice> vdevice;
 
+    // TODO: daemonless multi-process arbitration (HRT wishlist):
+    //       multi_process_service currently routes everything (including per-frame data) through
+    //       the gRPC service. The fork-shared machinery in stream_common/remote_process_stream.cpp
+    //       (RemoteProcessBufferPool over SharedAllocatedObject) already gives cross-process
+    //       frame queues without a daemon; extending it to unrelated processes requires:
+    //         - the CoreOpsScheduler run state (priority groups, pending depths, device
+    //           assignments) in a named shared-memory segment, guarded by robust pthread mutexes
+    //           so a crashed client cannot wedge the arbitration,
+    //         - per-process direct device access with the scheduler segment electing which process
+    //           may activate a core op (device fds are already shareable via the driver),
+    //         - epoch counters for client death cleanup (pids validated like the service does).
+    //       Until the scheduler state is relocatable into that segment, the service remains the
+    //       supported multi-process path.
     if (params.multi_process_service) {
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
         CHECK_AS_EXPECTED(params.scheduling_algorithm != HAILO_SCHEDULING_ALGORITHM_NONE, HAILO_INVALID_ARGUMENT,
@@ -547,8 +714,59 @@ Expected<std::unique_ptr<VDeviceBase>> VDeviceBase::create(const hailo_vdevice_p
     return vdevice;
 }
 
+// Above this core temperature a device is considered near throttle and the scheduler prefers
+// placing work on cooler idle devices (overridable via HAILO_THERMAL_LIMIT_C)
+static const float32_t DEFAULT_THERMAL_LIMIT_C = 100.0f;
+
+void VDeviceBase::start_thermal_monitor()
+{
+    m_thermal_monitor_thread = std::thread([this]() {
+        OsUtils::set_current_thread_name("THERMAL_MON");
+
+        static const auto POLL_INTERVAL = std::chrono::seconds(1);
+        const auto *limit_env = std::getenv("HAILO_THERMAL_LIMIT_C");
+        const auto thermal_limit = (nullptr != limit_env) ?
+            static_cast<float32_t>(strtod(limit_env, nullptr)) : DEFAULT_THERMAL_LIMIT_C;
+
+        while (!m_thermal_monitor_stop) {
+            for (const auto &id_device_pair : m_devices) {
+                hailo_chip_temperature_info_t temperature_info{};
+                // Cached control - other pollers in the process share the same reading
+                auto status = Control::get_chip_temperature_cached(*id_device_pair.second, &temperature_info);
+                if (HAILO_SUCCESS != status) {
+                    continue;
+                }
+                const auto max_temperature = std::max(temperature_info.ts0_temperature,
+                    temperature_info.ts1_temperature);
+                auto device_info = m_core_ops_scheduler->get_device_info(id_device_pair.first);
+                if (device_info) {
+                    device_info->is_thermally_throttled.store(max_temperature >= thermal_limit);
+                }
+            }
+
+            // Responsive shutdown within the interval
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(POLL_INTERVAL);
+            while ((remaining.count() > 0) && !m_thermal_monitor_stop) {
+                static const auto SLEEP_SLICE = std::chrono::milliseconds(100);
+                std::this_thread::sleep_for(SLEEP_SLICE);
+                remaining -= SLEEP_SLICE;
+            }
+        }
+    });
+}
+
+void VDeviceBase::stop_thermal_monitor()
+{
+    m_thermal_monitor_stop = true;
+    if (m_thermal_monitor_thread.joinable()) {
+        m_thermal_monitor_thread.join();
+    }
+}
+
 VDeviceBase::~VDeviceBase()
 {
+    join_background_configures();
+    stop_thermal_monitor();
     if (m_core_ops_scheduler) {
         // The scheduler is held as weak/shared ptr, so it may not be freed by this destructor implicitly.
         // The scheduler will be freed when the last reference is freed. If it will be freed inside some interrupt
@@ -574,6 +792,8 @@ Expected<ConfiguredNetworkGroupVector> VDeviceBase::configure(Hef &hef,
     added_network_groups.reserve(configure_params.size());
 
     for (const auto &network_params_pair : local_config_params.value()) {
+        // Host allocations of this model's configure flow are attributed to its name
+        AccountingScope accounting_scope(network_params_pair.first);
         std::vector<std::shared_ptr<CoreOp>> core_ops;
         const bool use_multiplexer = should_use_multiplexer();
 
@@ -690,11 +910,28 @@ Expected<std::map<device_id_t, std::unique_ptr<Device>>> VDeviceBase::create_dev
     auto device_ids = get_device_ids(params);
     CHECK_EXPECTED(device_ids);
 
+    // With an explicit device list, the per-device open + firmware identify probes are
+    // independent - run them in parallel so multi-device create stops paying them serially.
+    // Auto-selection keeps the serial scan, since it stops at the first free device_count devices.
+    std::map<device_id_t, Expected<std::unique_ptr<Device>>> pre_opened_devices;
+    if (user_specific_devices && (device_ids->size() > 1)) {
+        std::vector<std::pair<device_id_t, std::future<Expected<std::unique_ptr<Device>>>>> open_futures;
+        for (const auto &device_id : device_ids.value()) {
+            open_futures.emplace_back(device_id, std::async(std::launch::async,
+                [device_id]() { return Device::create(device_id); }));
+        }
+        for (auto &id_future_pair : open_futures) {
+            pre_opened_devices.emplace(id_future_pair.first, id_future_pair.second.get());
+        }
+    }
+
     for (const auto &device_id : device_ids.value()) {
         if (devices.size() == params.device_count) {
             break;
         }
-        auto device = Device::create(device_id);
+        auto pre_opened = pre_opened_devices.find(device_id);
+        auto device = (pre_opened_devices.end() != pre_opened) ?
+            std::move(pre_opened->second) : Device::create(device_id);
         CHECK_EXPECTED(device);
 
         // Validate That if (device_count != 1), device arch is not H8L. May be changed in SDK-28729
@@ -29,6 +29,10 @@
 #include "vdma/vdma_config_manager.hpp"
 #include "vdevice/vdevice_core_op.hpp"
 #include "vdevice/scheduler/scheduler.hpp"
+#include "utils/profiler/stats_emitter.hpp"
+
+#include <atomic>
+#include <thread>
 
 #ifdef HAILO_SUPPORT_MULTI_PROCESS
 #include "service/hailort_rpc_client.hpp"
@@ -39,6 +43,10 @@ namespace hailort
 {
 
 #define DISABLE_MULTIPLEXER_ENV_VAR "HAILO_DISABLE_MULTIPLEXER_INTERNAL"
+// Process-level registration records for remap_registered_buffers (implemented in vdevice.cpp)
+void record_buffer_registration(void *address, size_t size, hailo_stream_direction_t direction);
+void drop_buffer_registration(void *address, hailo_stream_direction_t direction);
+
 class VDeviceBase : public VDevice
 {
 public:
@@ -79,11 +87,19 @@ public:
         return m_core_ops_scheduler;
     }
 
+    virtual Expected<std::vector<hailo_scheduler_core_op_metrics_t>> get_scheduler_metrics() override
+    {
+        CHECK_AS_EXPECTED(nullptr != m_core_ops_scheduler, HAILO_NOT_SUPPORTED,
+            "Scheduler metrics are only available when the scheduler is enabled");
+        return m_core_ops_scheduler->get_metrics();
+    }
+
     // Currently only homogeneous vDevice is allow (= all devices are from the same type)
     virtual Expected<hailo_stream_interface_t> get_default_streams_interface() const override;
 
     virtual hailo_status dma_map(void *address, size_t size, hailo_stream_direction_t direction) override
     {
+        record_buffer_registration(address, size, direction);
         for (const auto &pair : m_devices) {
             auto &device = pair.second;
             const auto status = device->dma_map(address, size, direction);
@@ -94,6 +110,7 @@ public:
 
     virtual hailo_status dma_unmap(void *address, hailo_stream_direction_t direction) override
     {
+        drop_buffer_registration(address, direction);
         hailo_status status = HAILO_SUCCESS;
         for (const auto &pair : m_devices) {
             auto &device = pair.second;
@@ -115,7 +132,21 @@ public:
 private:
     VDeviceBase(std::map<device_id_t, std::unique_ptr<Device>> &&devices, CoreOpsSchedulerPtr core_ops_scheduler) :
         m_devices(std::move(devices)), m_core_ops_scheduler(core_ops_scheduler), m_next_core_op_handle(0)
-        {}
+        {
+        if (m_core_ops_scheduler && StatsEmitter::is_enabled()) {
+            auto scheduler = m_core_ops_scheduler;
+            m_stats_emitter = make_unique_nothrow<StatsEmitter>([scheduler]() { return scheduler->get_metrics(); });
+        }
+        if (m_core_ops_scheduler) {
+            start_thermal_monitor();
+        }
+}
+
+    // Per-second thermal poll over the vdevice's devices (uses the cached temperature control, so
+    // additional pollers in the process share the same firmware transaction). Feeds the
+    // scheduler's per-device thermal-throttle placement flag. Implemented in vdevice.cpp.
+    void start_thermal_monitor();
+    void stop_thermal_monitor();
 
     static Expected<std::map<device_id_t, std::unique_ptr<Device>>> create_devices(const hailo_vdevice_params_t &params);
     static Expected<std::vector<std::string>> get_device_ids(const hailo_vdevice_params_t &params);
@@ -129,6 +160,11 @@ private:
 
     std::map<device_id_t, std::unique_ptr<Device>> m_devices;
     CoreOpsSchedulerPtr m_core_ops_scheduler;
+    // Push-mode telemetry (enabled by HAILO_STATS_EMITTER) sampling the scheduler metrics
+    std::unique_ptr<StatsEmitter> m_stats_emitter;
+    // Thermal poll thread state (see start_thermal_monitor)
+    std::atomic<bool> m_thermal_monitor_stop{false};
+    std::thread m_thermal_monitor_thread;
     std::vector<std::shared_ptr<VDeviceCoreOp>> m_vdevice_core_ops;
     std::vector<std::shared_ptr<ConfiguredNetworkGroup>> m_network_groups; // TODO: HRT-9547 - Remove when ConfiguredNetworkGroup will be kept in global context
     ActiveCoreOpHolder m_active_core_op_holder;
@@ -202,7 +202,7 @@ InputStreamBase &VDeviceNativeInputStream::next_stream()
 
 void VDeviceNativeInputStream::advance_stream()
 {
-    if (0 == (++m_acc_frames % m_batch_size)) {
+    if (0 == (++m_acc_frames % frames_per_device())) {
         auto it = m_streams.upper_bound(m_next_transfer_stream);
         if (m_streams.end() == it) {
             it = m_streams.begin();
@@ -406,7 +406,7 @@ OutputStreamBase &VDeviceNativeOutputStream::next_stream()
 
 void VDeviceNativeOutputStream::advance_stream()
 {
-    if (0 == (++m_acc_frames % m_batch_size)) {
+    if (0 == (++m_acc_frames % frames_per_device())) {
         auto it = m_streams.upper_bound(m_next_transfer_stream);
         if (m_streams.end() == it) {
             it = m_streams.begin();
@@ -18,6 +18,8 @@
 #include "vdevice/callback_reorder_queue.hpp"
 #include "vdevice/vdevice_core_op.hpp"
 
+#include <cstdlib>
+
 
 namespace hailort
 {
@@ -72,6 +74,16 @@ protected:
     InputStreamBase &next_stream();
     void advance_stream();
 
+    // In frame-striping mode (HAILO_VDEVICE_FRAME_STRIPING) consecutive frames of the stream
+    // round-robin across all devices instead of whole batches, so a single high-FPS stream can
+    // exceed one device's throughput. Completion order is fixed by the callback reorder queue.
+    // Inputs and outputs use the same mode, keeping frame i on the same device on both sides.
+    uint16_t frames_per_device() const
+    {
+        static const bool frame_striping = (nullptr != std::getenv("HAILO_VDEVICE_FRAME_STRIPING"));
+        return frame_striping ? 1 : m_batch_size;
+    }
+
     std::map<device_id_t, std::reference_wrapper<InputStreamBase>> m_streams;
     device_id_t m_next_transfer_stream;
     uint32_t m_acc_frames;
@@ -127,6 +139,13 @@ private:
     OutputStreamBase &next_stream();
     void advance_stream();
 
+    // See VDeviceNativeInputStream::frames_per_device()
+    uint16_t frames_per_device() const
+    {
+        static const bool frame_striping = (nullptr != std::getenv("HAILO_VDEVICE_FRAME_STRIPING"));
+        return frame_striping ? 1 : m_batch_size;
+    }
+
     std::map<device_id_t, std::reference_wrapper<OutputStreamBase>> m_streams;
     device_id_t m_next_transfer_stream;
     uint32_t m_acc_frames;
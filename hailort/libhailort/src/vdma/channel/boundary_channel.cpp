@@ -13,7 +13,13 @@
 
 #include "vdma/channel/boundary_channel.hpp"
 #include "vdma/memory/vdma_buffer.hpp"
+#include "vdma/memory/desc_page_size_advisor.hpp"
+#include "utils/profiler/lite_tracer.hpp"
+#include "common/crc32c.hpp"
 
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
 #include <list>
 #include <chrono>
 #include <thread>
@@ -49,7 +55,7 @@ BoundaryChannel::BoundaryChannel(vdma::ChannelId channel_id, Direction direction
     m_latency_meter(latency_meter),
     m_is_channel_activated(false),
     m_ongoing_transfers((latency_meter != nullptr) ? ONGOING_TRANSFERS_SIZE/2 : ONGOING_TRANSFERS_SIZE),
-    m_last_bounded_buffer(BoundedBuffer{nullptr, 0, 0})
+    m_bound_buffers()
 {
     if (Direction::BOTH == direction) {
         LOGGER__ERROR("Boundary channels must be unidirectional");
@@ -71,6 +77,19 @@ BoundaryChannel::BoundaryChannel(vdma::ChannelId channel_id, Direction direction
 
     CB_INIT(m_descs, descs_count);
 
+    // Adaptive page sizing - streams measured (in this process) to carry consistently large frames
+    // get a bigger descriptor page on the next channel creation, cutting descriptor count and
+    // per-transfer programming cost. Must happen before the FW reads the boundary buffer info.
+    if ((!stream_name.empty()) && (nullptr != std::getenv("HAILO_ADAPTIVE_DESC_PAGE_SIZE"))) {
+        const auto recommended_page_size = DescPageSizeAdvisor::instance().recommended_page_size(
+            stream_name, desc_page_size, m_driver.desc_max_page_size());
+        if (recommended_page_size != desc_page_size) {
+            LOGGER__INFO("Using adaptive desc page size {} (configured {}) for stream {}",
+                recommended_page_size, desc_page_size, stream_name);
+            desc_page_size = recommended_page_size;
+        }
+    }
+
     status = allocate_descriptor_list(descs_count, desc_page_size);
     if (HAILO_SUCCESS != status) {
         LOGGER__ERROR("Failed to allocate Vdma buffer for channel transfer! status={}", status);
@@ -109,8 +128,12 @@ hailo_status BoundaryChannel::trigger_channel_completion(uint16_t hw_num_process
         hw_num_processed = latency_meter_hw_num_processed.value();
     }
 
+    // All transfers completed by this interrupt batch are collected under the lock (clearing their
+    // descriptors and advancing the tail), and their user callbacks are invoked in one batched
+    // dispatch after a single unlock - instead of cycling the channel mutex per transfer.
+    std::vector<std::pair<OngoingTransfer, hailo_status>> completed_transfers;
     while (!m_ongoing_transfers.empty()) {
-        // Reading previous_num_processed inside the loop since on_transfer_complete may increase this value.
+        // Reading previous_num_processed inside the loop since complete_transfer_state increases this value.
         const auto previous_num_processed = static_cast<uint16_t>(CB_TAIL(m_descs));
 
         if (!is_transfer_complete(m_ongoing_transfers.front(), previous_num_processed, hw_num_processed)) {
@@ -132,7 +155,20 @@ hailo_status BoundaryChannel::trigger_channel_completion(uint16_t hw_num_process
             }
         #endif
 
-        on_transfer_complete(lock, transfer, complete_status);
+        complete_transfer_state(transfer, complete_status);
+        update_channel_stats_on_complete(transfer);
+        check_free_descs_watermark();
+        LITE_TRACE(LITE_TRACE_CATEGORY_VDMA, 0 /* transfer complete */, m_channel_id.channel_index);
+        completed_transfers.emplace_back(std::move(transfer), complete_status);
+    }
+
+    if (!completed_transfers.empty()) {
+        // The descriptors of all completed transfers can already be reused - notify the user
+        // callbacks in one pass, in completion order, without the channel lock
+        lock.unlock();
+        for (auto &transfer_pair : completed_transfers) {
+            notify_transfer_done(transfer_pair.first, transfer_pair.second);
+        }
     }
 
     return HAILO_SUCCESS;
@@ -178,11 +214,58 @@ hailo_status BoundaryChannel::launch_transfer(TransferRequest &&transfer_request
         return HAILO_STREAM_NOT_ACTIVATED;
     }
 
+    uint16_t programmed_descs_count = 0;
+    auto status = program_transfer(std::move(transfer_request), user_owns_buffer, 0, programmed_descs_count);
+    CHECK_SUCCESS(status);
+
+    status = inc_num_available(programmed_descs_count);
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status BoundaryChannel::launch_transfers(std::vector<TransferRequest> &&transfer_requests, bool user_owns_buffer)
+{
+    std::unique_lock<std::mutex> lock(m_channel_mutex);
+    if (!m_is_channel_activated) {
+        return HAILO_STREAM_NOT_ACTIVATED;
+    }
+
+    uint16_t batch_descs_count = 0;
+    auto batch_status = HAILO_SUCCESS;
+    for (auto &transfer_request : transfer_requests) {
+        uint16_t programmed_descs_count = 0;
+        batch_status = program_transfer(std::move(transfer_request), user_owns_buffer, batch_descs_count,
+            programmed_descs_count);
+        if (HAILO_SUCCESS != batch_status) {
+            // Transfers already programmed are part of m_ongoing_transfers - the doorbell below must
+            // still cover them
+            break;
+        }
+        batch_descs_count = static_cast<uint16_t>(batch_descs_count + programmed_descs_count);
+    }
+
+    if (batch_descs_count > 0) {
+        // Single doorbell write for the whole batch
+        auto status = inc_num_available(batch_descs_count);
+        CHECK_SUCCESS(status);
+    }
+    CHECK_SUCCESS(batch_status);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status BoundaryChannel::program_transfer(TransferRequest &&transfer_request, bool user_owns_buffer,
+    uint16_t num_available_offset, uint16_t &programmed_descs_count)
+{
     if (m_ongoing_transfers.size() >= get_max_ongoing_transfers(transfer_request.get_total_transfer_size())) {
         return HAILO_QUEUE_IS_FULL;
     }
 
-    auto num_available = get_num_available();
+    DescPageSizeAdvisor::instance().record_transfer_size(m_stream_name,
+        static_cast<uint32_t>(transfer_request.get_total_transfer_size()));
+
+    auto num_available = static_cast<uint16_t>((get_num_available() + num_available_offset) & m_descs.size_mask);
     const uint16_t first_desc = num_available;
     std::vector<uint16_t> transfer_last_descs;
     uint16_t total_descs_count = 0;
@@ -226,14 +309,104 @@ hailo_status BoundaryChannel::launch_transfer(TransferRequest &&transfer_request
             InterruptsDomain::HOST);
     }
 
+    update_channel_stats_on_submit(transfer_request.get_total_transfer_size());
+    check_free_descs_watermark();
     add_ongoing_transfer(std::move(transfer_request), first_desc, std::move(transfer_last_descs));
 
-    auto status = inc_num_available(total_descs_count);
-    CHECK_SUCCESS(status);
+    programmed_descs_count = total_descs_count;
 
     return HAILO_SUCCESS;
 }
 
+
+void BoundaryChannel::update_channel_stats_on_submit(size_t transfer_size)
+{
+    m_total_transferred_bytes += transfer_size;
+    m_total_transfers++;
+    const auto current_occupancy = static_cast<uint32_t>(m_ongoing_transfers.size() + 1);
+    if (current_occupancy > m_ring_occupancy_high_watermark) {
+        m_ring_occupancy_high_watermark = current_occupancy;
+    }
+}
+
+void BoundaryChannel::update_channel_stats_on_complete(const OngoingTransfer &transfer)
+{
+    static const double DOORBELL_LATENCY_EMA_ALPHA = 0.125;
+    const auto completion_time = std::chrono::steady_clock::now();
+    const auto latency_us = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+        completion_time - transfer.submit_time).count());
+
+    // Completion rate for auto depth tuning
+    if (m_total_transfers > 1) {
+        const auto interarrival_us = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+            completion_time - m_last_completion_time).count());
+        m_completion_interarrival_ema_us = (0 == m_completion_interarrival_ema_us) ? interarrival_us :
+            ((DOORBELL_LATENCY_EMA_ALPHA * interarrival_us) +
+             ((1.0 - DOORBELL_LATENCY_EMA_ALPHA) * m_completion_interarrival_ema_us));
+    }
+    m_last_completion_time = completion_time;
+    if (0 == m_doorbell_to_interrupt_latency_us_ema) {
+        m_doorbell_to_interrupt_latency_us_ema = latency_us;
+    } else {
+        m_doorbell_to_interrupt_latency_us_ema = (DOORBELL_LATENCY_EMA_ALPHA * latency_us) +
+            ((1.0 - DOORBELL_LATENCY_EMA_ALPHA) * m_doorbell_to_interrupt_latency_us_ema);
+    }
+}
+
+void BoundaryChannel::set_free_descs_watermark(uint16_t threshold, FreeDescsWatermarkCallback callback)
+{
+    std::lock_guard<std::mutex> lock(m_channel_mutex);
+    m_free_descs_watermark = threshold;
+    m_free_descs_watermark_callback = std::move(callback);
+    m_below_free_descs_watermark = false;
+}
+
+void BoundaryChannel::check_free_descs_watermark()
+{
+    if ((0 == m_free_descs_watermark) || (!m_free_descs_watermark_callback)) {
+        return;
+    }
+
+    const auto num_available = get_num_available();
+    const auto num_processed = static_cast<uint16_t>(CB_TAIL(m_descs));
+    const auto free_descs = static_cast<uint16_t>(CB_AVAIL(m_descs, num_available, num_processed));
+
+    if (!m_below_free_descs_watermark && (free_descs < m_free_descs_watermark)) {
+        m_below_free_descs_watermark = true;
+        m_free_descs_watermark_callback(free_descs);
+    } else if (m_below_free_descs_watermark && (free_descs >= (2 * m_free_descs_watermark))) {
+        // Hysteresis - recovery is reported once free slots clear twice the threshold
+        m_below_free_descs_watermark = false;
+        m_free_descs_watermark_callback(free_descs);
+    }
+}
+
+uint16_t BoundaryChannel::recommended_ongoing_transfers(uint16_t fallback_depth, uint16_t max_depth) const
+{
+    static const uint64_t MIN_TRANSFERS_FOR_TUNING = 64;
+    if ((m_total_transfers < MIN_TRANSFERS_FOR_TUNING) || (0 == m_completion_interarrival_ema_us) ||
+        (0 == m_doorbell_to_interrupt_latency_us_ema)) {
+        return fallback_depth;
+    }
+
+    // Little's law - transfers in flight to keep the channel busy across the completion latency
+    const auto needed = m_doorbell_to_interrupt_latency_us_ema / m_completion_interarrival_ema_us;
+    const auto depth = static_cast<uint16_t>(std::min<double>(std::max(2.0, std::ceil(needed) + 1), max_depth));
+    return depth;
+}
+
+BoundaryChannelStats BoundaryChannel::get_channel_stats() const
+{
+    // Counters are written under m_channel_mutex; a snapshot read may be slightly stale, which is
+    // fine for monitoring
+    BoundaryChannelStats stats{};
+    stats.total_transferred_bytes = m_total_transferred_bytes;
+    stats.total_transfers = m_total_transfers;
+    stats.ring_occupancy_high_watermark = m_ring_occupancy_high_watermark;
+    stats.doorbell_to_interrupt_latency_us_ema = m_doorbell_to_interrupt_latency_us_ema;
+    return stats;
+}
+
 void BoundaryChannel::cancel_pending_transfers()
 {
     std::unique_lock<std::mutex> lock(m_channel_mutex);
@@ -307,6 +480,19 @@ bool BoundaryChannel::is_transfer_complete(const OngoingTransfer &transfer, uint
 void BoundaryChannel::on_transfer_complete(std::unique_lock<std::mutex> &lock,
     OngoingTransfer &transfer, hailo_status complete_status)
 {
+    complete_transfer_state(transfer, complete_status);
+
+    // We notify user callbacks registered with the transfer only after the descriptors can be
+    // reused (So the user will be able to start new transfer).
+    lock.unlock();
+    notify_transfer_done(transfer, complete_status);
+    lock.lock();
+}
+
+void BoundaryChannel::complete_transfer_state(OngoingTransfer &transfer, hailo_status complete_status)
+{
+    (void)complete_status;
+
     // Clear relevant descriptors from previous transfer
     if (nullptr != m_latency_meter) {
         m_desc_list->clear_descriptor(transfer.latency_measure_desc);
@@ -321,11 +507,22 @@ void BoundaryChannel::on_transfer_complete(std::unique_lock<std::mutex> &lock,
     //  1. On D2H channels - the output can be read by the user.
     //  2. On H2D channels - new input can be written to the buffer.
     _CB_SET(m_descs.tail, (transfer.last_descs.back() + 1) & m_descs.size_mask);
+}
 
-    // Finally, we notify user callbacks registered with the transfer.
-    // We want to make sure that the callbacks are called after the descriptors can be reused (So the user will
-    // be able to start new transfer).
-    lock.unlock();
+void BoundaryChannel::notify_transfer_done(OngoingTransfer &transfer, hailo_status complete_status)
+{
+    // Opt-in transfer integrity mode - checksum every completed transfer's payload (hardware
+    // CRC32C where available) and trace it, so silent data corruption can be cross-checked
+    // against the producer/consumer side without an extra application pass over the frame
+    static const bool integrity_mode = (nullptr != std::getenv("HAILO_TRANSFER_INTEGRITY"));
+    if (integrity_mode && (HAILO_SUCCESS == complete_status)) {
+        uint32_t payload_crc = 0;
+        for (auto &transfer_buffer : transfer.request.transfer_buffers) {
+            auto *base = transfer_buffer.base_buffer()->data() + transfer_buffer.offset();
+            payload_crc = crc32c::compute(base, transfer_buffer.size(), payload_crc);
+        }
+        LITE_TRACE(LITE_TRACE_CATEGORY_VDMA, 1 /* transfer crc */, payload_crc);
+    }
 
     if (Direction::D2H == m_direction) {
         for (auto& transfer_buffer : transfer.request.transfer_buffers) {
@@ -340,7 +537,6 @@ void BoundaryChannel::on_transfer_complete(std::unique_lock<std::mutex> &lock,
     }
 
     transfer.request.callback(complete_status);
-    lock.lock();
 }
 
 hailo_status BoundaryChannel::prepare_descriptors(size_t transfer_size, uint16_t starting_desc,
@@ -353,17 +549,32 @@ hailo_status BoundaryChannel::prepare_descriptors(size_t transfer_size, uint16_t
         if (!is_buffer_already_configured(mapped_buffer, buffer_offset_in_descs, starting_desc)) {
             // We need to configure the buffer now.
 
-            // First, store information on the buffer.
-            m_last_bounded_buffer.buffer = mapped_buffer;
-            m_last_bounded_buffer.starting_desc = starting_desc;
-            m_last_bounded_buffer.buffer_offset_in_descs = static_cast<uint16_t>(buffer_offset_in_descs);
-
             // Now we want that m_desc_list[starting_desc] will be mapped into mapped_buffer[buffer_offset].
             // The descriptors list configure always starts from buffer_offset=0, so in order to achieve our
             // configuration, we configure the buffer starting from desc=(starting_desc - buffer_offset_in_desc).
             // Then, after configuring buffer_offset bytes from the buffer, the desc_index will be starting desc.
             const int desc_diff = static_cast<int>(starting_desc) - static_cast<int>(buffer_offset_in_descs);
             const auto configure_starting_desc = static_cast<uint16_t>(m_descs.size + desc_diff) % m_descs.size;
+            const auto size_in_descs = m_desc_list->descriptors_in_buffer(mapped_buffer->size());
+
+            // This configure overwrites descriptors - drop every binding whose range it clobbers
+            const auto ring_size = static_cast<uint32_t>(m_descs.size);
+            const auto overlaps = [ring_size, configure_starting_desc, size_in_descs](const BoundedBuffer &bound) {
+                const auto diff_ab = (static_cast<uint32_t>(bound.configure_starting_desc) + ring_size -
+                    configure_starting_desc) % ring_size;
+                const auto diff_ba = (static_cast<uint32_t>(configure_starting_desc) + ring_size -
+                    bound.configure_starting_desc) % ring_size;
+                return (diff_ab < size_in_descs) || (diff_ba < bound.size_in_descs);
+            };
+            m_bound_buffers.erase(std::remove_if(m_bound_buffers.begin(), m_bound_buffers.end(), overlaps),
+                m_bound_buffers.end());
+
+            // Remember the new binding (bounded set - oldest binding is evicted)
+            if (m_bound_buffers.size() >= MAX_BOUND_BUFFERS) {
+                m_bound_buffers.erase(m_bound_buffers.begin());
+            }
+            m_bound_buffers.emplace_back(BoundedBuffer{mapped_buffer, starting_desc,
+                static_cast<uint16_t>(buffer_offset_in_descs), configure_starting_desc, size_in_descs});
 
             // Finally do the actual configuration.
             auto status = m_desc_list->configure_to_use_buffer(*mapped_buffer, m_channel_id, configure_starting_desc);
@@ -383,18 +594,22 @@ hailo_status BoundaryChannel::prepare_descriptors(size_t transfer_size, uint16_t
 bool BoundaryChannel::is_buffer_already_configured(MappedBufferPtr buffer, size_t buffer_offset_in_descs,
     size_t starting_desc) const
 {
-    if (m_last_bounded_buffer.buffer != buffer) {
-        // Last buffer is nullptr or not the same as the given.
-        return false;
-    }
+    for (const auto &bound : m_bound_buffers) {
+        if (bound.buffer != buffer) {
+            continue;
+        }
 
-    // If the diff between starting_desc and m_last_bounded_buffer.starting_desc and the diff between
-    // buffer_offset_in_descs - m_last_bounded_buffer.buffer_offset_in_descs are equal, it means that the buffer is
-    // already configured.
-    // Note that we don't afraid of overflow since buffer_offset_in_descs * desc_page_size() must fit inside the buffer.
-    const auto starting_desc_diff = (starting_desc - m_last_bounded_buffer.starting_desc) % m_descs.size;
-    const auto buffer_offset_diff_in_descs = (buffer_offset_in_descs - m_last_bounded_buffer.buffer_offset_in_descs) % m_descs.size;
-    return starting_desc_diff == buffer_offset_diff_in_descs;
+        // If the diff between starting_desc and bound.starting_desc and the diff between
+        // buffer_offset_in_descs - bound.buffer_offset_in_descs are equal, it means that the buffer is
+        // already configured.
+        // Note that we don't afraid of overflow since buffer_offset_in_descs * desc_page_size() must fit inside the buffer.
+        const auto starting_desc_diff = (starting_desc - bound.starting_desc) % m_descs.size;
+        const auto buffer_offset_diff_in_descs = (buffer_offset_in_descs - bound.buffer_offset_in_descs) % m_descs.size;
+        if (starting_desc_diff == buffer_offset_diff_in_descs) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void BoundaryChannel::add_ongoing_transfer(TransferRequest &&transfer_request, uint16_t first_desc,
@@ -405,6 +620,7 @@ void BoundaryChannel::add_ongoing_transfer(TransferRequest &&transfer_request, u
     transfer.last_descs = std::move(last_descs);
     transfer.latency_measure_desc = (m_direction == HailoRTDriver::DmaDirection::H2D) ? first_desc :
         transfer.last_descs.back();
+    transfer.submit_time = std::chrono::steady_clock::now();
     m_ongoing_transfers.push_back(std::move(transfer));
 }
 
@@ -20,6 +20,7 @@
 
 #include "context_switch_defs.h"
 
+#include <functional>
 #include <memory>
 
 
@@ -30,6 +31,17 @@ struct OngoingTransfer {
     TransferRequest request;
     std::vector<uint16_t> last_descs;
     uint16_t latency_measure_desc;
+    // Doorbell time of the transfer - feeds the doorbell-to-interrupt latency EMA
+    std::chrono::time_point<std::chrono::steady_clock> submit_time;
+};
+
+// Rolling per-channel transfer counters, cheap enough to stay always on
+struct BoundaryChannelStats {
+    uint64_t total_transferred_bytes;
+    uint64_t total_transfers;
+    uint32_t ring_occupancy_high_watermark;
+    // EMA of the doorbell-to-interrupt latency, in microseconds (0 until first completion)
+    double doorbell_to_interrupt_latency_us_ema;
 };
 
 class BoundaryChannel;
@@ -68,10 +80,30 @@ public:
     // user_owns_buffer is set when the buffer is owned by the user (otherwise we may have some assumtions).
     hailo_status launch_transfer(TransferRequest &&transfer_request, bool user_owns_buffer);
 
+    // Batched submission - programs the descriptor ranges of all the given transfers in one pass and
+    // issues a single doorbell write for the whole batch, amortizing the per-transfer MMIO cost.
+    hailo_status launch_transfers(std::vector<TransferRequest> &&transfer_requests, bool user_owns_buffer);
+
     size_t get_max_ongoing_transfers(size_t transfer_size) const;
 
     CONTROL_PROTOCOL__host_buffer_info_t get_boundary_buffer_info(uint32_t transfer_size) const;
 
+    // Snapshot of the channel's rolling transfer counters (bytes, transfers, ring occupancy
+    // high-water mark, doorbell-to-interrupt latency EMA)
+    BoundaryChannelStats get_channel_stats() const;
+
+    // Auto depth tuning: in-flight transfers needed to cover the measured doorbell-to-interrupt
+    // latency at the measured completion rate (Little's law), clamped to [2, max]. Returns
+    // fallback_depth until enough completions were measured.
+    uint16_t recommended_ongoing_transfers(uint16_t fallback_depth, uint16_t max_depth) const;
+
+    // Backpressure watermark: @a callback fires (with the current free descriptor count) when the
+    // ring's free slots drop below @a threshold, and again when they recover above twice the
+    // threshold. Fired from the submission/completion paths - the callback must be cheap and must
+    // not call back into the channel. threshold 0 disables.
+    using FreeDescsWatermarkCallback = std::function<void(uint16_t free_descs)>;
+    void set_free_descs_watermark(uint16_t threshold, FreeDescsWatermarkCallback callback);
+
     vdma::ChannelId get_channel_id() const
     {
         return m_channel_id;
@@ -97,14 +129,29 @@ private:
         uint16_t current_num_processed) const;
     void on_transfer_complete(std::unique_lock<std::mutex> &lock, OngoingTransfer &transfer,
         hailo_status complete_status);
+    // Descriptor-state part of a transfer completion. Must be called with m_channel_mutex held.
+    void complete_transfer_state(OngoingTransfer &transfer, hailo_status complete_status);
+    // User-visible part of a transfer completion (D2H sync + callback). Called without the lock.
+    void notify_transfer_done(OngoingTransfer &transfer, hailo_status complete_status);
     hailo_status prepare_descriptors(size_t transfer_size, uint16_t starting_desc,
         MappedBufferPtr mapped_buffer, size_t buffer_offset, bool raise_interrupt = true);
 
+    // Programs the descriptors of a single transfer without ringing the doorbell.
+    // num_available_offset is the amount of descriptors already programmed (but not yet ringed) by
+    // the current batch; programmed_descs_count accumulates this transfer's descriptors.
+    // Must be called with m_channel_mutex held, on an activated channel.
+    hailo_status program_transfer(TransferRequest &&transfer_request, bool user_owns_buffer,
+        uint16_t num_available_offset, uint16_t &programmed_descs_count);
+
     bool is_buffer_already_configured(MappedBufferPtr buffer, size_t buffer_offset_in_descs, size_t starting_desc) const;
     void add_ongoing_transfer(TransferRequest &&transfer_request, uint16_t first_desc,
         std::vector<uint16_t> &&last_descs);
 
     static bool is_desc_between(uint16_t begin, uint16_t end, uint16_t desc);
+    void update_channel_stats_on_submit(size_t transfer_size);
+    void update_channel_stats_on_complete(const OngoingTransfer &transfer);
+    // Must be called with m_channel_mutex held
+    void check_free_descs_watermark();
     uint16_t get_num_available() const;
     hailo_status inc_num_available(uint16_t value);
     hailo_status allocate_descriptor_list(uint32_t descs_count, uint16_t desc_page_size);
@@ -122,6 +169,21 @@ private:
     std::mutex m_channel_mutex;
     CircularArray<OngoingTransfer> m_ongoing_transfers;
 
+    // Rolling channel stats (see get_channel_stats). Written under m_channel_mutex.
+    uint64_t m_total_transferred_bytes = 0;
+    uint64_t m_total_transfers = 0;
+    uint32_t m_ring_occupancy_high_watermark = 0;
+    double m_doorbell_to_interrupt_latency_us_ema = 0;
+
+    // Completion inter-arrival EMA (microseconds) for auto depth tuning
+    double m_completion_interarrival_ema_us = 0;
+    std::chrono::time_point<std::chrono::steady_clock> m_last_completion_time{};
+
+    // Backpressure watermark state (see set_free_descs_watermark)
+    uint16_t m_free_descs_watermark = 0;
+    FreeDescsWatermarkCallback m_free_descs_watermark_callback;
+    bool m_below_free_descs_watermark = false;
+
     // Contains the last num_processed of the last interrupt (only used on latency measurement)
     uint16_t m_last_timestamp_num_processed;
 
@@ -135,8 +197,17 @@ private:
         // It implies that:
         //      desc_list[starting_desc] will point to buffer[buffers_desc_offset * desc_page_size].
         uint16_t buffer_offset_in_descs;
+
+        // Descriptor range [configure_starting_desc, configure_starting_desc + size_in_descs)
+        // programmed for this binding - used to invalidate bindings clobbered by later configures
+        uint16_t configure_starting_desc;
+        uint32_t size_in_descs;
     };
 
+    // Applications cycling a fixed set of pre-mapped buffers keep all of them bound - a buffer
+    // whose descriptors weren't overwritten since its last configure skips re-programming entirely
+    static const size_t MAX_BOUND_BUFFERS = 16;
+
     // We store the last bounded buffer as cache in order to avoid unnecessary descriptors list reprogramming.
     // It is good enough to store only the last bounded buffer because we have two modes of execution:
     //      1. User allocated buffers - On each transfer we bind new buffer. Even if the user always uses the same
@@ -144,7 +215,7 @@ private:
     //         cacheing won't help).
     //      2. Single circular buffer (internally) - In this case we don't need to bind each time (maybe after the
     //         channel is re-activated). Caching the last bounded buffer is enough.
-    BoundedBuffer m_last_bounded_buffer;
+    std::vector<BoundedBuffer> m_bound_buffers;
 };
 
 } /* namespace vdma */
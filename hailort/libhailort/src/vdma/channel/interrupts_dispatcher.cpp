@@ -11,6 +11,12 @@
 #include "hailo/hailort_common.hpp"
 #include "common/os_utils.hpp"
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <fstream>
+#include <cstdlib>
+#endif
+
 namespace hailort {
 namespace vdma {
 
@@ -85,9 +91,66 @@ hailo_status InterruptsDispatcher::stop()
     return HAILO_SUCCESS;
 }
 
+#if defined(__linux__)
+// Best-effort NUMA affinity for the interrupt thread (opt-in via HAILO_NUMA_AFFINITY): pins the
+// thread to the cpus of the NUMA node local to the PCIe device, so completion processing and the
+// cachelines it touches stay on the device's socket.
+static void bind_thread_to_device_numa_node(const std::string &device_id)
+{
+    if (nullptr == std::getenv("HAILO_NUMA_AFFINITY")) {
+        return;
+    }
+
+    auto numa_node_file = std::ifstream("/sys/bus/pci/devices/" + device_id + "/numa_node");
+    int numa_node = -1;
+    if (!(numa_node_file >> numa_node) || (numa_node < 0)) {
+        return;
+    }
+
+    auto cpulist_file = std::ifstream("/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist");
+    std::string cpulist;
+    if (!(cpulist_file >> cpulist)) {
+        return;
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    size_t pos = 0;
+    while (pos < cpulist.size()) {
+        auto range_end = cpulist.find(',', pos);
+        if (std::string::npos == range_end) {
+            range_end = cpulist.size();
+        }
+        const auto range = cpulist.substr(pos, range_end - pos);
+        const auto dash = range.find('-');
+        const auto first_cpu = strtoul(range.c_str(), nullptr, 10);
+        const auto last_cpu = (std::string::npos == dash) ? first_cpu :
+            strtoul(range.c_str() + dash + 1, nullptr, 10);
+        for (auto cpu = first_cpu; (cpu <= last_cpu) && (cpu < CPU_SETSIZE); cpu++) {
+            CPU_SET(cpu, &cpu_set);
+        }
+        pos = range_end + 1;
+    }
+
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+}
+#endif /* defined(__linux__) */
+
+// TODO: sharded interrupt dispatching (HRT wishlist):
+//       One wait thread serves all channels of a device. Sharding splits the channels bitmap into
+//       N sub-bitmaps, each owned by its own wait thread (ideally affine to the NUMA node of the
+//       cpu handling that IRQ vector - see bind_thread_to_device_numa_node above). Two
+//       prerequisites: the kernel driver must support concurrent vdma_interrupts_wait callers
+//       with disjoint bitmaps (today a second waiter is rejected), and enable/disable must become
+//       per-shard so stop() can tear shards down independently. The user-space restructure is
+//       mechanical once those land - this loop becomes per-shard with the bitmap narrowed.
 void InterruptsDispatcher::wait_interrupts()
 {
-    OsUtils::set_current_thread_name("CHANNEL_INTR");
+    OsUtils::configure_current_thread("CHANNEL_INTR");
+
+#if defined(__linux__)
+    bind_thread_to_device_numa_node(m_driver.get().device_id());
+#endif
 
     std::unique_lock<std::mutex> lock(m_mutex);
     while (true) {
@@ -28,6 +28,13 @@ inline bool vdma_channel_control_is_aborted(uint8_t control_reg)
 }
 
 
+// TODO: user-space doorbell for integrated targets (HRT wishlist):
+//       Every register access below is an ioctl. On integrated (Hailo-15) targets the channel
+//       register block can be mmap'ed into the process (driver exposing a per-channel page with
+//       IOMMU/permission checks, write-only doorbell window), turning set_num_available into a
+//       single volatile store + barrier. This wrapper is the single choke point: given a mapped
+//       window from the driver, read/write_integer switch to direct access per channel while
+//       PCIe targets keep the ioctl path. Blocked on the driver exposing the mapping.
 class VdmaChannelRegs final {
 public:
     VdmaChannelRegs(HailoRTDriver &driver, vdma::ChannelId channel_id, HailoRTDriver::DmaDirection direction) :
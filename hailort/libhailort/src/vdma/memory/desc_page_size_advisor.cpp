@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file desc_page_size_advisor.cpp
+ * @brief Implementation of the adaptive descriptor page size advisor
+ **/
+
+#include "vdma/memory/desc_page_size_advisor.hpp"
+#include "vdma/memory/descriptor_list.hpp"
+
+#include <algorithm>
+
+namespace hailort {
+namespace vdma {
+
+// Enough samples to consider the stream's transfer size stable
+static const uint64_t MIN_SAMPLES_FOR_RECOMMENDATION = 32;
+// Keep at least this many descriptors per (smallest) transfer, so partial completions and credits
+// still have reasonable granularity
+static const uint32_t MIN_DESCS_PER_TRANSFER = 8;
+
+DescPageSizeAdvisor &DescPageSizeAdvisor::instance()
+{
+    static DescPageSizeAdvisor advisor;
+    return advisor;
+}
+
+void DescPageSizeAdvisor::record_transfer_size(const std::string &stream_name, uint32_t transfer_size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto &stats = m_stats[stream_name];
+    stats.min_transfer_size = (0 == stats.samples_count) ? transfer_size :
+        std::min(stats.min_transfer_size, transfer_size);
+    stats.samples_count++;
+}
+
+uint16_t DescPageSizeAdvisor::recommended_page_size(const std::string &stream_name,
+    uint16_t configured_page_size, uint16_t max_page_size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto stats_it = m_stats.find(stream_name);
+    if ((m_stats.end() == stats_it) || (stats_it->second.samples_count < MIN_SAMPLES_FOR_RECOMMENDATION)) {
+        return configured_page_size;
+    }
+
+    const auto upper_bound = std::min(max_page_size, MAX_DESC_PAGE_SIZE);
+    uint16_t page_size = configured_page_size;
+    while ((static_cast<uint32_t>(page_size) * 2 <= upper_bound) &&
+           ((static_cast<uint32_t>(page_size) * 2 * MIN_DESCS_PER_TRANSFER) <= stats_it->second.min_transfer_size)) {
+        page_size = static_cast<uint16_t>(page_size * 2);
+    }
+    return page_size;
+}
+
+} /* namespace vdma */
+} /* namespace hailort */
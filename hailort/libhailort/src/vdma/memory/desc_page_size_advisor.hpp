@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file desc_page_size_advisor.hpp
+ * @brief Process-wide registry of measured transfer sizes per stream, used to adaptively pick a
+ *        larger descriptor page size on the next channel creation for streams whose frames are
+ *        consistently big - cutting descriptor count and per-transfer programming cost.
+ **/
+
+#ifndef _HAILO_DESC_PAGE_SIZE_ADVISOR_HPP_
+#define _HAILO_DESC_PAGE_SIZE_ADVISOR_HPP_
+
+#include "hailo/expected.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace hailort {
+namespace vdma {
+
+class DescPageSizeAdvisor final
+{
+public:
+    static DescPageSizeAdvisor &instance();
+
+    DescPageSizeAdvisor(const DescPageSizeAdvisor &) = delete;
+    DescPageSizeAdvisor &operator=(const DescPageSizeAdvisor &) = delete;
+
+    void record_transfer_size(const std::string &stream_name, uint32_t transfer_size);
+
+    // The page size to use for the stream's next channel creation. Returns @a configured_page_size
+    // until enough transfers were measured; afterwards recommends the largest power-of-2 page (up
+    // to @a max_page_size) that still leaves a reasonable descriptor granularity for the smallest
+    // measured transfer.
+    uint16_t recommended_page_size(const std::string &stream_name, uint16_t configured_page_size,
+        uint16_t max_page_size);
+
+private:
+    DescPageSizeAdvisor() = default;
+
+    struct StreamStats {
+        uint64_t samples_count = 0;
+        uint32_t min_transfer_size = 0;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, StreamStats> m_stats;
+};
+
+} /* namespace vdma */
+} /* namespace hailort */
+
+#endif /* _HAILO_DESC_PAGE_SIZE_ADVISOR_HPP_ */
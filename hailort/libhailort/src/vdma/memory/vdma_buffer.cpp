@@ -8,11 +8,64 @@
  **/
 
 #include "vdma_buffer.hpp"
+#include "vdma/memory/continuous_buffer.hpp"
+#include "vdma/memory/sg_buffer.hpp"
 #include "control_protocol.h"
 
+#include "common/utils.hpp"
+
 namespace hailort {
 namespace vdma {
 
+// Scatter-gather allocations of at least this size are eligible for transparent hugepage backing
+// (the anonymous mapping is MADV_HUGEPAGE hinted before the pages are faulted and pinned)
+static const size_t HUGEPAGE_ELIGIBLE_SIZE = (2 * 1024 * 1024);
+
+std::array<std::atomic<uint64_t>, static_cast<size_t>(VdmaBuffer::AllocationTier::COUNT)> VdmaBuffer::s_allocation_tier_counters{};
+
+static void count_allocation_tier_hit(VdmaBuffer::AllocationTier tier,
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(VdmaBuffer::AllocationTier::COUNT)> &counters)
+{
+    counters[static_cast<size_t>(tier)]++;
+}
+
+Expected<std::unique_ptr<VdmaBuffer>> VdmaBuffer::create(HailoRTDriver &driver, Type preferred_type, size_t size,
+    uint32_t descs_count, uint16_t desc_page_size, bool is_circular,
+    HailoRTDriver::DmaDirection data_direction, ChannelId channel_id)
+{
+    if (Type::CONTINUOUS == preferred_type) {
+        auto continuous_buffer = ContinuousBuffer::create(size, driver);
+        if (continuous_buffer) {
+            count_allocation_tier_hit(AllocationTier::CONTINUOUS, s_allocation_tier_counters);
+            auto buffer_ptr = make_unique_nothrow<ContinuousBuffer>(continuous_buffer.release());
+            CHECK_NOT_NULL_AS_EXPECTED(buffer_ptr, HAILO_OUT_OF_HOST_MEMORY);
+            return std::unique_ptr<VdmaBuffer>(std::move(buffer_ptr));
+        }
+        if (HAILO_OUT_OF_HOST_CMA_MEMORY != continuous_buffer.status()) {
+            return make_unexpected(continuous_buffer.status());
+        }
+        // Expected on fragmented hosts after long uptime - fall through the policy chain
+        LOGGER__INFO("Continuous allocation of {} bytes failed (CMA fragmentation) - falling back to scatter-gather",
+            size);
+    }
+
+    auto sg_buffer = SgBuffer::create(driver, size, descs_count, desc_page_size, is_circular, data_direction,
+        channel_id);
+    CHECK_EXPECTED(sg_buffer);
+    count_allocation_tier_hit((size >= HUGEPAGE_ELIGIBLE_SIZE) ? AllocationTier::SG_HUGEPAGE : AllocationTier::SG,
+        s_allocation_tier_counters);
+
+    auto buffer_ptr = make_unique_nothrow<SgBuffer>(sg_buffer.release());
+    CHECK_NOT_NULL_AS_EXPECTED(buffer_ptr, HAILO_OUT_OF_HOST_MEMORY);
+    return std::unique_ptr<VdmaBuffer>(std::move(buffer_ptr));
+}
+
+uint64_t VdmaBuffer::get_allocation_tier_counter(AllocationTier tier)
+{
+    assert(tier < AllocationTier::COUNT);
+    return s_allocation_tier_counters[static_cast<size_t>(tier)].load();
+}
+
 CONTROL_PROTOCOL__host_buffer_info_t VdmaBuffer::get_host_buffer_info(uint32_t transfer_size)
 {
     return get_host_buffer_info(type(), dma_address(), desc_page_size(), descs_count(), transfer_size);
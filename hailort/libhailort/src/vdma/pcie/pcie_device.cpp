@@ -29,6 +29,18 @@
 namespace hailort
 {
 
+// TODO: PCIe peer-to-peer intermediate transfers (HRT wishlist):
+//       Chaining the output stream of one Hailo device to the input stream of another currently
+//       bounces through host memory. P2P needs:
+//         - the kernel driver exposing each device's BAR window for dma-buf / p2pdma export and
+//           accepting a peer bus address in the descriptor programming ioctls,
+//         - topology validation (same root complex / switch with ACS allowing P2P),
+//         - boundary channel descriptors pointed at the peer address instead of host pages (the
+//           user-space descriptor programming in BoundaryChannel already takes arbitrary
+//           addresses once the driver validates them).
+//       Host-side sequencing for cascades is covered by the InferCascade helper; the P2P data path
+//       is blocked on the driver pieces above.
+
 Expected<std::vector<hailo_pcie_device_info_t>> PcieDevice::scan()
 {
     auto scan_results = HailoRTDriver::scan_devices();
@@ -7,6 +7,27 @@
 namespace hailort
 {
 
+// TODO: double-buffered context configuration overlap (HRT wishlist):
+//       Multi-context models serialize context N's compute behind context N+1's configuration
+//       DMA. Overlapping them needs the firmware to accept the next context's config stream while
+//       the current context executes (second config channel or ping-pong config buffers on the
+//       device) and to expose a "config prefetch done" event the host action list can order
+//       against. Host-side, the config buffers and fetch actions are already split per context,
+//       so the change is an alternate action ordering once the FW capability exists.
+
+// TODO: snapshot/restore of configured network groups (HRT wishlist):
+//       Live checkpointing (ConfiguredNetworkGroup::snapshot() + restore in a forked worker) needs
+//       three pieces on top of the on-disk configure cache:
+//         1. the ResourcesManager state (channel allocations, contexts, boundary channel ids)
+//            serialized - the action-list controls part is already covered by the configure cache,
+//         2. the vdma mappings re-established in the restoring process (fd-based driver handles
+//            don't survive fork-exec; the fork-shared buffer machinery in
+//            stream_common/remote_process_stream.cpp covers plain fork),
+//         3. a FW-side handshake validating that the device state matches the snapshot's
+//            core-op index/epoch before activation.
+//       Snapshot without (3) risks activating against stale device state, so the API is gated on
+//       the FW counterpart; the host-side serialization should reuse the configure-cache format.
+
 Expected<VdmaConfigCoreOp> VdmaConfigCoreOp::create(ActiveCoreOpHolder &active_core_op_holder,
         const ConfigureNetworkParams &config_params,
         std::shared_ptr<ResourcesManager> resources_manager,
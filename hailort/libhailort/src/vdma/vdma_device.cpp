@@ -21,6 +21,7 @@
 
 #include <new>
 #include <algorithm>
+#include "utils/dma_buffer_pool.hpp"
 
 
 namespace hailort
@@ -173,7 +174,8 @@ Expected<std::shared_ptr<ConfiguredNetworkGroup>> VdmaDevice::create_configured_
 
     /* build HEF supported features */
     auto resource_manager = ResourcesManagerBuilder::build(current_core_op_index,
-        *this, get_driver(), config_params, core_op_metadata, hef.pimpl->get_device_arch());
+        *this, get_driver(), config_params, core_op_metadata, hef.pimpl->get_device_arch(),
+        hef.pimpl->md5());
     CHECK_EXPECTED(resource_manager);
 
 
@@ -238,6 +240,10 @@ ExpectedRef<vdma::InterruptsDispatcher> VdmaDevice::get_vdma_interrupts_dispatch
 
 VdmaDevice::~VdmaDevice()
 {
+    // Pooled pinned buffers may hold lazy mappings against this device's driver - drop them while
+    // the driver is still alive (the pool repopulates on demand)
+    DmaBufferPool::instance().clear();
+
     auto status = stop_notification_fetch_thread();
     if (HAILO_SUCCESS != status) {
         LOGGER__WARNING("Stopping notification thread ungracefully");
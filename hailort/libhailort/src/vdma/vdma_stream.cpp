@@ -14,6 +14,9 @@
 #include "common/os_utils.hpp"
 
 
+#include <cstdlib>
+#include <cstring>
+
 namespace hailort
 {
 
@@ -94,6 +97,23 @@ void VdmaInputStream::set_vdevice_core_op_handle(vdevice_core_op_handle_t core_o
     m_core_op_handle = core_op_handle;
 }
 
+
+// The sync read/write APIs are layered over the async BoundaryChannel machinery with an in-flight
+// ring as deep as the descriptor ring allows. HAILO_STREAM_QUEUE_DEPTH caps that depth (e.g. to
+// trade pipelining for latency / memory); values are clamped to [1, ring capacity].
+static size_t apply_configured_queue_depth(size_t max_ongoing_transfers)
+{
+    const auto *depth_env = std::getenv("HAILO_STREAM_QUEUE_DEPTH");
+    if (nullptr == depth_env) {
+        return max_ongoing_transfers;
+    }
+    const auto configured_depth = strtoul(depth_env, nullptr, 10);
+    if (0 == configured_depth) {
+        return max_ongoing_transfers;
+    }
+    return std::min<size_t>(configured_depth, max_ongoing_transfers);
+}
+
 Expected<std::unique_ptr<StreamBufferPool>> VdmaInputStream::allocate_buffer_pool()
 {
     auto circular_pool = CircularStreamBufferPool::create(m_device, HailoRTDriver::DmaDirection::H2D,
@@ -105,11 +125,28 @@ Expected<std::unique_ptr<StreamBufferPool>> VdmaInputStream::allocate_buffer_poo
 
 size_t VdmaInputStream::get_max_ongoing_transfers() const
 {
-    return m_channel->get_max_ongoing_transfers(get_frame_size());
+    const auto ring_depth = m_channel->get_max_ongoing_transfers(get_frame_size());
+    static const bool auto_depth = []() {
+        const auto *env = std::getenv("HAILO_STREAM_QUEUE_DEPTH");
+        return (nullptr != env) && (0 == strcmp(env, "auto"));
+    }();
+    if (auto_depth) {
+        // Depth follows the measured completion latency and rate (Little's law)
+        return m_channel->recommended_ongoing_transfers(static_cast<uint16_t>(ring_depth),
+            static_cast<uint16_t>(ring_depth));
+    }
+    return apply_configured_queue_depth(ring_depth);
 }
 
 Expected<TransferRequest> VdmaInputStream::align_transfer_request(TransferRequest &&transfer_request)
 {
+    // The silent fast-path miss users chase - surface it once per stream
+    if (!m_warned_unaligned_buffer) {
+        m_warned_unaligned_buffer = true;
+        LOGGER__WARNING("Stream {} received an unaligned user buffer - transfers go through a bounce-buffer copy. "
+            "Allocate with the alignment from get_buffer_constraints() for the zero-copy path.", name());
+    }
+
     const auto dma_alignment = OsUtils::get_dma_able_alignment();
     std::vector<TransferBuffer> transfer_buffers;
     TransferBuffer dma_able_bounce_buffer;
@@ -255,11 +292,27 @@ Expected<std::unique_ptr<StreamBufferPool>> VdmaOutputStream::allocate_buffer_po
 
 size_t VdmaOutputStream::get_max_ongoing_transfers() const
 {
-    return m_channel->get_max_ongoing_transfers(m_transfer_size);
+    const auto ring_depth = m_channel->get_max_ongoing_transfers(m_transfer_size);
+    static const bool auto_depth = []() {
+        const auto *env = std::getenv("HAILO_STREAM_QUEUE_DEPTH");
+        return (nullptr != env) && (0 == strcmp(env, "auto"));
+    }();
+    if (auto_depth) {
+        return m_channel->recommended_ongoing_transfers(static_cast<uint16_t>(ring_depth),
+            static_cast<uint16_t>(ring_depth));
+    }
+    return apply_configured_queue_depth(ring_depth);
 }
 
 Expected<TransferRequest> VdmaOutputStream::align_transfer_request(TransferRequest &&transfer_request)
 {
+    // The silent fast-path miss users chase - surface it once per stream
+    if (!m_warned_unaligned_buffer) {
+        m_warned_unaligned_buffer = true;
+        LOGGER__WARNING("Stream {} received an unaligned user buffer - transfers go through a bounce-buffer copy. "
+            "Allocate with the alignment from get_buffer_constraints() for the zero-copy path.", name());
+    }
+
     auto aligned_bounce_buffer_exp = DmaStorage::create_dma_able_buffer_from_user_size(nullptr,
         transfer_request.transfer_buffers[0].size());
     CHECK_EXPECTED(aligned_bounce_buffer_exp);
@@ -274,7 +327,7 @@ Expected<TransferRequest> VdmaOutputStream::align_transfer_request(TransferReque
     return TransferRequest(std::move(aligned_bounce_buffer), wrapped_callback);
 }
 
-hailo_status VdmaOutputStream::read_async_impl(TransferRequest &&transfer_request)
+Expected<TransferRequest> VdmaOutputStream::prepare_read_transfer_request(TransferRequest &&transfer_request)
 {
     if ((INVALID_CORE_OP_HANDLE != m_core_op_handle) && (HAILO_FORMAT_ORDER_HAILO_NMS != m_stream_info.format.order)) {
         // On NMS stream we trace EnqueueD2H inside nms_stream
@@ -285,19 +338,35 @@ hailo_status VdmaOutputStream::read_async_impl(TransferRequest &&transfer_reques
             original_callback(status);
         };
     }
-    const auto user_owns_buffer = (buffer_mode() == StreamBufferMode::NOT_OWNING);
     const auto dma_able_alignment = OsUtils::get_dma_able_alignment();
     if (reinterpret_cast<size_t>(transfer_request.transfer_buffers[0].base_buffer()->data()) % dma_able_alignment == 0) {
-        return m_channel->launch_transfer(std::move(transfer_request), user_owns_buffer);
-    } else {
-        // In case of read unaligned - currently doesnt support using users buffer - so allocate complete new buffer size of user's buffer
-        LOGGER__WARNING("read_async() was provided an unaligned buffer (address=0x{:x}), which causes performance degradation. Use buffers algined to {} bytes for optimal performance",
-            reinterpret_cast<size_t>(transfer_request.transfer_buffers[0].base_buffer()->data()), dma_able_alignment);
+        return std::move(transfer_request);
+    }
 
-        auto realigned_transfer_request = align_transfer_request(std::move(transfer_request));
-        CHECK_EXPECTED_AS_STATUS(realigned_transfer_request);
-        return m_channel->launch_transfer(realigned_transfer_request.release(), user_owns_buffer);
+    // In case of read unaligned - currently doesnt support using users buffer - so allocate complete new buffer size of user's buffer
+    LOGGER__WARNING("read_async() was provided an unaligned buffer (address=0x{:x}), which causes performance degradation. Use buffers algined to {} bytes for optimal performance",
+        reinterpret_cast<size_t>(transfer_request.transfer_buffers[0].base_buffer()->data()), dma_able_alignment);
+    return align_transfer_request(std::move(transfer_request));
+}
+
+hailo_status VdmaOutputStream::read_async_impl(TransferRequest &&transfer_request)
+{
+    auto prepared_request = prepare_read_transfer_request(std::move(transfer_request));
+    CHECK_EXPECTED_AS_STATUS(prepared_request);
+    const auto user_owns_buffer = (buffer_mode() == StreamBufferMode::NOT_OWNING);
+    return m_channel->launch_transfer(prepared_request.release(), user_owns_buffer);
+}
+
+hailo_status VdmaOutputStream::read_async_impl(std::vector<TransferRequest> &&transfer_requests)
+{
+    for (auto &transfer_request : transfer_requests) {
+        auto prepared_request = prepare_read_transfer_request(std::move(transfer_request));
+        CHECK_EXPECTED_AS_STATUS(prepared_request);
+        transfer_request = prepared_request.release();
     }
+    const auto user_owns_buffer = (buffer_mode() == StreamBufferMode::NOT_OWNING);
+    // One doorbell for the whole batch
+    return m_channel->launch_transfers(std::move(transfer_requests), user_owns_buffer);
 }
 
 hailo_status VdmaOutputStream::activate_stream_impl()
@@ -54,6 +54,7 @@ private:
     std::unique_ptr<StreamBufferPool> m_dma_bounce_buffer_pool;
 
     vdma::BoundaryChannelPtr m_channel;
+    bool m_warned_unaligned_buffer = false;
     const hailo_stream_interface_t m_interface;
     vdevice_core_op_handle_t m_core_op_handle;
 };
@@ -75,6 +76,7 @@ public:
     virtual Expected<std::unique_ptr<StreamBufferPool>> allocate_buffer_pool() override;
     virtual size_t get_max_ongoing_transfers() const override;
     virtual hailo_status read_async_impl(TransferRequest &&transfer_request) override;
+    virtual hailo_status read_async_impl(std::vector<TransferRequest> &&transfer_requests) override;
     virtual hailo_status activate_stream_impl() override;
     virtual hailo_status deactivate_stream_impl() override;
 
@@ -88,9 +90,13 @@ public:
 private:
     static uint32_t get_transfer_size(const hailo_stream_info_t &stream_info, const LayerInfo &layer_info);
     Expected<TransferRequest> align_transfer_request(TransferRequest &&transfer_request);
+    // Shared per-request preparation (tracing wrapper, realignment) for the single and batched
+    // submission paths
+    Expected<TransferRequest> prepare_read_transfer_request(TransferRequest &&transfer_request);
 
     VdmaDevice &m_device;
     vdma::BoundaryChannelPtr m_channel;
+    bool m_warned_unaligned_buffer = false;
     const hailo_stream_interface_t m_interface;
     const uint32_t m_transfer_size;
     vdevice_core_op_handle_t m_core_op_handle;
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2023 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file vstream_shm_buffer.hpp
+ * @brief Shared-memory frame buffer used as the data plane between the HailoRT service and its
+ *        clients. The client creates a named POSIX shared-memory segment per vstream and ships
+ *        only a doorbell (use_shm flag) through gRPC; the service maps the same segment and reads
+ *        or writes the frame in place, eliminating the protobuf payload and its copies.
+ *        The unary RPC semantics serialize access to the segment (the client blocks until the
+ *        service consumed/filled the frame), so a single frame slot per vstream suffices.
+ **/
+
+#ifndef _HAILO_VSTREAM_SHM_BUFFER_HPP_
+#define _HAILO_VSTREAM_SHM_BUFFER_HPP_
+
+#include "hailo/hailort.h"
+
+#include <string>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+namespace hailort
+{
+
+class VStreamShmBuffer final
+{
+public:
+    static std::string make_name(uint32_t vdevice_handle, uint32_t vstream_handle, bool is_input)
+    {
+        return "/hailort." + std::to_string(vdevice_handle) + "." + std::to_string(vstream_handle) +
+            (is_input ? ".in" : ".out");
+    }
+
+    VStreamShmBuffer() = default;
+    VStreamShmBuffer(const VStreamShmBuffer &) = delete;
+    VStreamShmBuffer &operator=(const VStreamShmBuffer &) = delete;
+    VStreamShmBuffer(VStreamShmBuffer &&other) :
+        m_name(std::move(other.m_name)),
+        m_data(other.m_data),
+        m_size(other.m_size),
+        m_is_owner(other.m_is_owner)
+    {
+        other.m_data = nullptr;
+        other.m_is_owner = false;
+    }
+
+    ~VStreamShmBuffer()
+    {
+#if defined(__linux__)
+        if (nullptr != m_data) {
+            (void)munmap(m_data, m_size);
+        }
+        if (m_is_owner) {
+            (void)shm_unlink(m_name.c_str());
+        }
+#endif
+    }
+
+    // Creates (client side) or opens (service side) the named segment. Returns false on any
+    // failure - callers fall back to the inline gRPC payload path.
+    bool init(const std::string &name, size_t size, bool create)
+    {
+#if defined(__linux__)
+        int fd = -1;
+        if (create) {
+            // O_EXCL, so a hostile process cannot pre-create the (predictable) name and retain
+            // access to our frames. A leftover segment from a dead process with the same handles
+            // is unlinked once and creation retried - if the name is still taken after that,
+            // somebody is actively squatting on it and we fall back to the inline payload path.
+            fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+            if ((fd < 0) && (EEXIST == errno)) {
+                (void)shm_unlink(name.c_str());
+                fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+            }
+        } else {
+            fd = shm_open(name.c_str(), O_RDWR, 0);
+        }
+        if (fd < 0) {
+            return false;
+        }
+
+        if (create && (0 != ftruncate(fd, static_cast<off_t>(size)))) {
+            (void)close(fd);
+            (void)shm_unlink(name.c_str());
+            return false;
+        }
+
+        // Verify the segment is what we expect before mapping it. The creating side must own its
+        // segment (the unlink-retry above could otherwise hand us a foreign file); the opening
+        // (service) side runs under a different uid by design and validates the size instead.
+        struct stat segment_stat{};
+        if ((0 != fstat(fd, &segment_stat)) ||
+            (create && (geteuid() != segment_stat.st_uid)) ||
+            ((!create) && (static_cast<size_t>(segment_stat.st_size) < size))) {
+            (void)close(fd);
+            if (create) {
+                (void)shm_unlink(name.c_str());
+            }
+            return false;
+        }
+
+        auto *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        (void)close(fd);
+        if (MAP_FAILED == data) {
+            if (create) {
+                (void)shm_unlink(name.c_str());
+            }
+            return false;
+        }
+        m_name = name;
+        m_data = data;
+        m_size = size;
+        m_is_owner = create;
+        return true;
+#else
+        (void)name;
+        (void)size;
+        (void)create;
+        return false;
+#endif
+    }
+
+    bool is_initialized() const { return nullptr != m_data; }
+    void *data() { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    std::string m_name;
+    void *m_data = nullptr;
+    size_t m_size = 0;
+    bool m_is_owner = false;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_VSTREAM_SHM_BUFFER_HPP_ */